@@ -0,0 +1,160 @@
+#include "BootState.h"
+
+#include <stdio.h>
+
+#include "ColorSpace.h"
+#include "StateStore.h"
+
+BootTimeline bootTimeline = {0, 0, 0};
+
+PersistedLight persistedDefault()
+{
+  PersistedLight saved;
+  uint8_t r = random(30);
+  uint8_t g = random(30);
+  uint8_t b = random(30);
+  WorkingColor color = colorFromRgb8(r, g, b);
+  saved.targets.r = color.r;
+  saved.targets.g = color.g;
+  saved.targets.b = color.b;
+  saved.targets.level = max(max(r, g), b); // The dimness lives in the level now
+  saved.targets.state = true;
+  saved.effect = EFFECT_AUTO_CYCLE;
+  saved.program = 0;
+  return saved;
+}
+
+void persistedEncode(const PersistedLight &saved, uint8_t *buffer)
+{
+  buffer[0] = PERSISTED_MAGIC;
+  buffer[1] = PERSISTED_VERSION;
+  buffer[2] = saved.targets.r & 0xFF;
+  buffer[3] = saved.targets.r >> 8;
+  buffer[4] = saved.targets.g & 0xFF;
+  buffer[5] = saved.targets.g >> 8;
+  buffer[6] = saved.targets.b & 0xFF;
+  buffer[7] = saved.targets.b >> 8;
+  buffer[8] = saved.targets.level;
+  buffer[9] = saved.targets.state ? 1 : 0;
+  buffer[10] = (uint8_t)saved.effect;
+  buffer[11] = saved.program;
+  buffer[12] = crc8(buffer, PERSISTED_ENCODED_SIZE - 1);
+}
+
+// Level, state and effect, which every version stores after the color
+static bool decodeTail(const uint8_t *tail, PersistedLight &saved)
+{
+  if (tail[1] > 1 || tail[2] >= MAX_EFFECT_NUMBER)
+  {
+    return false;
+  }
+  saved.targets.level = tail[0];
+  saved.targets.state = tail[1] != 0;
+  saved.effect = (EffectType)tail[2];
+  saved.program = 0;
+  return true;
+}
+
+bool persistedDecode(const uint8_t *buffer, size_t length, PersistedLight &saved)
+{
+  if (length < 2 || buffer[0] != PERSISTED_MAGIC)
+  {
+    return false;
+  }
+  if (buffer[1] == PERSISTED_VERSION_RGB8)
+  {
+    if (length < PERSISTED_RGB8_SIZE || buffer[8] != crc8(buffer, PERSISTED_RGB8_SIZE - 1) ||
+        !decodeTail(buffer + 5, saved))
+    {
+      return false;
+    }
+    WorkingColor color = colorFromRgb8(buffer[2], buffer[3], buffer[4]);
+    saved.targets.r = color.r;
+    saved.targets.g = color.g;
+    saved.targets.b = color.b;
+    return true;
+  }
+  // Version 2 is version 3 without the program byte
+  bool hasProgram = buffer[1] == PERSISTED_VERSION;
+  size_t size = hasProgram ? PERSISTED_ENCODED_SIZE : PERSISTED_NO_PROGRAM_SIZE;
+  if ((!hasProgram && buffer[1] != PERSISTED_VERSION_NO_PROGRAM) || length < size ||
+      buffer[size - 1] != crc8(buffer, size - 1) || !decodeTail(buffer + 8, saved))
+  {
+    return false;
+  }
+  if (hasProgram)
+  {
+    if (buffer[11] > VM_MAX_PROGRAMS)
+    {
+      return false;
+    }
+    saved.program = buffer[11];
+  }
+  saved.targets.r = buffer[2] | buffer[3] << 8;
+  saved.targets.g = buffer[4] | buffer[5] << 8;
+  saved.targets.b = buffer[6] | buffer[7] << 8;
+  return true;
+}
+
+bool persistedEqual(const PersistedLight &a, const PersistedLight &b)
+{
+  return a.targets.r == b.targets.r && a.targets.g == b.targets.g && a.targets.b == b.targets.b &&
+         a.targets.level == b.targets.level && a.targets.state == b.targets.state && a.effect == b.effect &&
+         a.program == b.program;
+}
+
+template <typename Scalar>
+EffectType selectedEffect(const LightStateT<Scalar> &light, const EffectStateT<Scalar> &effect)
+{
+  return light.specialMode == MODE_EFFECT_BLINKING ? light.savedEffect : effect.type;
+}
+
+template <typename Scalar>
+void bootRestore(LightStateT<Scalar> &light, EffectStateT<Scalar> &effect, const PersistedLight &saved, uint32_t now)
+{
+  LightTargets restored = saved.targets;
+  restored.transitionMs = 0; // No fade in from black
+  applyTargets(light, restored);
+  light.base_r = workingChannel<Scalar>(saved.targets.r);
+  light.base_g = workingChannel<Scalar>(saved.targets.g);
+  light.base_b = workingChannel<Scalar>(saved.targets.b);
+  light.base_level = Scalar(saved.targets.level);
+  light.base_state = saved.targets.state;
+  vmSelected.store(saved.program, std::memory_order_relaxed);
+  effectStart(effect, saved.effect, now);
+}
+
+void bootMark(uint32_t &phase, uint32_t nowUs)
+{
+  if (phase == 0)
+  {
+    phase = max(nowUs, (uint32_t)1);
+  }
+}
+
+// Milliseconds with one decimal, or "-" for a phase not reached yet
+static void formatPhase(char *text, size_t size, uint32_t us)
+{
+  if (us == 0)
+  {
+    snprintf(text, size, "-");
+  }
+  else
+  {
+    snprintf(text, size, "%lu.%lu ms", (unsigned long)(us / 1000), (unsigned long)(us / 100 % 10));
+  }
+}
+
+void bootTimelineLog(const BootTimeline &timeline)
+{
+  char setup[16], firstPwm[16], joined[16];
+  formatPhase(setup, sizeof(setup), timeline.setupUs);
+  formatPhase(firstPwm, sizeof(firstPwm), timeline.firstPwmUs);
+  formatPhase(joined, sizeof(joined), timeline.joinedUs);
+  Serial.printf("Boot: setup %s, first light %s, Zigbee joined %s after reset\n", setup, firstPwm, joined);
+}
+
+template EffectType selectedEffect<float>(const LightStateT<float> &, const EffectStateT<float> &);
+template EffectType selectedEffect<Fix16>(const LightStateT<Fix16> &, const EffectStateT<Fix16> &);
+template void bootRestore<float>(LightStateT<float> &, EffectStateT<float> &, const PersistedLight &, uint32_t);
+template void bootRestore<Fix16>(LightStateT<Fix16> &, EffectStateT<Fix16> &, const PersistedLight &, uint32_t);
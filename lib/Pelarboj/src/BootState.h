@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Render.h"
+
+// Instant-on boot: the last light the user had (on/off, color, level, the
+// selected effect and effect program) is persisted, and setup() starts the render and button
+// tasks from it straight away while Zigbee joins in the background. The boot
+// timeline records how long that takes.
+
+// What survives a power cut
+struct PersistedLight
+{
+  LightTargets targets; // Last Hue color, level and on/off
+  EffectType effect;    // Selected effect (the one blink mode returns to)
+  uint8_t program;      // Program EFFECT_PROGRAM runs (vmSelected), in library order
+};
+
+const uint8_t PERSISTED_MAGIC = 0x50;   // 'P'
+const uint8_t PERSISTED_VERSION = 3;
+const size_t PERSISTED_ENCODED_SIZE = 13; // Magic, version, r, g, b (16-bit LE), level, state, effect, program, CRC-8
+const uint8_t PERSISTED_VERSION_RGB8 = 1;
+const size_t PERSISTED_RGB8_SIZE = 9; // Version 1: 8-bit sRGB r, g, b
+const uint8_t PERSISTED_VERSION_NO_PROGRAM = 2;
+const size_t PERSISTED_NO_PROGRAM_SIZE = 12; // Version 2: no program
+
+// Used when nothing valid is stored: a dim random color with AUTO_CYCLE, as
+// the lamp always started before
+PersistedLight persistedDefault();
+
+void persistedEncode(const PersistedLight &saved, uint8_t *buffer);
+
+// False when the record is short, from another version or corrupt. Version 1
+// records (8-bit sRGB) are converted to the working color; versions 1 and 2
+// select the built-in program.
+bool persistedDecode(const uint8_t *buffer, size_t length, PersistedLight &saved);
+
+bool persistedEqual(const PersistedLight &a, const PersistedLight &b);
+
+// The effect a restart should come back to: the running one, or the one an
+// effect number blink will restore
+template <typename Scalar>
+EffectType selectedEffect(const LightStateT<Scalar> &light, const EffectStateT<Scalar> &effect);
+
+// Put the light straight into the persisted state at time now - base and
+// targets agree, so the first frame shows it without a transition. Selects the
+// saved program too; until the library has loaded that many, EFFECT_PROGRAM
+// runs the built-in one.
+template <typename Scalar>
+void bootRestore(LightStateT<Scalar> &light, EffectStateT<Scalar> &effect, const PersistedLight &saved, uint32_t now);
+
+// Boot phases in microseconds since the timer started at reset, 0 until reached
+struct BootTimeline
+{
+  uint32_t setupUs;    // setup() entered
+  uint32_t firstPwmUs; // LED task wrote its first duty
+  uint32_t joinedUs;   // Zigbee network joined
+};
+
+extern BootTimeline bootTimeline;
+
+// Record a phase the first time it is reached
+void bootMark(uint32_t &phase, uint32_t nowUs);
+
+void bootTimelineLog(const BootTimeline &timeline);
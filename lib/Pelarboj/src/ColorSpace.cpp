@@ -0,0 +1,173 @@
+#include "ColorSpace.h"
+
+#include <math.h>
+
+// sRGB transfer function, both ways (0..1)
+static float srgbToLinear(float value)
+{
+  return value <= 0.04045f ? value / 12.92f : powf((value + 0.055f) / 1.055f, 2.4f);
+}
+
+static float linearToSrgb(float value)
+{
+  return value <= 0.0031308f ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+}
+
+// CIE XYZ to linear sRGB (D65)
+static constexpr double SRGB_FROM_XYZ[3][3] = {
+    {3.2406, -1.5372, -0.4986},
+    {-0.9689, 1.8758, 0.0415},
+    {0.0557, -0.2040, 1.0570},
+};
+
+// Clip to the gamut and scale the strongest channel to WORKING_COLOR_MAX
+static WorkingColor normalized(float r, float g, float b)
+{
+  r = r > 0.0f ? r : 0.0f;
+  g = g > 0.0f ? g : 0.0f;
+  b = b > 0.0f ? b : 0.0f;
+  float strongest = r > g ? (r > b ? r : b) : (g > b ? g : b);
+  if (strongest <= 0.0f)
+  {
+    WorkingColor black = {0, 0, 0};
+    return black;
+  }
+  float scale = WORKING_COLOR_MAX / strongest;
+  WorkingColor color = {(uint16_t)(r * scale + 0.5f), (uint16_t)(g * scale + 0.5f), (uint16_t)(b * scale + 0.5f)};
+  return color;
+}
+
+WorkingColor colorFromXy(uint16_t x, uint16_t y)
+{
+  if (y == 0)
+  {
+    WorkingColor white = {WORKING_COLOR_MAX, WORKING_COLOR_MAX, WORKING_COLOR_MAX};
+    return white;
+  }
+
+  // XYZ at unit luminance, then to sRGB
+  float cx = x / 65536.0f;
+  float cy = y / 65536.0f;
+  float X = cx / cy;
+  float Z = (1.0f - cx - cy) / cy;
+  float rgb[3];
+  for (int i = 0; i < 3; i++)
+  {
+    rgb[i] = (float)SRGB_FROM_XYZ[i][0] * X + (float)SRGB_FROM_XYZ[i][1] + (float)SRGB_FROM_XYZ[i][2] * Z;
+  }
+  return normalized(rgb[0], rgb[1], rgb[2]);
+}
+
+// Color temperature table: the locus every 2^COLOR_TEMP_STEP_BITS mireds from
+// COLOR_TEMP_MIN_MIREDS, one entry past COLOR_TEMP_MAX_MIREDS
+const int COLOR_TEMP_STEP_BITS = 3;
+const int COLOR_TEMP_TABLE_SIZE = ((COLOR_TEMP_MAX_MIREDS - COLOR_TEMP_MIN_MIREDS) >> COLOR_TEMP_STEP_BITS) + 2;
+
+struct ColorTempTable
+{
+  WorkingColor values[COLOR_TEMP_TABLE_SIZE];
+};
+
+// Kim et al. cubic fit of the Planckian locus, valid from 1667 to 25000 K -
+// only ever evaluated by the compiler
+static constexpr WorkingColor planckianColor(double mireds)
+{
+  double t = mireds / 1e6; // 1 / kelvin
+  double x = mireds >= 250 ? ((-0.2661239e9 * t - 0.2343589e6) * t + 0.8776956e3) * t + 0.179910
+                           : ((-3.0258469e9 * t + 2.1070379e6) * t + 0.2226347e3) * t + 0.240390;
+  double y = mireds >= 450   ? ((-1.1063814 * x - 1.34811020) * x + 2.18555832) * x - 0.20219683
+             : mireds >= 250 ? ((-0.9549476 * x - 1.37418593) * x + 2.09137015) * x - 0.16748867
+                             : ((3.0817580 * x - 5.87338670) * x + 3.75112997) * x - 0.37001483;
+
+  double X = x / y;
+  double Z = (1.0 - x - y) / y;
+  double rgb[3] = {};
+  double strongest = 0.0;
+  for (int i = 0; i < 3; i++)
+  {
+    rgb[i] = SRGB_FROM_XYZ[i][0] * X + SRGB_FROM_XYZ[i][1] + SRGB_FROM_XYZ[i][2] * Z;
+    rgb[i] = rgb[i] > 0.0 ? rgb[i] : 0.0;
+    strongest = rgb[i] > strongest ? rgb[i] : strongest;
+  }
+  WorkingColor color = {(uint16_t)(rgb[0] / strongest * WORKING_COLOR_MAX + 0.5),
+                        (uint16_t)(rgb[1] / strongest * WORKING_COLOR_MAX + 0.5),
+                        (uint16_t)(rgb[2] / strongest * WORKING_COLOR_MAX + 0.5)};
+  return color;
+}
+
+static constexpr ColorTempTable buildColorTempTable()
+{
+  ColorTempTable table = {};
+  for (int i = 0; i < COLOR_TEMP_TABLE_SIZE; i++)
+  {
+    table.values[i] = planckianColor(COLOR_TEMP_MIN_MIREDS + (i << COLOR_TEMP_STEP_BITS));
+  }
+  return table;
+}
+
+static constexpr ColorTempTable COLOR_TEMP_TABLE = buildColorTempTable();
+
+static uint16_t interpolate(uint16_t low, uint16_t high, uint32_t fraction)
+{
+  return (uint16_t)(low + (((int32_t)high - low) * (int32_t)fraction >> COLOR_TEMP_STEP_BITS));
+}
+
+WorkingColor colorFromMireds(uint16_t mireds)
+{
+  mireds = mireds < COLOR_TEMP_MIN_MIREDS ? COLOR_TEMP_MIN_MIREDS : mireds;
+  mireds = mireds > COLOR_TEMP_MAX_MIREDS ? COLOR_TEMP_MAX_MIREDS : mireds;
+  uint32_t offset = mireds - COLOR_TEMP_MIN_MIREDS;
+  uint32_t fraction = offset & ((1 << COLOR_TEMP_STEP_BITS) - 1);
+  const WorkingColor &low = COLOR_TEMP_TABLE.values[offset >> COLOR_TEMP_STEP_BITS];
+  const WorkingColor &high = COLOR_TEMP_TABLE.values[(offset >> COLOR_TEMP_STEP_BITS) + 1];
+  WorkingColor color = {interpolate(low.r, high.r, fraction), interpolate(low.g, high.g, fraction),
+                        interpolate(low.b, high.b, fraction)};
+  return color;
+}
+
+WorkingColor colorFromHueSat(uint16_t hue, uint8_t saturation)
+{
+  // HSV at full value in gamma-encoded sRGB, as the Hue app picks it
+  float h = hue * (6.0f / 65536.0f);
+  float s = (saturation > 254 ? 254 : saturation) / 254.0f;
+  int sector = (int)h;
+  float f = h - sector;
+  float p = 1.0f - s;
+  float q = 1.0f - s * f;
+  float t = 1.0f - s * (1.0f - f);
+  float r, g, b;
+  switch (sector)
+  {
+  case 0:
+    r = 1.0f, g = t, b = p;
+    break;
+  case 1:
+    r = q, g = 1.0f, b = p;
+    break;
+  case 2:
+    r = p, g = 1.0f, b = t;
+    break;
+  case 3:
+    r = p, g = q, b = 1.0f;
+    break;
+  case 4:
+    r = t, g = p, b = 1.0f;
+    break;
+  default:
+    r = 1.0f, g = p, b = q;
+    break;
+  }
+  return normalized(srgbToLinear(r), srgbToLinear(g), srgbToLinear(b));
+}
+
+WorkingColor colorFromRgb8(uint8_t r, uint8_t g, uint8_t b)
+{
+  return normalized(srgbToLinear(r / 255.0f), srgbToLinear(g / 255.0f), srgbToLinear(b / 255.0f));
+}
+
+void colorToRgb8(const WorkingColor &color, uint8_t &r, uint8_t &g, uint8_t &b)
+{
+  r = (uint8_t)(linearToSrgb(color.r / (float)WORKING_COLOR_MAX) * 255.0f + 0.5f);
+  g = (uint8_t)(linearToSrgb(color.g / (float)WORKING_COLOR_MAX) * 255.0f + 0.5f);
+  b = (uint8_t)(linearToSrgb(color.b / (float)WORKING_COLOR_MAX) * 255.0f + 0.5f);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+
+// Working color: the chromaticity of a Hue command in linear light, 16 bits
+// per channel, scaled so the strongest channel is WORKING_COLOR_MAX. Level is
+// kept apart, so a color never loses precision to dimming. Each command is
+// converted once, from its native form (CIE xy, 16-bit enhanced hue and
+// saturation, or color temperature), and the base interpolation, the effects
+// and the output stage all work on the result. The LEDs are taken to have sRGB
+// primaries.
+
+const uint16_t WORKING_COLOR_MAX = 65535;
+const uint16_t COLOR_TEMP_MIN_MIREDS = 153; // Coolest white, 6500 K
+const uint16_t COLOR_TEMP_MAX_MIREDS = 500; // Warmest white, 2000 K
+
+struct WorkingColor
+{
+  uint16_t r, g, b;
+};
+
+// ZCL CurrentX/CurrentY (x = value / 65536). Colors outside the gamut are
+// clipped to it; a degenerate y gives white.
+WorkingColor colorFromXy(uint16_t x, uint16_t y);
+
+// ZCL EnhancedCurrentHue (full circle = 65536) and CurrentSaturation (0-254),
+// at full value
+WorkingColor colorFromHueSat(uint16_t hue, uint8_t saturation);
+
+// ZCL ColorTemperatureMireds, clamped to COLOR_TEMP_MIN/MAX_MIREDS: the
+// Planckian locus from a table built at compile time, interpolated
+WorkingColor colorFromMireds(uint16_t mireds);
+
+// Gamma-encoded 8-bit sRGB, e.g. what the Hue library reports. Black stays black.
+WorkingColor colorFromRgb8(uint8_t r, uint8_t g, uint8_t b);
+
+// Back to gamma-encoded 8-bit sRGB (strongest channel 255), for the coordinator
+void colorToRgb8(const WorkingColor &color, uint8_t &r, uint8_t &g, uint8_t &b);
@@ -0,0 +1,164 @@
+#include "Compositor.h"
+
+#include "Log.h"
+
+static const char *blendModeName(BlendMode mode)
+{
+  switch (mode)
+  {
+  case BLEND_REPLACE:
+    return "replace";
+  case BLEND_ADD:
+    return "add";
+  case BLEND_MULTIPLY:
+    return "multiply";
+  case BLEND_MODULATE_LEVEL:
+    return "modulate-level";
+  default:
+    return "?";
+  }
+}
+
+template <typename Scalar>
+bool compositorPush(CompositorT<Scalar> &compositor, const LayerSpec &spec)
+{
+  if (compositor.count >= MAX_COMPOSITOR_LAYERS || spec.type >= MAX_EFFECT_NUMBER ||
+      spec.type == EFFECT_AUTO_CYCLE || spec.type == EFFECT_LAYERED)
+  {
+    return false;
+  }
+
+  LayerT<Scalar> &layer = compositor.layers[compositor.count];
+  layer = LayerT<Scalar>();
+  layer.slot.seed = prngStreamSeed(compositor.seed, compositor.count++);
+  layer.type = spec.type;
+  layer.mode = spec.mode;
+  layer.opacity = constrain(Scalar(spec.opacity), Scalar(0), Scalar(1));
+  oscillatorBankReset(layer.slot.oscillators); // The effect sets its slot up on its first frame
+  return true;
+}
+
+// Blend one layer's output onto the stack below it
+template <typename Scalar>
+static void blendLayer(EffectOutputT<Scalar> &out, const EffectOutputT<Scalar> &layer,
+                       const FrameContextT<Scalar> &frame, BlendMode mode, Scalar opacity)
+{
+  const Scalar zero = Scalar(0);
+  const Scalar full = Scalar(255);
+  const Scalar one = Scalar(1);
+
+  switch (mode)
+  {
+  case BLEND_REPLACE:
+    out.r = out.r + (layer.r - out.r) * opacity;
+    out.g = out.g + (layer.g - out.g) * opacity;
+    out.b = out.b + (layer.b - out.b) * opacity;
+    out.level = out.level + (layer.level - out.level) * opacity;
+    break;
+
+  case BLEND_ADD:
+    // What the effect did to the base, added on top of the stack
+    out.r = constrain(out.r + (layer.r - frame.baseR) * opacity, zero, full);
+    out.g = constrain(out.g + (layer.g - frame.baseG) * opacity, zero, full);
+    out.b = constrain(out.b + (layer.b - frame.baseB) * opacity, zero, full);
+    out.level = constrain(out.level + (layer.level - frame.baseLevel) * opacity, zero, full);
+    break;
+
+  case BLEND_MULTIPLY:
+  {
+    const Scalar unit = Scalar(1.0f / 255.0f);
+    out.r = out.r * (one + (layer.r * unit - one) * opacity);
+    out.g = out.g * (one + (layer.g * unit - one) * opacity);
+    out.b = out.b * (one + (layer.b * unit - one) * opacity);
+  }
+  break;
+
+  case BLEND_MODULATE_LEVEL:
+    // Below one level step the ratio means nothing (and overflows Q16.16)
+    if (frame.baseLevel >= one)
+    {
+      Scalar ratio = layer.level / frame.baseLevel;
+      out.level = constrain(out.level * (one + (ratio - one) * opacity), zero, full);
+    }
+    break;
+  }
+}
+
+template <typename Scalar>
+void compositorRender(CompositorT<Scalar> &compositor, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                      EffectOutputT<Scalar> &out)
+{
+  if (compositor.count == 0)
+  {
+    for (size_t i = 0; i < sizeof(LAYERED_DEFAULT_STACK) / sizeof(LAYERED_DEFAULT_STACK[0]); i++)
+    {
+      compositorPush(compositor, LAYERED_DEFAULT_STACK[i]);
+    }
+  }
+
+  out.r = frame.baseR;
+  out.g = frame.baseG;
+  out.b = frame.baseB;
+  out.level = frame.baseLevel;
+
+  for (uint8_t i = 0; i < compositor.count; i++)
+  {
+    LayerT<Scalar> &layer = compositor.layers[i];
+    uint32_t start = cpuCycleCount();
+
+    EffectOutputT<Scalar> layerOut;
+    effectRenderSlot(layer.slot, layer.type, frame, elapsed, layerOut);
+    blendLayer(out, layerOut, frame, layer.mode, layer.opacity);
+
+    uint32_t spent = cpuCycleCount() - start;
+    layer.cost.cycles += spent;
+    layer.cost.worstCycles = max(layer.cost.worstCycles, spent);
+    layer.cost.frames++;
+  }
+}
+
+template <typename Scalar>
+uint32_t compositorFrameInterval(const CompositorT<Scalar> &compositor, unsigned long elapsed)
+{
+  if (compositor.count == 0)
+  {
+    return EFFECT_FRAME_CONTINUOUS; // Loads its stack on the next frame
+  }
+
+  uint32_t interval = EFFECT_FRAME_STATIC;
+  for (uint8_t i = 0; i < compositor.count; i++)
+  {
+    const LayerT<Scalar> &layer = compositor.layers[i];
+    interval = min(interval, effectSlotFrameInterval(layer.slot, layer.type, elapsed));
+  }
+  return interval;
+}
+
+template <typename Scalar>
+void compositorLogCost(CompositorT<Scalar> &compositor)
+{
+  // Called from the LED task: one deferred record per layer, bottom layer
+  // first, with the times in integer hundredths of a microsecond
+  uint64_t cyclesPerUs = getCpuFrequencyMhz();
+  for (uint8_t i = 0; i < compositor.count; i++)
+  {
+    LayerT<Scalar> &layer = compositor.layers[i];
+    uint32_t average =
+        layer.cost.frames == 0 ? 0 : (uint32_t)(layer.cost.cycles * 100 / layer.cost.frames / cyclesPerUs);
+    uint32_t worst = (uint32_t)(layer.cost.worstCycles * 100 / cyclesPerUs);
+    LOG_INFO("Layer %s %s: %u avg, %u worst (0.01 us)\n", effectName(layer.type), blendModeName(layer.mode), average,
+             worst);
+    layer.cost = LayerCost();
+  }
+}
+
+template bool compositorPush<float>(CompositorT<float> &, const LayerSpec &);
+template bool compositorPush<Fix16>(CompositorT<Fix16> &, const LayerSpec &);
+template void compositorRender<float>(CompositorT<float> &, const FrameContextT<float> &, unsigned long,
+                                      EffectOutputT<float> &);
+template void compositorRender<Fix16>(CompositorT<Fix16> &, const FrameContextT<Fix16> &, unsigned long,
+                                      EffectOutputT<Fix16> &);
+template uint32_t compositorFrameInterval<float>(const CompositorT<float> &, unsigned long);
+template uint32_t compositorFrameInterval<Fix16>(const CompositorT<Fix16> &, unsigned long);
+template void compositorLogCost<float>(CompositorT<float> &);
+template void compositorLogCost<Fix16>(CompositorT<Fix16> &);
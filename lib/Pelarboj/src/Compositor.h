@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Effects.h"
+
+// Layered effects: EFFECT_LAYERED evaluates a stack of effects over the Hue
+// base color in one pass. Every layer renders from the base with its own
+// effect state and is blended onto the result of the layers below it, so new
+// combinations are a table of layers rather than new effect code.
+
+const uint32_t LAYER_COST_REPORT_MS = 60000; // Per-layer cost report interval while LAYERED runs
+
+// The stack LAYERED starts with: a fire whose brightness breathes
+const LayerSpec LAYERED_DEFAULT_STACK[] = {
+    {EFFECT_FIREPLACE, BLEND_REPLACE, 1.0f},
+    {EFFECT_BREATHING, BLEND_MODULATE_LEVEL, 0.6f},
+};
+
+// Add a layer on top of the stack. Fails when the stack is full or the effect
+// is a composite.
+template <typename Scalar>
+bool compositorPush(CompositorT<Scalar> &compositor, const LayerSpec &spec);
+
+// Render the stack for one frame (elapsed ms since LAYERED started). Loads
+// LAYERED_DEFAULT_STACK into an empty compositor first. No heap, no recursion:
+// one output record is blended layer by layer.
+template <typename Scalar>
+void compositorRender(CompositorT<Scalar> &compositor, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                      EffectOutputT<Scalar> &out);
+
+// The shortest frame interval any layer asks for
+template <typename Scalar>
+uint32_t compositorFrameInterval(const CompositorT<Scalar> &compositor, unsigned long elapsed);
+
+// Log each layer's average and worst render time since the last report, in
+// hundredths of a microsecond, and start a new report. Never blocks: safe from
+// the LED task.
+template <typename Scalar>
+void compositorLogCost(CompositorT<Scalar> &compositor);
@@ -0,0 +1,256 @@
+#include "EffectVm.h"
+
+#include <string.h>
+
+#include "Log.h"
+#include "StateStore.h"
+
+VmLibrary vmLibrary = {};
+std::atomic<uint8_t> vmSelected(0);
+
+// effects/breathing.pvs: BREATHING as a program, so EFFECT_PROGRAM has
+// something to run before any program is on flash
+static const uint8_t PROGRAM_BUILTIN[] = {
+    0x50, 0x56, 0x4D, 0x01, 0x01, 0x05, 0x10, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x62, 0x72, 0x65, 0x61, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x37, 0x05, 0x00, 0x66, 0x66, 0x00, 0x00,
+    0x9A, 0x99, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00,
+    0x05, 0x07, 0x07, 0x06, 0x01, 0x08, 0x01, 0x00, 0x03, 0x07, 0x07, 0x08,
+    0x05, 0x03, 0x03, 0x07, 0x01, 0x07, 0x02, 0x00, 0x05, 0x07, 0x07, 0x06,
+    0x03, 0x00, 0x00, 0x07, 0x01, 0x07, 0x03, 0x00, 0x05, 0x07, 0x07, 0x06,
+    0x03, 0x01, 0x01, 0x07, 0x01, 0x07, 0x04, 0x00, 0x05, 0x07, 0x07, 0x06,
+    0x04, 0x02, 0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0xA1,
+};
+
+// Names the oscillators show up under in diagnostics
+static const char *const OSCILLATOR_NAMES[MAX_OSCILLATORS] = {"program_0", "program_1", "program_2", "program_3"};
+
+// Which operands of each opcode are registers, so the loader can check them
+enum OperandUse
+{
+  USES_DST = 1,
+  USES_A = 2,
+  USES_B = 4
+};
+
+static const uint8_t OPERAND_USE[VM_OP_COUNT] = {
+    0,                          // HALT
+    USES_DST,                   // LDK
+    USES_DST | USES_A,          // MOV
+    USES_DST | USES_A | USES_B, // ADD
+    USES_DST | USES_A | USES_B, // SUB
+    USES_DST | USES_A | USES_B, // MUL
+    USES_DST | USES_A | USES_B, // DIV
+    USES_DST | USES_A | USES_B, // MIN
+    USES_DST | USES_A | USES_B, // MAX
+    USES_DST | USES_A | USES_B, // CLAMP
+    USES_DST | USES_A | USES_B, // MIX
+    USES_DST | USES_A,          // SIN
+    USES_DST,                   // OSC
+    USES_DST | USES_A | USES_B, // RND
+    USES_DST | USES_A,          // ABS
+    USES_A | USES_B,            // SKIPLT
+    0,                          // JMP
+};
+
+static uint32_t readLe(const uint8_t *data, int bytes)
+{
+  uint32_t value = 0;
+  for (int i = 0; i < bytes; i++)
+  {
+    value |= (uint32_t)data[i] << (8 * i);
+  }
+  return value;
+}
+
+bool vmLoad(const uint8_t *image, size_t length, VmProgram &program)
+{
+  if (length < VM_HEADER_SIZE + 1 || memcmp(image, "PVM", 3) != 0 || image[3] != VM_VERSION)
+  {
+    return false;
+  }
+  uint8_t oscillatorCount = image[4];
+  uint8_t constantCount = image[5];
+  uint16_t codeLength = readLe(image + 6, 2);
+  if (oscillatorCount > MAX_OSCILLATORS || constantCount > VM_MAX_CONSTANTS || codeLength > VM_MAX_CODE ||
+      length != VM_HEADER_SIZE + 4 * (oscillatorCount + constantCount + codeLength) + 1 ||
+      image[length - 1] != crc8(image, length - 1))
+  {
+    return false;
+  }
+
+  memset(&program, 0, sizeof(program));
+  program.frameMs = readLe(image + 8, 2);
+  memcpy(program.name, image + 12, VM_NAME_LENGTH); // The extra byte stays NUL
+  program.oscillatorCount = oscillatorCount;
+  program.constantCount = constantCount;
+  program.codeLength = codeLength;
+
+  const uint8_t *data = image + VM_HEADER_SIZE;
+  for (uint8_t i = 0; i < oscillatorCount; i++, data += 4)
+  {
+    program.oscillatorSteps[i] = readLe(data, 4);
+  }
+  for (uint8_t i = 0; i < constantCount; i++, data += 4)
+  {
+    program.constants[i] = (int32_t)readLe(data, 4);
+  }
+  for (uint16_t pc = 0; pc < codeLength; pc++, data += 4)
+  {
+    VmInstruction &instruction = program.code[pc];
+    instruction = {data[0], data[1], data[2], data[3]};
+    if (instruction.op >= VM_OP_COUNT)
+    {
+      return false;
+    }
+    uint8_t use = OPERAND_USE[instruction.op];
+    if (((use & USES_DST) && instruction.dst >= VM_REGISTERS) || ((use & USES_A) && instruction.a >= VM_REGISTERS) ||
+        ((use & USES_B) && instruction.b >= VM_REGISTERS))
+    {
+      return false;
+    }
+    bool skips = instruction.op == VM_SKIPLT || instruction.op == VM_JMP;
+    if ((instruction.op == VM_LDK && instruction.a >= constantCount) ||
+        (instruction.op == VM_OSC && instruction.a >= oscillatorCount) ||
+        (skips && pc + 1 + instruction.dst > codeLength))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void vmRegisterOscillators(const VmProgram &program, OscillatorBank &bank)
+{
+  for (uint8_t i = 0; i < program.oscillatorCount; i++)
+  {
+    oscillatorRegister(bank, OSCILLATOR_NAMES[i], program.oscillatorSteps[i]);
+  }
+}
+
+// Binary angle of a raw Q16.16 angle in radians
+static Phase radiansToPhase(int32_t raw)
+{
+  return (Phase)(((int64_t)raw * (int64_t)(PHASE_UNITS_PER_RADIAN + 0.5)) >> 16);
+}
+
+// Wrapping arithmetic on raw values: an overflow is the program's problem,
+// never undefined behaviour
+static int32_t rawAdd(int32_t a, int32_t b)
+{
+  return (int32_t)((uint32_t)a + (uint32_t)b);
+}
+
+static int32_t rawSub(int32_t a, int32_t b)
+{
+  return (int32_t)((uint32_t)a - (uint32_t)b);
+}
+
+static int32_t rawMul(int32_t a, int32_t b)
+{
+  return (Fix16::fromRaw(a) * Fix16::fromRaw(b)).raw;
+}
+
+uint32_t vmRun(const VmProgram &program, int32_t *registers, const OscillatorBank &bank, Prng &random)
+{
+  int32_t *r = registers;
+  uint32_t executed = 0;
+  uint16_t pc = 0;
+  while (pc < program.codeLength)
+  {
+    const VmInstruction &in = program.code[pc++];
+    executed++;
+    switch (in.op)
+    {
+    case VM_HALT:
+      return executed;
+    case VM_LDK:
+      r[in.dst] = program.constants[in.a];
+      break;
+    case VM_MOV:
+      r[in.dst] = r[in.a];
+      break;
+    case VM_ADD:
+      r[in.dst] = rawAdd(r[in.a], r[in.b]);
+      break;
+    case VM_SUB:
+      r[in.dst] = rawSub(r[in.a], r[in.b]);
+      break;
+    case VM_MUL:
+      r[in.dst] = rawMul(r[in.a], r[in.b]);
+      break;
+    case VM_DIV:
+      r[in.dst] = (Fix16::fromRaw(r[in.a]) / Fix16::fromRaw(r[in.b])).raw;
+      break;
+    case VM_MIN:
+      r[in.dst] = min(r[in.a], r[in.b]);
+      break;
+    case VM_MAX:
+      r[in.dst] = max(r[in.a], r[in.b]);
+      break;
+    case VM_CLAMP:
+      r[in.dst] = constrain(r[in.dst], r[in.a], r[in.b]);
+      break;
+    case VM_MIX:
+      r[in.dst] = rawAdd(r[in.a], rawMul(rawSub(r[in.b], r[in.a]), r[in.dst]));
+      break;
+    case VM_SIN:
+      r[in.dst] = sineRaw(radiansToPhase(r[in.a]));
+      break;
+    case VM_OSC:
+      r[in.dst] = sineRaw(bank.oscillators[in.a].phase);
+      break;
+    case VM_RND:
+      r[in.dst] = rawAdd(r[in.a], rawMul(rawSub(r[in.b], r[in.a]), (int32_t)(prngNext(random) >> 16)));
+      break;
+    case VM_ABS:
+      r[in.dst] = r[in.a] < 0 ? rawSub(0, r[in.a]) : r[in.a];
+      break;
+    case VM_SKIPLT:
+      if (r[in.a] < r[in.b])
+      {
+        pc += in.dst;
+      }
+      break;
+    case VM_JMP:
+      pc += in.dst;
+      break;
+    }
+  }
+  return executed;
+}
+
+bool vmLibraryAdd(VmLibrary &library, const uint8_t *image, size_t length)
+{
+  uint8_t count = library.count.load(std::memory_order_relaxed);
+  if (count >= VM_MAX_PROGRAMS || !vmLoad(image, length, library.programs[count]))
+  {
+    return false;
+  }
+  library.count.store(count + 1, std::memory_order_release);
+  return true;
+}
+
+uint8_t vmProgramCount()
+{
+  return 1 + vmLibrary.count.load(std::memory_order_acquire);
+}
+
+const VmProgram &vmProgram(uint8_t index)
+{
+  static VmProgram builtin;
+  static bool builtinLoaded = vmLoad(PROGRAM_BUILTIN, sizeof(PROGRAM_BUILTIN), builtin);
+  (void)builtinLoaded;
+  return index >= 1 && index <= vmLibrary.count.load(std::memory_order_acquire) ? vmLibrary.programs[index - 1]
+                                                                                   : builtin;
+}
+
+const VmProgram &vmSelectNext()
+{
+  uint8_t next = (vmSelected.load(std::memory_order_relaxed) + 1) % vmProgramCount();
+  vmSelected.store(next, std::memory_order_relaxed);
+  const VmProgram &program = vmProgram(next);
+  LOG_INFO("Effect program %d: %s\n", (int)next, program.name);
+  return program;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Oscillator.h"
+#include "Prng.h"
+
+// Effect programs: a small register-based bytecode interpreter, so effects can
+// be written and tuned without reflashing. Programs are assembled on the host
+// (tools/pvm_asm.py), copied to /effects on the LittleFS partition and picked
+// at runtime; EFFECT_PROGRAM runs the selected one. The interpreter computes
+// in Q16.16 on both engines.
+//
+// Registers hold Q16.16 values:
+//   r0-r3   base red, green, blue and level (0-255) in; the effect's output
+//           (clamped to 0-255) when the program ends
+//   r4      time since the effect started (s, wraps every 32768 s)
+//   r5      time since the previous frame (s)
+//   r6-r11  scratch, zero at the start of every frame
+//   r12-r15 kept between frames, zero when the program starts
+//
+// Jumps only go forward, so a frame executes every instruction at most once:
+// the cost is bounded by the program length (VM_MAX_CODE).
+//
+// Image: "PVM", version, oscillator count, constant count, code length
+// (u16 LE), frame interval in ms (u16 LE, 0 = every frame), 2 reserved bytes,
+// name (16 bytes, NUL padded), oscillator steps (phase per ms, u32 LE each),
+// constants (raw Q16.16, i32 LE each), code (4 bytes per instruction), CRC-8.
+
+enum VmOp
+{
+  VM_HALT = 0,    // End the frame
+  VM_LDK = 1,     // dst = constants[a]
+  VM_MOV = 2,     // dst = a
+  VM_ADD = 3,     // dst = a + b
+  VM_SUB = 4,     // dst = a - b
+  VM_MUL = 5,     // dst = a * b
+  VM_DIV = 6,     // dst = a / b (0 when b is 0)
+  VM_MIN = 7,     // dst = min(a, b)
+  VM_MAX = 8,     // dst = max(a, b)
+  VM_CLAMP = 9,   // dst = constrain(dst, a, b)
+  VM_MIX = 10,    // dst = a + (b - a) * dst
+  VM_SIN = 11,    // dst = sin(a), a in radians
+  VM_OSC = 12,    // dst = oscillator a (-1.0-1.0)
+  VM_RND = 13,    // dst = uniform random in [a, b)
+  VM_ABS = 14,    // dst = |a|
+  VM_SKIPLT = 15, // Skip the next dst instructions if a < b
+  VM_JMP = 16,    // Skip the next dst instructions
+  VM_OP_COUNT = 17
+};
+
+const uint8_t VM_REGISTERS = 16;
+const uint8_t VM_INPUT_REGISTERS = 6;                                   // r0-r5 are loaded every frame
+const uint8_t VM_FIRST_PERSISTENT = 12;                                 // r12-r15 survive the frame
+const uint8_t VM_PERSISTENT_REGISTERS = VM_REGISTERS - VM_FIRST_PERSISTENT;
+const uint8_t VM_MAX_CONSTANTS = 16;
+const uint16_t VM_MAX_CODE = 64;                                        // Instructions, and so the most one frame executes
+const uint8_t VM_NAME_LENGTH = 16;
+const uint8_t VM_MAX_PROGRAMS = 4;                                      // Loaded from flash, besides the built-in one
+const uint8_t VM_VERSION = 1;
+const size_t VM_HEADER_SIZE = 28;
+const size_t VM_MAX_IMAGE = VM_HEADER_SIZE + 4 * (MAX_OSCILLATORS + VM_MAX_CONSTANTS + VM_MAX_CODE) + 1;
+
+struct VmInstruction
+{
+  uint8_t op;
+  uint8_t dst; // Destination register, or the skip count of SKIPLT and JMP
+  uint8_t a;   // Register, or the constant/oscillator index of LDK/OSC
+  uint8_t b;
+};
+
+// A validated program, ready to run
+struct VmProgram
+{
+  char name[VM_NAME_LENGTH + 1];
+  uint16_t frameMs; // Frame interval the program asks for, 0 for every frame
+  uint8_t oscillatorCount;
+  uint8_t constantCount;
+  uint16_t codeLength;
+  Phase oscillatorSteps[MAX_OSCILLATORS]; // Phase advance per ms
+  int32_t constants[VM_MAX_CONSTANTS];    // Raw Q16.16
+  VmInstruction code[VM_MAX_CODE];
+};
+
+// EFFECT_PROGRAM's slot state
+struct ProgramState
+{
+  uint8_t program;                             // Running program + 1, 0 before the first frame
+  int32_t registers[VM_PERSISTENT_REGISTERS]; // r12-r15 between frames
+};
+
+// Parse and check an image: header, sizes, CRC, and every operand in range.
+// False when anything is off - a program that loads always runs safely.
+bool vmLoad(const uint8_t *image, size_t length, VmProgram &program);
+
+// Register the program's oscillators in bank, in declaration order
+void vmRegisterOscillators(const VmProgram &program, OscillatorBank &bank);
+
+// Run one frame over registers (raw Q16.16, VM_REGISTERS of them) with the
+// oscillators seeked to the frame time; RND draws from random. Returns the
+// instructions executed.
+uint32_t vmRun(const VmProgram &program, int32_t *registers, const OscillatorBank &bank, Prng &random);
+
+// Programs available to EFFECT_PROGRAM. Index 0 is the built-in program, the
+// ones loaded from flash follow. Filled at boot while the LED task already
+// runs: a program is complete before the count that covers it is published,
+// and never changes afterwards.
+struct VmLibrary
+{
+  VmProgram programs[VM_MAX_PROGRAMS];
+  std::atomic<uint8_t> count;
+};
+
+extern VmLibrary vmLibrary;
+extern std::atomic<uint8_t> vmSelected; // Program EFFECT_PROGRAM runs
+
+// Add a program image to the library. False when it does not load or the
+// library is full. One writer at a time.
+bool vmLibraryAdd(VmLibrary &library, const uint8_t *image, size_t length);
+
+uint8_t vmProgramCount();
+
+// Program by index; out of range falls back to the built-in one
+const VmProgram &vmProgram(uint8_t index);
+
+// Select the next program, wrapping around, and return it
+const VmProgram &vmSelectNext();
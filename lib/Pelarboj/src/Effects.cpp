@@ -0,0 +1,925 @@
+#include "Effects.h"
+
+#include <string.h>
+
+#include "Compositor.h"
+#include "Keyframes.h"
+#include "Log.h"
+
+void hueToRGB(uint16_t hue, uint8_t brightness, uint32_t &R, uint32_t &G, uint32_t &B)
+{
+  HsvColor color = {hue, 255, brightness};
+  uint8_t r, g, b;
+  hsvToRgb(color, r, g, b);
+  R = r;
+  G = g;
+  B = b;
+}
+
+EffectState effectState = {
+    EFFECT_COLOR_WANDER, // Start with color wander effect
+    0,                   // Will be set when effect starts
+    0,                   // Run seed, drawn from the hardware RNG at startup
+                         // Effect slot and auto-cycle state start zeroed
+};
+
+// Oscillator slots, in the order each effect registers them
+enum WanderOscillator
+{
+  WANDER_R,
+  WANDER_G,
+  WANDER_B
+};
+
+enum FlameOscillator
+{
+  FLAME_MAIN,
+  FLAME_SECONDARY,
+  FLAME_EMBER
+};
+
+const uint8_t SINGLE_OSCILLATOR = 0; // LEVEL_PULSE, RAINBOW and BREATHING use one
+
+// PROGRAM's time register wraps before it leaves the Q16.16 range
+const unsigned long PROGRAM_TIME_WRAP_MS = 32768UL * 1000;
+
+// COMBO's level pulse runs much slower than LEVEL_PULSE's; it is sampled directly
+const Phase COMBO_PULSE_STEP_PER_MS = phaseStep(LEVEL_PULSE_SPEED * 0.001f);
+
+// Event rolls are drawn as per-mille integers
+const long ELECTRICITY_BLACKOUT_ROLL = (long)(ELECTRICITY_BLACKOUT_CHANCE * 1000.0f + 0.5f);
+const long ELECTRICITY_SURGE_ROLL = ELECTRICITY_BLACKOUT_ROLL + (long)(ELECTRICITY_SURGE_CHANCE * 1000.0f + 0.5f);
+const long ELECTRICITY_FLICKER_ROLL = ELECTRICITY_SURGE_ROLL + (long)(ELECTRICITY_FLICKER_CHANCE * 1000.0f + 0.5f);
+
+static unsigned long electricityStableTime(Prng &random)
+{
+  return ELECTRICITY_STABLE_MIN_MS + prngRange(random, 0, 1001) * (ELECTRICITY_STABLE_MAX_MS - ELECTRICITY_STABLE_MIN_MS) / 1000;
+}
+
+static unsigned long autoCycleDuration(Prng &random)
+{
+  return AUTO_CYCLE_MIN_TIME_MS + prngRange(random, 0, 1001) * (AUTO_CYCLE_MAX_TIME_MS - AUTO_CYCLE_MIN_TIME_MS) / 1000;
+}
+
+// Oscillator step per ms for a speed in radians per EFFECT_SPEED_REFERENCE_MS
+static constexpr Phase speedStep(float radiansPerReference)
+{
+  return phaseStep(radiansPerReference / EFFECT_SPEED_REFERENCE_MS);
+}
+
+// Time from elapsed until a scheduled event at eventTime (0 when already due)
+static uint32_t timeUntil(unsigned long eventTime, unsigned long elapsed)
+{
+  return eventTime > elapsed ? eventTime - elapsed : 0;
+}
+
+// ---------------------------------------------------------------------------
+// Oscillator registration, run whenever an effect (re)starts in a slot
+
+static void registerWanderOscillators(OscillatorBank &bank)
+{
+  // Different speeds per channel for organic movement
+  oscillatorRegister(bank, "wander_r", speedStep(COLOR_WANDER_SPEED * 1.0f));
+  oscillatorRegister(bank, "wander_g", speedStep(COLOR_WANDER_SPEED * 1.3f));
+  oscillatorRegister(bank, "wander_b", speedStep(COLOR_WANDER_SPEED * 0.7f));
+}
+
+static void registerPulseOscillators(OscillatorBank &bank)
+{
+  oscillatorRegister(bank, "pulse", speedStep(LEVEL_PULSE_SPEED));
+}
+
+static void registerFlameOscillators(OscillatorBank &bank)
+{
+  oscillatorRegister(bank, "flame_main", speedStep(FIREPLACE_FLICKER_SPEED * 1.0f));
+  oscillatorRegister(bank, "flame_secondary", speedStep(FIREPLACE_FLICKER_SPEED * 1.7f));
+  oscillatorRegister(bank, "ember", speedStep(FIREPLACE_FLICKER_SPEED * 0.6f));
+}
+
+static void registerRainbowOscillators(OscillatorBank &bank)
+{
+  oscillatorRegister(bank, "hue_sweep", speedStep(RAINBOW_CYCLE_SPEED));
+}
+
+static void registerBreathingOscillators(OscillatorBank &bank)
+{
+  oscillatorRegister(bank, "breath", speedStep(BREATHING_SPEED));
+}
+
+// ---------------------------------------------------------------------------
+// Effects. Each renders from its own slot and the frame; elapsed is the time
+// since the effect started. Output starts from the base values and effects
+// override what they change.
+
+template <typename Scalar>
+static void renderNone(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                       EffectOutputT<Scalar> &out)
+{
+  // No effects - final = base
+}
+
+// Smooth wandering offsets from sine waves, applied to the base color
+template <typename Scalar>
+static void wanderColor(const EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, EffectOutputT<Scalar> &out)
+{
+  const Scalar zero = Scalar(0);
+  const Scalar full = Scalar(255);
+  Scalar offsetR = oscillatorSample<Scalar>(slot.oscillators, WANDER_R) * Scalar(COLOR_WANDER_RANGE);
+  Scalar offsetG = oscillatorSample<Scalar>(slot.oscillators, WANDER_G) * Scalar(COLOR_WANDER_RANGE);
+  Scalar offsetB = oscillatorSample<Scalar>(slot.oscillators, WANDER_B) * Scalar(COLOR_WANDER_RANGE);
+
+  out.r = constrain(frame.baseR + offsetR, zero, full);
+  out.g = constrain(frame.baseG + offsetG, zero, full);
+  out.b = constrain(frame.baseB + offsetB, zero, full);
+}
+
+template <typename Scalar>
+static void renderColorWander(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                              EffectOutputT<Scalar> &out)
+{
+  wanderColor(slot, frame, out);
+}
+
+template <typename Scalar>
+static void renderLevelPulse(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                             EffectOutputT<Scalar> &out)
+{
+  // Generate smooth pulsation using sine wave
+  Scalar pulseMultiplier = Scalar(1) + oscillatorSample<Scalar>(slot.oscillators, SINGLE_OSCILLATOR) * Scalar(LEVEL_PULSE_RANGE);
+
+  // Apply pulsation to level
+  out.level = constrain(frame.baseLevel * pulseMultiplier, Scalar(0), Scalar(255));
+}
+
+template <typename Scalar>
+static void renderCombo(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                        EffectOutputT<Scalar> &out)
+{
+  // Combine color wandering and level pulsation
+  wanderColor(slot, frame, out);
+
+  // Add level pulsation from a time-based phase
+  Phase pulsePhase = (Phase)elapsed * COMBO_PULSE_STEP_PER_MS;
+  Scalar pulseMultiplier = Scalar(1) + sineLookup<Scalar>(pulsePhase) * Scalar(LEVEL_PULSE_RANGE);
+
+  // Apply pulsation to level
+  out.level = constrain(frame.baseLevel * pulseMultiplier, Scalar(0), Scalar(255));
+}
+
+// Random scene target around a base value. The draw happens once up front:
+// constrain() is a macro and would otherwise draw up to three times.
+template <typename Scalar>
+static Scalar sceneVariation(Prng &random, Scalar base, Scalar low)
+{
+  Scalar varied = base + Scalar(prngRange(random, -50, 51));
+  return constrain(varied, low, Scalar(255));
+}
+
+// Next scene: random target around the base color plus hold and transition times
+template <typename Scalar>
+static void startSceneTransition(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame)
+{
+  SceneChangeStateT<Scalar> &scene = slot.data.sceneChange;
+
+  // Generate target based on base color variations
+  scene.targetR = sceneVariation(slot.random, frame.baseR, Scalar(0));
+  scene.targetG = sceneVariation(slot.random, frame.baseG, Scalar(0));
+  scene.targetB = sceneVariation(slot.random, frame.baseB, Scalar(0));
+  scene.targetLevel = sceneVariation(slot.random, frame.baseLevel, Scalar(50));
+
+  scene.holdTime = prngRange(slot.random, 5000, 10000);      // 5-10 seconds hold
+  scene.transitionTime = prngRange(slot.random, 1000, 2000); // 1-2 seconds transition
+  scene.transitioning = true;
+
+  LOG_INFO("Scene change: New target R=%d G=%d B=%d L=%d\n", (int)scalarToInt(scene.targetR),
+           (int)scalarToInt(scene.targetG), (int)scalarToInt(scene.targetB), (int)scalarToInt(scene.targetLevel));
+}
+
+// Transition complete: the target becomes the scene held
+template <typename Scalar>
+static void holdSceneTarget(SceneChangeStateT<Scalar> &scene)
+{
+  scene.currentR = scene.targetR;
+  scene.currentG = scene.targetG;
+  scene.currentB = scene.targetB;
+  scene.currentLevel = scene.targetLevel;
+  scene.transitioning = false;
+}
+
+template <typename Scalar>
+static void renderSceneChange(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                              EffectOutputT<Scalar> &out)
+{
+  SceneChangeStateT<Scalar> &scene = slot.data.sceneChange;
+
+  // Initialize scene change if needed
+  if (scene.transitionTime == 0)
+  {
+    // Start with current base values
+    scene.currentR = frame.baseR;
+    scene.currentG = frame.baseG;
+    scene.currentB = frame.baseB;
+    scene.currentLevel = frame.baseLevel;
+
+    startSceneTransition(slot, frame);
+    scene.changeTime = elapsed;
+  }
+  else if (elapsed - scene.changeTime > EFFECT_MAX_CATCH_UP_MS)
+  {
+    // Back from a long gap - hold the scene we were heading for from now on
+    holdSceneTarget(scene);
+    scene.changeTime = elapsed;
+  }
+
+  // Step through every phase that ended by this frame. Phases end on their
+  // schedule, not on the frame that notices, so the frame rate never shifts them.
+  while (true)
+  {
+    unsigned long phaseLength = scene.transitioning ? scene.transitionTime : scene.holdTime;
+    if (elapsed - scene.changeTime < phaseLength)
+    {
+      break;
+    }
+    scene.changeTime += phaseLength;
+
+    if (scene.transitioning)
+    {
+      // Transition complete - switch to hold phase (5-10 seconds)
+      holdSceneTarget(scene);
+    }
+    else
+    {
+      // Hold complete - start interpolating toward a new target
+      startSceneTransition(slot, frame);
+    }
+  }
+
+  out.r = scene.currentR;
+  out.g = scene.currentG;
+  out.b = scene.currentB;
+  out.level = scene.currentLevel;
+
+  if (scene.transitioning)
+  {
+    // Transition phase (1-2 seconds): how far toward the target is a function
+    // of the time into the transition
+    Scalar progress = scalarRatio<Scalar>(elapsed - scene.changeTime, scene.transitionTime);
+    Scalar smoothProgress = progress * progress * (Scalar(3) - Scalar(2) * progress); // Smoothstep
+
+    out.r = scene.currentR + (scene.targetR - scene.currentR) * smoothProgress;
+    out.g = scene.currentG + (scene.targetG - scene.currentG) * smoothProgress;
+    out.b = scene.currentB + (scene.targetB - scene.currentB) * smoothProgress;
+    out.level = scene.currentLevel + (scene.targetLevel - scene.currentLevel) * smoothProgress;
+  }
+}
+
+template <typename Scalar>
+static void renderFireplace(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                            EffectOutputT<Scalar> &out)
+{
+  const Scalar zero = Scalar(0);
+  const Scalar full = Scalar(255);
+
+  // Simulate realistic fireplace flickering with warm colors
+  // Main flicker, secondary flicker and slow ember glow
+
+  // Generate multiple sine waves for realistic flame behavior
+  Scalar mainFlicker = oscillatorSample<Scalar>(slot.oscillators, FLAME_MAIN);
+  Scalar secondaryFlicker = oscillatorSample<Scalar>(slot.oscillators, FLAME_SECONDARY) * Scalar(0.4f);
+  Scalar emberGlow = oscillatorSample<Scalar>(slot.oscillators, FLAME_EMBER) * Scalar(0.2f);
+
+  // Combine flickers with bias toward brighter flames
+  Scalar totalFlicker = (mainFlicker + secondaryFlicker + emberGlow + Scalar(1.5f)) * Scalar(1.0f / 3.5f);
+  totalFlicker = constrain(totalFlicker, zero, Scalar(1));
+
+  // Create subtle warm fire colors closer to base
+  Scalar fireRed = frame.baseR * Scalar(FIREPLACE_RED_BOOST);
+  Scalar fireGreen = frame.baseG * (Scalar(0.9f) + Scalar(FIREPLACE_ORANGE_MIX) * totalFlicker); // Subtle orange tint
+  Scalar fireBlue = frame.baseB * Scalar(0.8f);                                                // Slightly reduce blue for warmth
+
+  // Apply intensity variations for flickering (reduced range)
+  Scalar intensity = Scalar(1) - (Scalar(FIREPLACE_INTENSITY_RANGE) * (Scalar(1) - totalFlicker));
+
+  // Constrain colors to valid range
+  out.r = constrain(fireRed, zero, full);
+  out.g = constrain(fireGreen, zero, full);
+  out.b = constrain(fireBlue, zero, full);
+  out.level = constrain(frame.baseLevel * intensity, frame.baseLevel * Scalar(0.7f), frame.baseLevel);
+}
+
+template <typename Scalar>
+static void renderRainbow(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                          EffectOutputT<Scalar> &out)
+{
+  const Scalar zero = Scalar(0);
+  const Scalar full = Scalar(255);
+  const Scalar baseR = frame.baseR, baseG = frame.baseG, baseB = frame.baseB;
+
+  // Smooth rainbow color cycling around the hue of the color the base is
+  // heading to, taken (as integer HSV) only when that changes. The targets are
+  // integers, so both engines sweep around the same hue whatever their bases.
+  RainbowStateT<Scalar> &rainbow = slot.data.rainbow;
+  const WorkingColor &target = frame.target;
+  if (!rainbow.valid || target.r != rainbow.key.r || target.g != rainbow.key.g || target.b != rainbow.key.b)
+  {
+    rainbow.base = rgbToHsv(target.r / 257, target.g / 257, target.b / 257);
+    rainbow.key = target;
+    rainbow.valid = true;
+  }
+
+  // Cycle hue around base color (±120 degrees for variety while staying related),
+  // wrapping around red
+  Scalar sweep = oscillatorSample<Scalar>(slot.oscillators, SINGLE_OSCILLATOR); // -1 to +1
+  int32_t hueOffset = (int32_t)(((int64_t)scalarToRaw(sweep) * (HSV_HUE_TURN / 3)) >> 16);
+  HsvColor swept = {(uint16_t)(rainbow.base.hue + hueOffset), RAINBOW_SATURATION, rainbow.base.value};
+  uint8_t rainbowR, rainbowG, rainbowB;
+  hsvToRgb(swept, rainbowR, rainbowG, rainbowB);
+
+  // Blend with base color to maintain base characteristics
+  const Scalar blendFactor = Scalar(0.08f); // 8% rainbow, 92% base color
+  Scalar blendR = Scalar(rainbowR) * blendFactor + baseR * (Scalar(1) - blendFactor);
+  Scalar blendG = Scalar(rainbowG) * blendFactor + baseG * (Scalar(1) - blendFactor);
+  Scalar blendB = Scalar(rainbowB) * blendFactor + baseB * (Scalar(1) - blendFactor);
+
+  // Constrain to valid range; the level stays the base level
+  out.r = constrain(blendR, zero, full);
+  out.g = constrain(blendG, zero, full);
+  out.b = constrain(blendB, zero, full);
+}
+
+template <typename Scalar>
+static void renderColorSteps(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                             EffectOutputT<Scalar> &out)
+{
+  const Scalar zero = Scalar(0);
+  const Scalar full = Scalar(255);
+  ColorStepsStateT<Scalar> &steps = slot.data.colorSteps;
+
+  // Rapid color steps - like color wander but with sudden jumps at intervals.
+  // Steps sit on a fixed COLOR_STEPS_INTERVAL_MS grid.
+  if (elapsed >= steps.nextStep)
+  {
+    // Time for a new color step
+    steps.nextStep = (elapsed / COLOR_STEPS_INTERVAL_MS + 1) * COLOR_STEPS_INTERVAL_MS;
+
+    // Generate new random offsets for each channel, similar to color wander but larger range
+    Scalar offsetR = scalarRatio<Scalar>(prngRange(slot.random, -1000, 1001), 1000) * Scalar(COLOR_STEPS_RANGE); // -30 to +30
+    Scalar offsetG = scalarRatio<Scalar>(prngRange(slot.random, -1000, 1001), 1000) * Scalar(COLOR_STEPS_RANGE); // -30 to +30
+    Scalar offsetB = scalarRatio<Scalar>(prngRange(slot.random, -1000, 1001), 1000) * Scalar(COLOR_STEPS_RANGE); // -30 to +30
+
+    steps.r = constrain(frame.baseR + offsetR, zero, full);
+    steps.g = constrain(frame.baseG + offsetG, zero, full);
+    steps.b = constrain(frame.baseB + offsetB, zero, full);
+  }
+
+  // Apply the current step values (instant change - no interpolation)
+  out.r = steps.r;
+  out.g = steps.g;
+  out.b = steps.b;
+}
+
+// Stable stretch at the base color
+template <typename Scalar>
+static void electricityStable(ElectricityStateT<Scalar> &electricity, Prng &random,
+                              const FrameContextT<Scalar> &frame)
+{
+  electricity.inEvent = false;
+  electricity.r = frame.baseR;
+  electricity.g = frame.baseG;
+  electricity.b = frame.baseB;
+  electricity.level = frame.baseLevel;
+  electricity.duration = electricityStableTime(random);
+}
+
+template <typename Scalar>
+static void renderBrokenElectricity(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame,
+                                    unsigned long elapsed, EffectOutputT<Scalar> &out)
+{
+  const Scalar zero = Scalar(0);
+  const Scalar full = Scalar(255);
+  const Scalar baseR = frame.baseR, baseG = frame.baseG, baseB = frame.baseB, baseLevel = frame.baseLevel;
+  ElectricityStateT<Scalar> &electricity = slot.data.electricity;
+
+  // Horror movie broken electricity - mostly stable with rare dramatic flickers
+
+  // Start stable the first time, and after a long gap resume stable from now on
+  if (electricity.duration == 0 || elapsed - electricity.changeTime > EFFECT_MAX_CATCH_UP_MS)
+  {
+    electricityStable(electricity, slot.random, frame);
+    electricity.changeTime = elapsed;
+  }
+
+  // Handle every state change due by this frame, on its scheduled time
+  while (elapsed - electricity.changeTime >= electricity.duration)
+  {
+    electricity.changeTime += electricity.duration;
+
+    if (!electricity.inEvent) // Stable state - time for the next event
+    {
+      // Time for an electrical event - roll for type
+      long eventRoll = prngRange(slot.random, 0, 1001);
+      electricity.inEvent = true; // Switch to event state
+
+      if (eventRoll < ELECTRICITY_BLACKOUT_ROLL)
+      {
+        // Complete blackout
+        electricity.r = zero;
+        electricity.g = zero;
+        electricity.b = zero;
+        electricity.level = zero;
+        electricity.duration = ELECTRICITY_BLACKOUT_DURATION_MS;
+      }
+      else if (eventRoll < ELECTRICITY_SURGE_ROLL)
+      {
+        // Bright surge
+        electricity.r = min(full, baseR * Scalar(ELECTRICITY_SURGE_MULTIPLIER));
+        electricity.g = min(full, baseG * Scalar(ELECTRICITY_SURGE_MULTIPLIER));
+        electricity.b = min(full, baseB * Scalar(ELECTRICITY_SURGE_MULTIPLIER));
+        electricity.level = min(full, baseLevel * Scalar(ELECTRICITY_SURGE_MULTIPLIER));
+        electricity.duration = ELECTRICITY_SURGE_DURATION_MS;
+      }
+      else if (eventRoll < ELECTRICITY_FLICKER_ROLL)
+      {
+        // Quick flicker
+        Scalar variation = Scalar(0.4f) + scalarRatio<Scalar>(prngRange(slot.random, 0, 601), 1000);
+        electricity.r = baseR * variation;
+        electricity.g = baseG * variation;
+        electricity.b = baseB * variation;
+        electricity.level = baseLevel * variation;
+        electricity.duration = ELECTRICITY_FLICKER_MIN_MS + prngRange(slot.random, 0, 101);
+      }
+      else
+      {
+        // No event this time - stay stable
+        electricity.inEvent = false;
+        electricity.duration = electricityStableTime(slot.random);
+      }
+    }
+    else // In event state - duration over, return to stable
+    {
+      electricityStable(electricity, slot.random, frame);
+    }
+  }
+
+  // Apply current electrical state
+  out.r = electricity.r;
+  out.g = electricity.g;
+  out.b = electricity.b;
+  out.level = electricity.level;
+}
+
+template <typename Scalar>
+static void renderBreathing(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                            EffectOutputT<Scalar> &out)
+{
+  const Scalar zero = Scalar(0);
+  const Scalar full = Scalar(255);
+
+  // Slow organic breathing effect - like the light is alive and sleeping
+  // Breathing phase moves very slowly for calm, meditative rhythm
+
+  // Create breathing curve using sine wave - smooth inhale and exhale
+  Scalar breathingCycle = oscillatorSample<Scalar>(slot.oscillators, SINGLE_OSCILLATOR);
+
+  // Map breathing cycle to brightness range (20% to 100% of base level)
+  Scalar breathingMultiplier = Scalar(BREATHING_MIN_LEVEL) +
+                               Scalar(BREATHING_MAX_LEVEL - BREATHING_MIN_LEVEL) * (breathingCycle * Scalar(0.5f) + Scalar(0.5f));
+
+  // Apply breathing to brightness level
+  out.level = constrain(frame.baseLevel * breathingMultiplier, zero, full);
+
+  // Add subtle color warmth variation synchronized with breathing
+  // Warmer (more red/yellow) on exhale, cooler (more blue) on inhale
+  Scalar colorVariation = breathingCycle * Scalar(BREATHING_COLOR_VARIATION);
+
+  // Slightly increase red/decrease blue on exhale for warmth
+  out.r = constrain(frame.baseR + colorVariation * Scalar(0.6f), zero, full);
+  out.g = constrain(frame.baseG + colorVariation * Scalar(0.3f), zero, full);
+  out.b = constrain(frame.baseB - colorVariation * Scalar(0.4f), zero, full);
+}
+
+// Run the selected effect program (EffectVm.h). A program switch restarts it
+// in place: its own oscillators from phase 0 and cleared registers.
+template <typename Scalar>
+static void renderProgram(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                          EffectOutputT<Scalar> &out)
+{
+  const Scalar zero = Scalar(0);
+  const Scalar full = Scalar(255);
+
+  uint8_t selected = vmSelected.load(std::memory_order_relaxed);
+  selected = selected < vmProgramCount() ? selected : 0;
+  const VmProgram &program = vmProgram(selected);
+  ProgramState &state = slot.data.program;
+  if (state.program != selected + 1)
+  {
+    OscillatorBank &bank = slot.oscillators;
+    oscillatorBankReset(bank);
+    bank.epoch = elapsed;
+    vmRegisterOscillators(program, bank);
+    bank.owner = EFFECT_PROGRAM;
+    oscillatorBankSeek(bank, elapsed);
+    state = ProgramState();
+    state.program = selected + 1;
+  }
+
+  int32_t registers[VM_REGISTERS] = {};
+  registers[0] = scalarToRaw(frame.baseR);
+  registers[1] = scalarToRaw(frame.baseG);
+  registers[2] = scalarToRaw(frame.baseB);
+  registers[3] = scalarToRaw(frame.baseLevel);
+  registers[4] = scalarRatio<Fix16>(elapsed % PROGRAM_TIME_WRAP_MS, 1000).raw;
+  registers[5] = scalarRatio<Fix16>(frame.dt, 1000).raw;
+  memcpy(registers + VM_FIRST_PERSISTENT, state.registers, sizeof(state.registers));
+
+  vmRun(program, registers, slot.oscillators, slot.random);
+
+  memcpy(state.registers, registers + VM_FIRST_PERSISTENT, sizeof(state.registers));
+  out.r = constrain(scalarFromRaw<Scalar>(registers[0]), zero, full);
+  out.g = constrain(scalarFromRaw<Scalar>(registers[1]), zero, full);
+  out.b = constrain(scalarFromRaw<Scalar>(registers[2]), zero, full);
+  out.level = constrain(scalarFromRaw<Scalar>(registers[3]), zero, full);
+}
+
+// Play the mapped keyframe track (Keyframes.h): its colors, with its level
+// scaled by the base level. Shows the base while no track is mapped.
+template <typename Scalar>
+static void renderKeyframes(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                            EffectOutputT<Scalar> &out)
+{
+  const KeyframeTrack *track = keyframeActive.load(std::memory_order_acquire);
+  if (track == nullptr)
+  {
+    return;
+  }
+  EffectOutputT<Scalar> key;
+  keyframeSample(*track, keyframeTrackTime(*track, elapsed), key);
+  out.r = key.r;
+  out.g = key.g;
+  out.b = key.b;
+  out.level = key.level / Scalar(255) * frame.baseLevel;
+}
+
+// ---------------------------------------------------------------------------
+// Frame intervals
+
+template <typename Scalar, uint32_t FRAME_MS>
+static uint32_t fixedFrameInterval(const EffectSlotT<Scalar> &slot, unsigned long elapsed)
+{
+  return FRAME_MS;
+}
+
+template <typename Scalar>
+static uint32_t sceneChangeFrameInterval(const EffectSlotT<Scalar> &slot, unsigned long elapsed)
+{
+  const SceneChangeStateT<Scalar> &scene = slot.data.sceneChange;
+  if (scene.transitionTime == 0 || scene.transitioning)
+  {
+    return EFFECT_FRAME_CONTINUOUS;
+  }
+  // Holding: nothing moves until the hold ends
+  return timeUntil(scene.changeTime + scene.holdTime, elapsed);
+}
+
+template <typename Scalar>
+static uint32_t colorStepsFrameInterval(const EffectSlotT<Scalar> &slot, unsigned long elapsed)
+{
+  return timeUntil(slot.data.colorSteps.nextStep, elapsed);
+}
+
+template <typename Scalar>
+static uint32_t electricityFrameInterval(const EffectSlotT<Scalar> &slot, unsigned long elapsed)
+{
+  const ElectricityStateT<Scalar> &electricity = slot.data.electricity;
+  if (electricity.duration == 0)
+  {
+    return EFFECT_FRAME_CONTINUOUS;
+  }
+  // Both the stable state and an event hold one output until the next change
+  return timeUntil(electricity.changeTime + electricity.duration, elapsed);
+}
+
+// The running program's own rate; every frame until it has started
+template <typename Scalar>
+static uint32_t programFrameInterval(const EffectSlotT<Scalar> &slot, unsigned long elapsed)
+{
+  uint8_t running = slot.data.program.program;
+  if (running == 0)
+  {
+    return EFFECT_FRAME_CONTINUOUS;
+  }
+  uint16_t frameMs = vmProgram(running - 1).frameMs;
+  return frameMs == 0 ? EFFECT_FRAME_CONTINUOUS : frameMs;
+}
+
+template <typename Scalar>
+static uint32_t keyframesFrameInterval(const EffectSlotT<Scalar> &slot, unsigned long elapsed)
+{
+  const KeyframeTrack *track = keyframeActive.load(std::memory_order_acquire);
+  if (track == nullptr)
+  {
+    return EFFECT_FRAME_STATIC; // The firmware wakes the LED task when it publishes one
+  }
+  return keyframeFrameInterval(*track, keyframeTrackTime(*track, elapsed));
+}
+
+// ---------------------------------------------------------------------------
+// Registry: one entry per EffectType, in enum order, built at compile time
+
+template <typename Scalar>
+struct EffectDefinitionT
+{
+  EffectType type;    // Must match the entry's index
+  const char *name;   // For logs and benchmarks
+  uint16_t stateSize; // Bytes of EffectDataT the effect keeps, 0 when stateless
+  void (*registerOscillators)(OscillatorBank &bank);
+  void (*render)(EffectSlotT<Scalar> &slot, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                 EffectOutputT<Scalar> &out);
+  uint32_t (*frameInterval)(const EffectSlotT<Scalar> &slot, unsigned long elapsed);
+};
+
+// AUTO_CYCLE and LAYERED are composites with no render or interval of their
+// own: they run the other entries (see applyAutoCycle and Compositor.cpp)
+template <typename Scalar>
+constexpr EffectDefinitionT<Scalar> EFFECT_REGISTRY[] = {
+    {EFFECT_NONE, "NONE", 0, nullptr, renderNone<Scalar>, nullptr},
+    {EFFECT_COLOR_WANDER, "COLOR_WANDER", 0, registerWanderOscillators, renderColorWander<Scalar>,
+     fixedFrameInterval<Scalar, COLOR_WANDER_FRAME_MS>},
+    {EFFECT_LEVEL_PULSE, "LEVEL_PULSE", 0, registerPulseOscillators, renderLevelPulse<Scalar>,
+     fixedFrameInterval<Scalar, LEVEL_PULSE_FRAME_MS>},
+    {EFFECT_COMBO, "COMBO", 0, registerWanderOscillators, renderCombo<Scalar>,
+     fixedFrameInterval<Scalar, LEVEL_PULSE_FRAME_MS>},
+    {EFFECT_SCENE_CHANGE, "SCENE_CHANGE", sizeof(SceneChangeStateT<Scalar>), nullptr, renderSceneChange<Scalar>,
+     sceneChangeFrameInterval<Scalar>},
+    {EFFECT_FIREPLACE, "FIREPLACE", 0, registerFlameOscillators, renderFireplace<Scalar>,
+     fixedFrameInterval<Scalar, FIREPLACE_FRAME_MS>},
+    {EFFECT_RAINBOW, "RAINBOW", sizeof(RainbowStateT<Scalar>), registerRainbowOscillators, renderRainbow<Scalar>,
+     fixedFrameInterval<Scalar, RAINBOW_FRAME_MS>},
+    {EFFECT_COLOR_STEPS, "COLOR_STEPS", sizeof(ColorStepsStateT<Scalar>), nullptr, renderColorSteps<Scalar>,
+     colorStepsFrameInterval<Scalar>},
+    {EFFECT_BROKEN_ELECTRICITY, "BROKEN_ELECTRICITY", sizeof(ElectricityStateT<Scalar>), nullptr,
+     renderBrokenElectricity<Scalar>, electricityFrameInterval<Scalar>},
+    {EFFECT_BREATHING, "BREATHING", 0, registerBreathingOscillators, renderBreathing<Scalar>,
+     fixedFrameInterval<Scalar, BREATHING_FRAME_MS>},
+    {EFFECT_AUTO_CYCLE, "AUTO_CYCLE", sizeof(AutoCycleStateT<Scalar>), nullptr, nullptr, nullptr},
+    {EFFECT_LAYERED, "LAYERED", sizeof(CompositorT<Scalar>), nullptr, nullptr, nullptr},
+    {EFFECT_PROGRAM, "PROGRAM", sizeof(ProgramState), nullptr, renderProgram<Scalar>, programFrameInterval<Scalar>},
+    {EFFECT_KEYFRAMES, "KEYFRAMES", 0, nullptr, renderKeyframes<Scalar>, keyframesFrameInterval<Scalar>},
+};
+
+template <typename Scalar>
+constexpr bool registryInEnumOrder()
+{
+  for (int i = 0; i < MAX_EFFECT_NUMBER; i++)
+  {
+    if (EFFECT_REGISTRY<Scalar>[i].type != i)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(sizeof(EFFECT_REGISTRY<float>) / sizeof(EFFECT_REGISTRY<float>[0]) == MAX_EFFECT_NUMBER,
+              "Every EffectType needs a registry entry");
+static_assert(registryInEnumOrder<float>() && registryInEnumOrder<Fix16>(),
+              "Registry entries must be in EffectType order");
+
+const char *effectName(EffectType type)
+{
+  return type < MAX_EFFECT_NUMBER ? EFFECT_REGISTRY<RenderScalar>[type].name : "?";
+}
+
+size_t effectStateSize(EffectType type)
+{
+  return type < MAX_EFFECT_NUMBER ? EFFECT_REGISTRY<RenderScalar>[type].stateSize : 0;
+}
+
+void effectRegistryLog()
+{
+  Serial.printf("Effect state: %u bytes (slot data %u, oscillators %u, composites %u)\n",
+                (unsigned)sizeof(EffectState), (unsigned)sizeof(EffectDataT<RenderScalar>),
+                (unsigned)sizeof(OscillatorBank), (unsigned)sizeof(CompositeDataT<RenderScalar>));
+  for (int type = 0; type < MAX_EFFECT_NUMBER; type++)
+  {
+    Serial.printf("  %2d %-18s %3u bytes\n", type, effectName((EffectType)type),
+                  (unsigned)effectStateSize((EffectType)type));
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Dispatch
+
+// Set the slot up for an effect starting at epoch (ms since the effect
+// started): cleared state, fresh oscillators, its own random stream
+template <typename Scalar>
+static void effectSlotStart(EffectSlotT<Scalar> &slot, EffectType type, uint32_t epoch)
+{
+  OscillatorBank &bank = slot.oscillators;
+  oscillatorBankReset(bank);
+  bank.epoch = epoch;
+  const EffectDefinitionT<Scalar> &definition = EFFECT_REGISTRY<Scalar>[type];
+  if (definition.registerOscillators != nullptr)
+  {
+    definition.registerOscillators(bank);
+  }
+  bank.owner = type;
+
+  prngSeed(slot.random, prngStreamSeed(slot.seed, ((uint32_t)type << 24) ^ epoch));
+  slot.data = EffectDataT<Scalar>();
+}
+
+template <typename Scalar>
+void effectRenderSlot(EffectSlotT<Scalar> &slot, EffectType type, const FrameContextT<Scalar> &frame,
+                       unsigned long elapsed, EffectOutputT<Scalar> &out)
+{
+  if (slot.oscillators.owner != type)
+  {
+    effectSlotStart(slot, type, elapsed);
+  }
+  oscillatorBankSeek(slot.oscillators, elapsed);
+
+  out.r = frame.baseR;
+  out.g = frame.baseG;
+  out.b = frame.baseB;
+  out.level = frame.baseLevel;
+  EFFECT_REGISTRY<Scalar>[type].render(slot, frame, elapsed, out);
+}
+
+// Auto-cycle through all other effects randomly with smooth transitions
+template <typename Scalar>
+static void applyAutoCycle(EffectStateT<Scalar> &state, const FrameContextT<Scalar> &frame, unsigned long elapsed,
+                           EffectOutputT<Scalar> &out)
+{
+  AutoCycleStateT<Scalar> &cycle = state.composite.autoCycle;
+
+  // Initialize auto-cycle if first time
+  if (cycle.duration == 0)
+  {
+    // Pick random first effect (exclude EFFECT_NONE=0 and EFFECT_AUTO_CYCLE=10)
+    prngSeed(cycle.random, prngStreamSeed(state.slot.seed, EFFECT_AUTO_CYCLE));
+    cycle.subEffect = 1 + prngRange(cycle.random, 0, 9); // Random from 1-9
+    oscillatorBankReset(state.slot.oscillators); // Sub-effect starts afresh in the slot
+    cycle.inTransition = false;
+
+    // Set random duration for first effect
+    cycle.duration = autoCycleDuration(cycle.random);
+    cycle.startTime = elapsed;
+  }
+
+  // Check if it's time to start transition to next effect
+  if (!cycle.inTransition && (elapsed - cycle.startTime) >= (cycle.duration - AUTO_CYCLE_TRANSITION_TIME_MS))
+  {
+    // Start transition - the outgoing effect moves to its own slot and keeps
+    // running there until the blend is over
+    cycle.previous = state.slot;
+
+    // Set up transition, timed from when it was due rather than this frame
+    cycle.prevEffect = cycle.subEffect;
+    cycle.inTransition = true;
+    cycle.transitionStart = cycle.startTime + cycle.duration - AUTO_CYCLE_TRANSITION_TIME_MS;
+
+    // Pick new effect (different from current)
+    int newEffect;
+    do
+    {
+      newEffect = 1 + prngRange(cycle.random, 0, 9); // Random from 1-9
+    } while (newEffect == cycle.subEffect);
+
+    cycle.subEffect = newEffect;
+    oscillatorBankReset(state.slot.oscillators);
+  }
+
+  // Check if transition is complete
+  if (cycle.inTransition && (elapsed - cycle.transitionStart) >= AUTO_CYCLE_TRANSITION_TIME_MS)
+  {
+    // Transition complete - start new effect duration
+    cycle.inTransition = false;
+    cycle.duration = autoCycleDuration(cycle.random);
+    cycle.startTime = cycle.transitionStart + AUTO_CYCLE_TRANSITION_TIME_MS;
+  }
+
+  // Run the current sub-effect
+  effectRenderSlot(state.slot, (EffectType)cycle.subEffect, frame, elapsed, out);
+
+  if (cycle.inTransition)
+  {
+    // During transition - run the previous effect too and blend the two
+    EffectOutputT<Scalar> previous;
+    effectRenderSlot(cycle.previous, (EffectType)cycle.prevEffect, frame, elapsed, previous);
+
+    Scalar transitionProgress = scalarRatio<Scalar>(elapsed - cycle.transitionStart, AUTO_CYCLE_TRANSITION_TIME_MS);
+    transitionProgress = constrain(transitionProgress, Scalar(0), Scalar(1));
+
+    // Smooth interpolation using smoothstep for natural feel
+    Scalar smoothProgress = transitionProgress * transitionProgress * (Scalar(3) - Scalar(2) * transitionProgress);
+    Scalar previousWeight = Scalar(1) - smoothProgress;
+
+    // Blend between previous and current effects. In float the weights can
+    // round the sum a hair past full, so it is clamped.
+    const Scalar zero = Scalar(0);
+    const Scalar full = Scalar(255);
+    out.r = constrain(previous.r * previousWeight + out.r * smoothProgress, zero, full);
+    out.g = constrain(previous.g * previousWeight + out.g * smoothProgress, zero, full);
+    out.b = constrain(previous.b * previousWeight + out.b * smoothProgress, zero, full);
+    out.level = constrain(previous.level * previousWeight + out.level * smoothProgress, zero, full);
+  }
+}
+
+template <typename Scalar>
+void effectStart(EffectStateT<Scalar> &state, EffectType type, uint32_t now)
+{
+  state.type = type;
+  state.startTime = now;
+  state.slot.seed = prngStreamSeed(state.seed, now);
+  oscillatorBankReset(state.slot.oscillators); // The effect sets its slot up on its first frame
+  state.composite = CompositeDataT<Scalar>();  // Composites restart from fresh sub-effects
+  if (type == EFFECT_LAYERED)
+  {
+    state.composite.layers.seed = state.slot.seed;
+  }
+}
+
+// A zeroed state (not set up yet) asks for the next frame right away
+template <typename Scalar>
+uint32_t effectSlotFrameInterval(const EffectSlotT<Scalar> &slot, EffectType type, unsigned long elapsed)
+{
+  const EffectDefinitionT<Scalar> &definition = EFFECT_REGISTRY<Scalar>[type];
+  return definition.frameInterval != nullptr ? definition.frameInterval(slot, elapsed) : EFFECT_FRAME_STATIC;
+}
+
+template <typename Scalar>
+uint32_t effectFrameInterval(const EffectStateT<Scalar> &state, uint32_t now)
+{
+  if (state.startTime == 0)
+  {
+    return EFFECT_FRAME_CONTINUOUS; // Not started yet
+  }
+  unsigned long elapsed = now - state.startTime;
+  if (state.type == EFFECT_LAYERED)
+  {
+    return compositorFrameInterval(state.composite.layers, elapsed);
+  }
+  if (state.type != EFFECT_AUTO_CYCLE)
+  {
+    return effectSlotFrameInterval(state.slot, state.type < MAX_EFFECT_NUMBER ? state.type : EFFECT_NONE, elapsed);
+  }
+
+  const AutoCycleStateT<Scalar> &cycle = state.composite.autoCycle;
+  if (cycle.duration == 0 || cycle.inTransition || state.slot.oscillators.owner != cycle.subEffect)
+  {
+    return EFFECT_FRAME_CONTINUOUS;
+  }
+  return min(effectSlotFrameInterval(state.slot, (EffectType)cycle.subEffect, elapsed),
+             timeUntil(cycle.startTime + cycle.duration - AUTO_CYCLE_TRANSITION_TIME_MS, elapsed));
+}
+
+// Apply effects to base color and return final output values
+template <typename Scalar>
+void applyEffects(EffectStateT<Scalar> &state, const FrameContextT<Scalar> &frame,
+                  Scalar &finalR, Scalar &finalG, Scalar &finalB, Scalar &finalLevel)
+{
+  if (state.startTime == 0)
+  {
+    state.startTime = frame.now;
+  }
+
+  unsigned long elapsed = frame.now - state.startTime; // ms since the effect started
+
+  EffectOutputT<Scalar> out;
+  if (state.type == EFFECT_AUTO_CYCLE)
+  {
+    applyAutoCycle(state, frame, elapsed, out);
+  }
+  else if (state.type == EFFECT_LAYERED)
+  {
+    compositorRender(state.composite.layers, frame, elapsed, out);
+  }
+  else
+  {
+    effectRenderSlot(state.slot, state.type < MAX_EFFECT_NUMBER ? state.type : EFFECT_NONE, frame, elapsed, out);
+  }
+
+  finalR = out.r;
+  finalG = out.g;
+  finalB = out.b;
+  finalLevel = out.level;
+}
+
+template void applyEffects<float>(EffectStateT<float> &, const FrameContextT<float> &,
+                                  float &, float &, float &, float &);
+template void applyEffects<Fix16>(EffectStateT<Fix16> &, const FrameContextT<Fix16> &,
+                                  Fix16 &, Fix16 &, Fix16 &, Fix16 &);
+
+template uint32_t effectFrameInterval<float>(const EffectStateT<float> &, uint32_t);
+template uint32_t effectFrameInterval<Fix16>(const EffectStateT<Fix16> &, uint32_t);
+
+template void effectStart<float>(EffectStateT<float> &, EffectType, uint32_t);
+template void effectStart<Fix16>(EffectStateT<Fix16> &, EffectType, uint32_t);
+
+template void effectRenderSlot<float>(EffectSlotT<float> &, EffectType, const FrameContextT<float> &, unsigned long,
+                                      EffectOutputT<float> &);
+template void effectRenderSlot<Fix16>(EffectSlotT<Fix16> &, EffectType, const FrameContextT<Fix16> &, unsigned long,
+                                      EffectOutputT<Fix16> &);
+template uint32_t effectSlotFrameInterval<float>(const EffectSlotT<float> &, EffectType, unsigned long);
+template uint32_t effectSlotFrameInterval<Fix16>(const EffectSlotT<Fix16> &, EffectType, unsigned long);
@@ -0,0 +1,300 @@
+#pragma once
+
+#include "ColorSpace.h"
+#include "EffectVm.h"
+#include "FixedPoint.h"
+#include "Hsv.h"
+#include "Oscillator.h"
+#include "Platform.h"
+#include "Prng.h"
+
+// Effects system
+enum EffectType
+{
+  EFFECT_NONE = 0,
+  EFFECT_COLOR_WANDER = 1,
+  EFFECT_LEVEL_PULSE = 2,
+  EFFECT_COMBO = 3,
+  EFFECT_SCENE_CHANGE = 4,
+  EFFECT_FIREPLACE = 5,
+  EFFECT_RAINBOW = 6,
+  EFFECT_COLOR_STEPS = 7,
+  EFFECT_BROKEN_ELECTRICITY = 8,
+  EFFECT_BREATHING = 9,
+  EFFECT_AUTO_CYCLE = 10,
+  EFFECT_LAYERED = 11,
+  EFFECT_PROGRAM = 12,
+  EFFECT_KEYFRAMES = 13,
+  MAX_EFFECT_NUMBER = 14
+};
+
+// Per-effect state. An effect that keeps state between frames owns one of
+// these structs and touches nothing else; they share the EffectDataT union,
+// which is zeroed whenever its effect (re)starts. A zeroed state means the
+// effect has not set itself up yet. All timers are integer milliseconds since
+// the effect started, so they never overflow a Q16.16 value.
+
+// SCENE_CHANGE: hold a random scene around the base, then smoothstep to the next
+template <typename Scalar>
+struct SceneChangeStateT
+{
+  Scalar targetR, targetG, targetB;    // Scene transitioned to
+  Scalar targetLevel;                  // Level transitioned to
+  Scalar currentR, currentG, currentB; // Scene held, or transitioned away from
+  Scalar currentLevel;                 // Level held, or transitioned away from
+  unsigned long changeTime;            // When the current phase started
+  unsigned long holdTime;              // How long to hold the current scene (5-10s random)
+  unsigned long transitionTime;        // How long the transition takes (1-2s), 0 before the first scene
+  bool transitioning;                  // True if transitioning, false if holding
+};
+
+// COLOR_STEPS: a random offset from the base that jumps on a fixed grid
+template <typename Scalar>
+struct ColorStepsStateT
+{
+  Scalar r, g, b;         // Current step color
+  unsigned long nextStep; // Time of the next step, 0 draws immediately
+};
+
+// BROKEN_ELECTRICITY: long stable stretches broken by short events
+template <typename Scalar>
+struct ElectricityStateT
+{
+  Scalar r, g, b, level;    // Output held until the next change
+  unsigned long changeTime; // When the current stretch started
+  unsigned long duration;   // How long it lasts, 0 before the first
+  bool inEvent;             // In an event vs stable
+};
+
+// RAINBOW: the base color's HSV, kept until the base changes
+template <typename Scalar>
+struct RainbowStateT
+{
+  WorkingColor key; // Target color it was taken from
+  HsvColor base;    // Its hue, saturation and value
+  bool valid;              // False until the first frame
+};
+
+template <typename Scalar>
+union EffectDataT
+{
+  SceneChangeStateT<Scalar> sceneChange;
+  RainbowStateT<Scalar> rainbow;
+  ColorStepsStateT<Scalar> colorSteps;
+  ElectricityStateT<Scalar> electricity;
+  ProgramState program; // PROGRAM: the bytecode interpreter computes in Q16.16 on both engines
+};
+
+// Everything one running effect owns. The slot belongs to the effect that
+// registered its oscillators (oscillators.owner); any other effect rendering
+// in it restarts it first. Each (re)start seeds the slot's random stream from
+// the slot seed, the effect and the start time, so every draw an effect makes
+// is a function of the seed and the timeline.
+template <typename Scalar>
+struct EffectSlotT
+{
+  OscillatorBank oscillators;
+  uint32_t seed; // Set by the owner of the slot, kept across restarts
+  Prng random;   // The running effect's stream
+  EffectDataT<Scalar> data;
+};
+
+// AUTO_CYCLE runs its sub-effects in the effect slot and keeps its own
+// schedule here. During a transition the outgoing sub-effect keeps running
+// live in its own slot, so a frame evaluates at most two effects.
+template <typename Scalar>
+struct AutoCycleStateT
+{
+  unsigned long startTime;       // When the current sub-effect started (ms since effect start)
+  unsigned long duration;        // How long the current sub-effect runs (ms), 0 before the first
+  int subEffect;                 // Current sub-effect (1-9)
+  bool inTransition;             // True while blending from the previous sub-effect
+  unsigned long transitionStart; // When the blend started
+  int prevEffect;                // Previous sub-effect (blended from)
+  Prng random;                   // Sub-effect picks and durations
+  EffectSlotT<Scalar> previous;  // Previous sub-effect's state, rendered live during the blend
+};
+
+// How a compositor layer combines with the layers below it
+enum BlendMode
+{
+  BLEND_REPLACE = 0,        // Layer output replaces color and level
+  BLEND_ADD = 1,            // Layer's change to the base color is added
+  BLEND_MULTIPLY = 2,       // Color is filtered by the layer color (255 = unchanged)
+  BLEND_MODULATE_LEVEL = 3, // Level is scaled by the layer's level relative to the base level
+};
+
+const uint8_t MAX_COMPOSITOR_LAYERS = 4;
+
+// One layer of a stack, as configured
+struct LayerSpec
+{
+  EffectType type; // Any effect but the composites (AUTO_CYCLE, LAYERED)
+  BlendMode mode;
+  float opacity; // 0.0-1.0, how much of the blend is applied
+};
+
+// Render time of one layer since the last report
+struct LayerCost
+{
+  uint64_t cycles;
+  uint32_t worstCycles;
+  uint32_t frames;
+};
+
+template <typename Scalar>
+struct LayerT
+{
+  EffectType type;
+  BlendMode mode;
+  Scalar opacity;
+  EffectSlotT<Scalar> slot; // The layer's own effect state
+  LayerCost cost;
+};
+
+// EFFECT_LAYERED: a stack of effects evaluated bottom to top over the base
+// color. Empty until its first frame loads LAYERED_DEFAULT_STACK.
+template <typename Scalar>
+struct CompositorT
+{
+  LayerT<Scalar> layers[MAX_COMPOSITOR_LAYERS];
+  uint8_t count;
+  uint32_t seed; // Each layer's slot seed derives from it and the layer index
+};
+
+// State of the composite effects, which run others through the registry
+template <typename Scalar>
+union CompositeDataT
+{
+  CompositorT<Scalar> layers; // Largest first: zeroing the union zeroes all of it
+  AutoCycleStateT<Scalar> autoCycle;
+};
+
+// Effect state, instantiated for the float and the fixed-point engine
+template <typename Scalar>
+struct EffectStateT
+{
+  EffectType type;
+  unsigned long startTime;
+  uint32_t seed;                    // Run seed: each start derives its streams from it and the start time
+  EffectSlotT<Scalar> slot;         // The effect rendering: type itself, or AUTO_CYCLE's sub-effect
+  CompositeDataT<Scalar> composite; // Only used by AUTO_CYCLE and LAYERED
+};
+
+// Output of one effect (or stack) for one frame
+template <typename Scalar>
+struct EffectOutputT
+{
+  Scalar r, g, b, level;
+};
+
+typedef EffectStateT<RenderScalar> EffectState;
+
+// Everything an effect may depend on for one frame. The render loop reads the
+// clock once per frame; effects are functions of this context and their own
+// schedule and never call millis() themselves.
+template <typename Scalar>
+struct FrameContextT
+{
+  uint32_t now;               // Frame timestamp (ms)
+  uint32_t dt;                // Time since the previous frame (ms), capped
+  Scalar baseR, baseG, baseB; // Base color (0.0-255.0)
+  Scalar baseLevel;           // Base brightness level (0.0-255.0)
+  WorkingColor target;        // Color the base is heading to, exact on both engines
+};
+
+extern EffectState effectState;
+
+// Effect parameters. Oscillator speeds are radians per EFFECT_SPEED_REFERENCE_MS
+// (the original fixed frame time); animations advance with real time, not frames.
+const uint32_t EFFECT_SPEED_REFERENCE_MS = 20;
+const uint32_t EFFECT_MAX_CATCH_UP_MS = 60000; // Longer gaps (light off) restart event schedules
+const float COLOR_WANDER_RANGE = 10.0f;        // How far colors can wander from base (0-255)
+const float COLOR_WANDER_SPEED = 0.01f;        // Speed of color wandering
+const float COLOR_STEPS_RANGE = 30.0f;         // Range for rapid color steps (0-255)
+const uint32_t COLOR_STEPS_INTERVAL_MS = 1000; // Time between steps
+const float LEVEL_PULSE_RANGE = 0.4f;          // Pulse range as fraction of base level (0.0-1.0)
+const float LEVEL_PULSE_SPEED = 0.01f;         // Speed of level pulsation
+const uint32_t COLOR_WANDER_FRAME_MS = 100;    // Wandering moves well under one color step per frame at this rate
+const uint32_t LEVEL_PULSE_FRAME_MS = 40;      // Frame interval for level pulse and combo
+
+// Fireplace effect parameters
+const float FIREPLACE_FLICKER_SPEED = 0.08f;  // Speed of flame flickering (faster)
+const float FIREPLACE_INTENSITY_RANGE = 0.3f; // How much brightness can vary (reduced range)
+const float FIREPLACE_RED_BOOST = 1.1f;       // Subtle red boost for warm fire colors
+const float FIREPLACE_ORANGE_MIX = 0.15f;     // Subtle orange mix to stay closer to base
+const uint32_t FIREPLACE_FRAME_MS = 20;       // Flicker needs the full frame rate
+
+// Rainbow effect parameters
+const float RAINBOW_CYCLE_SPEED = 0.02f; // Speed of color spectrum cycling (faster)
+const uint32_t RAINBOW_FRAME_MS = 40;    // Frame interval for the rainbow
+
+// Broken electricity effect parameters
+const uint32_t ELECTRICITY_STABLE_MIN_MS = 5000;       // Minimum stable time (5s)
+const uint32_t ELECTRICITY_STABLE_MAX_MS = 20000;      // Maximum stable time (20s)
+const float ELECTRICITY_BLACKOUT_CHANCE = 0.05f;       // 5% chance of complete blackout
+const float ELECTRICITY_SURGE_CHANCE = 0.1f;           // 10% chance of bright surge
+const float ELECTRICITY_FLICKER_CHANCE = 0.85f;        // 85% chance of normal flicker
+const uint32_t ELECTRICITY_BLACKOUT_DURATION_MS = 150; // Duration of blackouts (150ms)
+const uint32_t ELECTRICITY_SURGE_DURATION_MS = 100;    // Duration of surges (100ms)
+const uint32_t ELECTRICITY_FLICKER_MIN_MS = 50;        // Flickers last 50-150ms
+const float ELECTRICITY_SURGE_MULTIPLIER = 1.6f;       // Brightness multiplier for surges
+
+// Breathing effect parameters
+const float BREATHING_SPEED = 0.01f;          // Speed of breathing cycle (very slow)
+const float BREATHING_MIN_LEVEL = 0.2f;       // Minimum brightness (20% of base level)
+const float BREATHING_MAX_LEVEL = 1.0f;       // Maximum brightness (100% of base level)
+const float BREATHING_COLOR_VARIATION = 5.0f; // Subtle color warmth variation (±5 RGB units)
+const uint32_t BREATHING_FRAME_MS = 40;       // Frame interval for breathing
+
+// Auto-cycle effect parameters
+const uint32_t AUTO_CYCLE_MIN_TIME_MS = 30000;       // Minimum time per effect
+const uint32_t AUTO_CYCLE_MAX_TIME_MS = 300000;      // Maximum time per effect
+const uint32_t AUTO_CYCLE_TRANSITION_TIME_MS = 2000; // Smooth transition duration between effects (2s)
+
+const uint8_t RAINBOW_SATURATION = 204; // How vivid the rainbow colors are (0-255, 80%)
+
+// Fully saturated color of a 16-bit hue (HSV_HUE_TURN per turn) at brightness
+void hueToRGB(uint16_t hue, uint8_t brightness, uint32_t &R, uint32_t &G, uint32_t &B);
+
+// Effect frame intervals: EFFECT_FRAME_STATIC when the output cannot change
+// until something outside the effect does, EFFECT_FRAME_CONTINUOUS when it
+// needs every frame the renderer can give it
+const uint32_t EFFECT_FRAME_STATIC = 0xFFFFFFFF;
+const uint32_t EFFECT_FRAME_CONTINUOUS = 0;
+
+// Effect registry lookups. Every effect has a compile-time entry in
+// Effects.cpp; stateSize is the part of EffectDataT it uses (0 when all it
+// keeps is oscillators).
+const char *effectName(EffectType type);
+size_t effectStateSize(EffectType type);
+
+// Log every effect's per-frame state footprint
+void effectRegistryLog();
+
+// Render a leaf effect (any but the composites) from a slot, restarting it
+// there first if the slot belongs to another effect. elapsed is the time since
+// the effect started.
+template <typename Scalar>
+void effectRenderSlot(EffectSlotT<Scalar> &slot, EffectType type, const FrameContextT<Scalar> &frame,
+                      unsigned long elapsed, EffectOutputT<Scalar> &out);
+
+// Frame interval of a leaf effect rendering from slot (see effectFrameInterval)
+template <typename Scalar>
+uint32_t effectSlotFrameInterval(const EffectSlotT<Scalar> &slot, EffectType type, unsigned long elapsed);
+
+// Switch to an effect starting at now; its state is set up on the next frame
+template <typename Scalar>
+void effectStart(EffectStateT<Scalar> &state, EffectType type, uint32_t now);
+
+// Milliseconds from now until the effect's output next needs a frame: the
+// effect's own rate while it animates, the next scheduled event while it
+// holds (scene hold, color step, stable electricity). Instantiated for float and Fix16.
+template <typename Scalar>
+uint32_t effectFrameInterval(const EffectStateT<Scalar> &state, uint32_t now);
+
+// Apply the active effect to the frame's base color and return final output
+// values. Instantiated for float and Fix16.
+template <typename Scalar>
+void applyEffects(EffectStateT<Scalar> &state, const FrameContextT<Scalar> &frame,
+                  Scalar &finalR, Scalar &finalG, Scalar &finalB, Scalar &finalLevel);
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <stdint.h>
+#include <type_traits>
+
+// Numeric building blocks for the render engine.
+//
+// The effects and the output stage are written once against a Scalar type and
+// instantiated twice: with float (ESP32 with FPU, reference path) and with Fix16
+// (Q16.16 fixed point, for the FPU-less RISC-V ESP32-C6). Define
+// PELARBOJ_FIXED_POINT to make the firmware render with Fix16.
+
+// Q16.16 signed fixed-point number: range +-32768, resolution 1/65536
+struct Fix16
+{
+  int32_t raw;
+
+  Fix16() = default;
+
+  constexpr explicit Fix16(float value)
+      : raw((int32_t)(value * 65536.0f + (value >= 0.0f ? 0.5f : -0.5f))) {}
+
+  template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+  constexpr explicit Fix16(T value) : raw((int32_t)value * 65536) {}
+
+  static constexpr Fix16 fromRaw(int32_t raw)
+  {
+    return Fix16(raw, true);
+  }
+
+  // Truncates toward minus infinity
+  constexpr int32_t toInt() const
+  {
+    return raw >> 16;
+  }
+
+  float toFloat() const
+  {
+    return raw / 65536.0f;
+  }
+
+  constexpr Fix16 operator-() const { return fromRaw(-raw); }
+  constexpr Fix16 operator+(Fix16 other) const { return fromRaw(raw + other.raw); }
+  constexpr Fix16 operator-(Fix16 other) const { return fromRaw(raw - other.raw); }
+
+  // Rounded product with a 64-bit intermediate
+  constexpr Fix16 operator*(Fix16 other) const
+  {
+    return fromRaw((int32_t)(((int64_t)raw * other.raw + 0x8000) >> 16));
+  }
+
+  // Division by zero yields zero instead of trapping
+  constexpr Fix16 operator/(Fix16 other) const
+  {
+    return other.raw == 0 ? fromRaw(0) : fromRaw((int32_t)((int64_t)raw * 65536 / other.raw));
+  }
+
+  Fix16 &operator+=(Fix16 other) { raw += other.raw; return *this; }
+  Fix16 &operator-=(Fix16 other) { raw -= other.raw; return *this; }
+  Fix16 &operator*=(Fix16 other) { return *this = *this * other; }
+
+  constexpr bool operator<(Fix16 other) const { return raw < other.raw; }
+  constexpr bool operator>(Fix16 other) const { return raw > other.raw; }
+  constexpr bool operator<=(Fix16 other) const { return raw <= other.raw; }
+  constexpr bool operator>=(Fix16 other) const { return raw >= other.raw; }
+  constexpr bool operator==(Fix16 other) const { return raw == other.raw; }
+  constexpr bool operator!=(Fix16 other) const { return raw != other.raw; }
+
+private:
+  constexpr Fix16(int32_t rawValue, bool) : raw(rawValue) {}
+};
+
+#ifdef PELARBOJ_FIXED_POINT
+typedef Fix16 RenderScalar;
+#else
+typedef float RenderScalar;
+#endif
+
+// Scalar from a raw Q16.16 value (e.g. a lookup table entry)
+template <typename Scalar>
+Scalar scalarFromRaw(int32_t raw);
+
+template <>
+inline float scalarFromRaw<float>(int32_t raw)
+{
+  return raw * (1.0f / 65536.0f);
+}
+
+template <>
+inline Fix16 scalarFromRaw<Fix16>(int32_t raw)
+{
+  return Fix16::fromRaw(raw);
+}
+
+// numerator / denominator for integer inputs (e.g. elapsed / duration in ms)
+template <typename Scalar>
+Scalar scalarRatio(int32_t numerator, int32_t denominator);
+
+template <>
+inline float scalarRatio<float>(int32_t numerator, int32_t denominator)
+{
+  return (float)numerator / denominator;
+}
+
+template <>
+inline Fix16 scalarRatio<Fix16>(int32_t numerator, int32_t denominator)
+{
+  return denominator == 0 ? Fix16(0) : Fix16::fromRaw((int32_t)((int64_t)numerator * 65536 / denominator));
+}
+
+// Integer part, truncated toward zero for the non-negative values the engine converts
+inline int32_t scalarToInt(float value)
+{
+  return (int32_t)value;
+}
+
+inline int32_t scalarToInt(Fix16 value)
+{
+  return value.toInt();
+}
+
+// Raw Q16.16 value (rounded like Fix16(float)), the bridge from the Scalar engines into integer-only stages
+inline int32_t scalarToRaw(float value)
+{
+  return (int32_t)(value * 65536.0f + (value >= 0.0f ? 0.5f : -0.5f));
+}
+
+inline int32_t scalarToRaw(Fix16 value)
+{
+  return value.raw;
+}
+
+inline float scalarToFloat(float value)
+{
+  return value;
+}
+
+inline float scalarToFloat(Fix16 value)
+{
+  return value.toFloat();
+}
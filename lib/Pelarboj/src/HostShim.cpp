@@ -0,0 +1,118 @@
+// Host-side implementation of the Arduino/FreeRTOS shim declared in Platform.h.
+// Compiled to nothing on the device.
+#ifndef ARDUINO
+
+#include "Platform.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <chrono>
+
+HostSerial Serial;
+
+static unsigned long virtualMillis = 0;
+static uint32_t randomState = 0x2545F491;
+
+unsigned long millis()
+{
+  return virtualMillis;
+}
+
+unsigned long micros()
+{
+  return virtualMillis * 1000UL;
+}
+
+void hostSetMillis(unsigned long ms)
+{
+  virtualMillis = ms;
+}
+
+void hostAdvanceMillis(unsigned long ms)
+{
+  virtualMillis += ms;
+}
+
+uint32_t cpuCycleCount()
+{
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+uint32_t getCpuFrequencyMhz()
+{
+  return 1000;
+}
+
+void randomSeed(unsigned long seed)
+{
+  // xorshift32 must never be seeded with zero
+  randomState = seed != 0 ? (uint32_t)seed : 0x2545F491;
+}
+
+static uint32_t nextRandom()
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+long random(long howbig)
+{
+  if (howbig <= 0)
+  {
+    return 0;
+  }
+  return nextRandom() % howbig;
+}
+
+long random(long howsmall, long howbig)
+{
+  if (howsmall >= howbig)
+  {
+    return howsmall;
+  }
+  return howsmall + random(howbig - howsmall);
+}
+
+int HostSerial::printf(const char *format, ...)
+{
+  if (muted)
+  {
+    return 0;
+  }
+  va_list args;
+  va_start(args, format);
+  int written = vprintf(format, args);
+  va_end(args);
+  return written;
+}
+
+size_t HostSerial::println(const char *text)
+{
+  if (muted)
+  {
+    return 0;
+  }
+  return (size_t)::printf("%s\n", text);
+}
+
+void portENTER_CRITICAL(portMUX_TYPE *mux)
+{
+  while (mux->test_and_set(std::memory_order_acquire))
+  {
+  }
+}
+
+void portEXIT_CRITICAL(portMUX_TYPE *mux)
+{
+  mux->clear(std::memory_order_release);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  hostAdvanceMillis(ticks);
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include "Hsv.h"
+
+// round(a * b / 255) for 8-bit a and b, by multiply and shift
+static uint8_t scale255(uint32_t a, uint32_t b)
+{
+  uint32_t product = a * b + 128;
+  return (uint8_t)((product + (product >> 8)) >> 8);
+}
+
+HsvColor rgbToHsv(uint8_t r, uint8_t g, uint8_t b)
+{
+  // Hue in sixths of a turn, each sixth 2^16: the strongest channel picks the
+  // primary (0 red, 2 green, 4 blue) and the middle one leans it toward the
+  // neighbouring primary by its share of the spread
+  uint8_t strongest, weakest;
+  uint32_t center;
+  int32_t lean;
+  if (r >= g && r >= b)
+  {
+    strongest = r;
+    weakest = g < b ? g : b;
+    center = 6;
+    lean = (int32_t)g - b;
+  }
+  else if (g >= b)
+  {
+    strongest = g;
+    weakest = r < b ? r : b;
+    center = 2;
+    lean = (int32_t)b - r;
+  }
+  else
+  {
+    strongest = b;
+    weakest = r < g ? r : g;
+    center = 4;
+    lean = (int32_t)r - g;
+  }
+
+  HsvColor color = {0, 0, strongest};
+  uint32_t spread = strongest - weakest;
+  if (spread == 0)
+  {
+    return color; // Grey
+  }
+  color.saturation = (uint8_t)((spread * 255 + strongest / 2) / strongest);
+
+  uint32_t share = ((uint32_t)(lean < 0 ? -lean : lean) * 65536 + spread / 2) / spread;
+  uint32_t sixths = (center << 16) + (lean < 0 ? -(int32_t)share : (int32_t)share);
+  color.hue = (uint16_t)((sixths + 3) / 6);
+  return color;
+}
+
+void hsvToRgb(const HsvColor &color, uint8_t &r, uint8_t &g, uint8_t &b)
+{
+  uint32_t sixths = color.hue * 6u;
+  uint32_t sector = sixths >> 16;
+  uint32_t fraction = sixths & 0xFFFF;
+
+  uint8_t strongest = color.value;
+  uint32_t spread = scale255(color.saturation, color.value);
+  uint8_t weakest = strongest - spread;
+  uint8_t rising = weakest + ((spread * fraction + 32768) >> 16);
+  uint8_t falling = weakest + ((spread * (65536 - fraction) + 32768) >> 16);
+
+  switch (sector)
+  {
+  case 0: // Red to yellow
+    r = strongest, g = rising, b = weakest;
+    break;
+  case 1: // Yellow to green
+    r = falling, g = strongest, b = weakest;
+    break;
+  case 2: // Green to cyan
+    r = weakest, g = strongest, b = rising;
+    break;
+  case 3: // Cyan to blue
+    r = weakest, g = falling, b = strongest;
+    break;
+  case 4: // Blue to magenta
+    r = rising, g = weakest, b = strongest;
+    break;
+  default: // Magenta to red
+    r = strongest, g = weakest, b = falling;
+    break;
+  }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+// Integer HSV kernels: 8-bit RGB to a 16-bit hue and back. The round trip is
+// exact - every RGB color comes back unchanged - and the way back is
+// multiplies and shifts only. Greys (R = G = B) get hue 0 and saturation 0
+// rather than a division by zero.
+
+const uint32_t HSV_HUE_TURN = 65536; // Full circle of hue, 0 = red
+
+struct HsvColor
+{
+  uint16_t hue;       // Binary angle, HSV_HUE_TURN per turn
+  uint8_t saturation; // 0-255
+  uint8_t value;      // Strongest channel, 0-255
+};
+
+HsvColor rgbToHsv(uint8_t r, uint8_t g, uint8_t b);
+
+void hsvToRgb(const HsvColor &color, uint8_t &r, uint8_t &g, uint8_t &b);
@@ -0,0 +1,198 @@
+#include "Instrumentation.h"
+
+Instrumentation instrumentation = {};
+
+// Serializes the recording tasks and loop() (reporting)
+static portMUX_TYPE instrumentationLock = portMUX_INITIALIZER_UNLOCKED;
+
+uint32_t histogramBucket(uint32_t value)
+{
+  uint32_t bits = 0;
+  while (value != 0 && bits < HISTOGRAM_BUCKETS - 1)
+  {
+    value >>= 1;
+    bits++;
+  }
+  return bits;
+}
+
+void histogramAdd(Histogram &histogram, uint32_t value)
+{
+  histogram.counts[histogramBucket(value)]++;
+  histogram.worst = max(histogram.worst, value);
+}
+
+uint32_t histogramCount(const Histogram &histogram)
+{
+  uint32_t count = 0;
+  for (uint32_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+  {
+    count += histogram.counts[bucket];
+  }
+  return count;
+}
+
+// Largest value a bucket can hold
+static uint32_t bucketLimit(uint32_t bucket)
+{
+  return bucket == HISTOGRAM_BUCKETS - 1 ? UINT32_MAX : (1u << bucket) - 1;
+}
+
+uint32_t histogramPercentile(const Histogram &histogram, uint32_t percent)
+{
+  uint64_t total = histogramCount(histogram);
+  uint64_t seen = 0;
+  for (uint32_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+  {
+    seen += histogram.counts[bucket];
+    if (seen > 0 && seen * 100 >= total * percent)
+    {
+      return min(bucketLimit(bucket), histogram.worst);
+    }
+  }
+  return 0;
+}
+
+void instrumentFrameStart(Instrumentation &instr, uint32_t nowUs, uint32_t cycles, bool notified)
+{
+  portENTER_CRITICAL(&instrumentationLock);
+  instr.frameStartCycles = cycles;
+  if (instr.waitMs != 0 && !notified)
+  {
+    // The tick can end a wait slightly early; that is on time, not negative
+    uint32_t waited = nowUs - instr.waitStartUs;
+    uint32_t due = instr.waitMs * 1000;
+    histogramAdd(instr.stats.wakeLatenessUs, waited > due ? waited - due : 0);
+  }
+  instr.waitMs = 0;
+  portEXIT_CRITICAL(&instrumentationLock);
+}
+
+void instrumentFrameEnd(Instrumentation &instr, uint32_t nowUs, uint32_t cycles, uint32_t waitMs)
+{
+  portENTER_CRITICAL(&instrumentationLock);
+  histogramAdd(instr.stats.frameCycles, cycles - instr.frameStartCycles);
+  instr.waitStartUs = nowUs;
+  instr.waitMs = waitMs;
+  portEXIT_CRITICAL(&instrumentationLock);
+}
+
+void instrumentPublish(Instrumentation &instr, uint32_t cycles)
+{
+  portENTER_CRITICAL(&instrumentationLock);
+  histogramAdd(instr.stats.publishCycles, cycles);
+  portEXIT_CRITICAL(&instrumentationLock);
+}
+
+void instrumentMailboxRetry(Instrumentation &instr)
+{
+  portENTER_CRITICAL(&instrumentationLock);
+  instr.stats.mailboxRetries++;
+  portEXIT_CRITICAL(&instrumentationLock);
+}
+
+void instrumentControlDrop(Instrumentation &instr)
+{
+  portENTER_CRITICAL(&instrumentationLock);
+  instr.stats.controlDrops++;
+  portEXIT_CRITICAL(&instrumentationLock);
+}
+
+InstrumentationStats instrumentationSnapshot(Instrumentation &instr)
+{
+  portENTER_CRITICAL(&instrumentationLock);
+  InstrumentationStats stats = instr.stats;
+  portEXIT_CRITICAL(&instrumentationLock);
+  return stats;
+}
+
+// Microseconds, saturated to the 16-bit summary fields
+static uint16_t summaryUs(uint32_t cycles, uint32_t cpuMhz)
+{
+  return (uint16_t)min(cycles / max(cpuMhz, 1u), (uint32_t)UINT16_MAX);
+}
+
+static uint16_t summaryUs(uint32_t us)
+{
+  return (uint16_t)min(us, (uint32_t)UINT16_MAX);
+}
+
+DiagnosticsSummary diagnosticsSummarize(const InstrumentationStats &stats, uint32_t cpuMhz, uint16_t buttonStackFree,
+                                        uint16_t ledStackFree)
+{
+  DiagnosticsSummary summary;
+  summary.frames = histogramCount(stats.frameCycles);
+  summary.frameP50Us = summaryUs(histogramPercentile(stats.frameCycles, 50), cpuMhz);
+  summary.frameP99Us = summaryUs(histogramPercentile(stats.frameCycles, 99), cpuMhz);
+  summary.frameWorstUs = summaryUs(stats.frameCycles.worst, cpuMhz);
+  summary.latenessP50Us = summaryUs(histogramPercentile(stats.wakeLatenessUs, 50));
+  summary.latenessP99Us = summaryUs(histogramPercentile(stats.wakeLatenessUs, 99));
+  summary.latenessWorstUs = summaryUs(stats.wakeLatenessUs.worst);
+  summary.publishP99Us = summaryUs(histogramPercentile(stats.publishCycles, 99), cpuMhz);
+  summary.publishWorstUs = summaryUs(stats.publishCycles.worst, cpuMhz);
+  summary.mailboxRetries = stats.mailboxRetries;
+  summary.controlDrops = stats.controlDrops;
+  summary.buttonStackFree = buttonStackFree;
+  summary.ledStackFree = ledStackFree;
+  return summary;
+}
+
+static uint8_t *put16(uint8_t *out, uint16_t value)
+{
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+  return out + 2;
+}
+
+static uint8_t *put32(uint8_t *out, uint32_t value)
+{
+  return put16(put16(out, value & 0xFFFF), value >> 16);
+}
+
+void diagnosticsEncode(const DiagnosticsSummary &summary, uint8_t *buffer)
+{
+  uint8_t *out = buffer;
+  *out++ = DIAGNOSTICS_VERSION;
+  out = put32(out, summary.frames);
+  out = put16(out, summary.frameP50Us);
+  out = put16(out, summary.frameP99Us);
+  out = put16(out, summary.frameWorstUs);
+  out = put16(out, summary.latenessP50Us);
+  out = put16(out, summary.latenessP99Us);
+  out = put16(out, summary.latenessWorstUs);
+  out = put16(out, summary.publishP99Us);
+  out = put16(out, summary.publishWorstUs);
+  out = put32(out, summary.mailboxRetries);
+  out = put32(out, summary.controlDrops);
+  out = put16(out, summary.buttonStackFree);
+  put16(out, summary.ledStackFree);
+}
+
+static void logHistogram(const char *name, const Histogram &histogram)
+{
+  Serial.printf("  %s (%lu samples, worst %lu):", name, (unsigned long)histogramCount(histogram),
+                (unsigned long)histogram.worst);
+  for (uint32_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+  {
+    if (histogram.counts[bucket] != 0)
+    {
+      Serial.printf(" <=%lu:%lu", (unsigned long)bucketLimit(bucket), (unsigned long)histogram.counts[bucket]);
+    }
+  }
+  Serial.printf("\n");
+}
+
+void instrumentationLog(const InstrumentationStats &stats, const DiagnosticsSummary &summary)
+{
+  Serial.printf("Instrumentation: %lu frames, frame p50 %u us p99 %u us worst %u us; wake late p50 %u us p99 %u us "
+                "worst %u us\n",
+                (unsigned long)summary.frames, summary.frameP50Us, summary.frameP99Us, summary.frameWorstUs,
+                summary.latenessP50Us, summary.latenessP99Us, summary.latenessWorstUs);
+  Serial.printf("  publish p99 %u us worst %u us; %lu mailbox retries, %lu control drops; stack free: button %u B, "
+                "LED %u B\n",
+                summary.publishP99Us, summary.publishWorstUs, (unsigned long)summary.mailboxRetries,
+                (unsigned long)summary.controlDrops, summary.buttonStackFree, summary.ledStackFree);
+  logHistogram("frame cycles", stats.frameCycles);
+  logHistogram("wake lateness us", stats.wakeLatenessUs);
+  logHistogram("publish cycles", stats.publishCycles);
+}
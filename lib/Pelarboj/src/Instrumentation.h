@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Platform.h"
+
+// Always-on render loop instrumentation: fixed-bucket histograms of frame time
+// (CPU cycles), LED task wake lateness and mailbox publish time, plus counters
+// for the handoff paths. Everything lives in RAM and accumulates from boot;
+// loop() dumps it on the serial port on request and refreshes a compact summary
+// in a manufacturer-specific Zigbee attribute, so a lamp can be checked in the
+// field without a debugger.
+
+const uint32_t HISTOGRAM_BUCKETS = 24; // Bucket b > 0 holds [2^(b-1), 2^b), the last one everything above
+
+struct Histogram
+{
+  uint32_t counts[HISTOGRAM_BUCKETS];
+  uint32_t worst; // Largest value recorded
+};
+
+struct InstrumentationStats
+{
+  Histogram frameCycles;    // LED task: frame start to wait, effects and output included
+  Histogram wakeLatenessUs; // LED task: how far past its timeout a timed wait ended
+  Histogram publishCycles;  // Zigbee/button: mailbox publish, writer lock wait included
+  uint32_t mailboxRetries;  // Frames that found a newer snapshot but collided with its writer
+  uint32_t controlDrops;    // Button events dropped on a full control queue
+};
+
+struct Instrumentation
+{
+  InstrumentationStats stats; // Guarded by the instrumentation lock
+  uint32_t frameStartCycles;  // Cycle count at the start of the current frame
+  uint32_t waitStartUs;       // When the LED task last started a timed wait
+  uint32_t waitMs;            // Its timeout, 0 when it waits for a notification only
+};
+
+extern Instrumentation instrumentation;
+
+// Bucket of a value: its number of significant bits, capped at the last bucket
+uint32_t histogramBucket(uint32_t value);
+
+// Record a value (no locking - the Instrumentation functions lock)
+void histogramAdd(Histogram &histogram, uint32_t value);
+
+// Values recorded in total
+uint32_t histogramCount(const Histogram &histogram);
+
+// Upper bound of the bucket holding the given percentile (capped at the worst
+// value), 0 when the histogram is empty
+uint32_t histogramPercentile(const Histogram &histogram, uint32_t percent);
+
+// LED task: a frame starts. notified is true when the wait before it was ended
+// by a task notification, which is early by design and not counted as lateness.
+void instrumentFrameStart(Instrumentation &instr, uint32_t nowUs, uint32_t cycles, bool notified);
+
+// LED task: the frame is done and the task waits waitMs (0: until notified)
+void instrumentFrameEnd(Instrumentation &instr, uint32_t nowUs, uint32_t cycles, uint32_t waitMs);
+
+// Zigbee/button task: a mailbox publish took the given cycles
+void instrumentPublish(Instrumentation &instr, uint32_t cycles);
+
+void instrumentMailboxRetry(Instrumentation &instr);
+void instrumentControlDrop(Instrumentation &instr);
+
+// Consistent copy of the totals since boot
+InstrumentationStats instrumentationSnapshot(Instrumentation &instr);
+
+// Condensed view for the Zigbee diagnostics attribute; times in microseconds
+struct DiagnosticsSummary
+{
+  uint32_t frames;
+  uint16_t frameP50Us, frameP99Us, frameWorstUs;
+  uint16_t latenessP50Us, latenessP99Us, latenessWorstUs;
+  uint16_t publishP99Us, publishWorstUs;
+  uint32_t mailboxRetries;
+  uint32_t controlDrops;
+  uint16_t buttonStackFree; // Bytes never used of the Button_Handler stack
+  uint16_t ledStackFree;    // Bytes never used of the LED_Update stack
+};
+
+const uint8_t DIAGNOSTICS_VERSION = 1;
+const size_t DIAGNOSTICS_ENCODED_SIZE = 33; // Version byte plus the fields, little-endian
+
+DiagnosticsSummary diagnosticsSummarize(const InstrumentationStats &stats, uint32_t cpuMhz, uint16_t buttonStackFree,
+                                        uint16_t ledStackFree);
+
+// Pack a summary into DIAGNOSTICS_ENCODED_SIZE bytes in field order
+void diagnosticsEncode(const DiagnosticsSummary &summary, uint8_t *buffer);
+
+// Serial dump: the summary, then every non-empty histogram bucket
+void instrumentationLog(const InstrumentationStats &stats, const DiagnosticsSummary &summary);
@@ -0,0 +1,159 @@
+#include "Keyframes.h"
+
+#include <string.h>
+
+#include "StateStore.h"
+
+std::atomic<const KeyframeTrack *> keyframeActive(nullptr);
+
+static uint32_t readLe(const uint8_t *data, int bytes)
+{
+  uint32_t value = 0;
+  for (int i = 0; i < bytes; i++)
+  {
+    value |= (uint32_t)data[i] << (8 * i);
+  }
+  return value;
+}
+
+static uint32_t indexAt(const KeyframeTrack &track, uint32_t bucket)
+{
+  return readLe(track.index + 4 * bucket, 4);
+}
+
+static uint32_t keyTime(const KeyframeTrack &track, uint32_t index)
+{
+  return readLe(track.keys + KEYFRAME_SIZE * index, 3);
+}
+
+Keyframe keyframeAt(const KeyframeTrack &track, uint32_t index)
+{
+  const uint8_t *key = track.keys + KEYFRAME_SIZE * index;
+  return {readLe(key, 3), key[3], key[4], key[5], key[6], key[7]};
+}
+
+bool keyframeOpen(KeyframeTrack &track, const uint8_t *data, size_t size)
+{
+  memset(&track, 0, sizeof(track));
+  if (size < KEYFRAME_HEADER_SIZE || memcmp(data, "PKF", 3) != 0 || data[3] != KEYFRAME_VERSION ||
+      data[20] != crc8(data, 20))
+  {
+    return false;
+  }
+  KeyframeTrack candidate;
+  candidate.loop = (data[4] & KEYFRAME_FLAG_LOOP) != 0;
+  candidate.bucketShift = data[5];
+  candidate.keyCount = readLe(data + 8, 4);
+  candidate.durationMs = readLe(data + 12, 4);
+  candidate.bucketCount = readLe(data + 16, 4);
+  candidate.index = data + KEYFRAME_HEADER_SIZE;
+  candidate.keys = candidate.index + 4 * (size_t)candidate.bucketCount;
+  if (candidate.keyCount == 0 || candidate.durationMs > KEYFRAME_MAX_TIME_MS || candidate.bucketShift > 24 ||
+      candidate.bucketCount != (candidate.durationMs >> candidate.bucketShift) + 1 ||
+      KEYFRAME_HEADER_SIZE + 4 * (uint64_t)candidate.bucketCount + KEYFRAME_SIZE * (uint64_t)candidate.keyCount > size)
+  {
+    return false;
+  }
+
+  // Keyframes start at 0, in strictly increasing time, within the duration
+  uint32_t previous = 0;
+  for (uint32_t i = 0; i < candidate.keyCount; i++)
+  {
+    Keyframe key = keyframeAt(candidate, i);
+    if ((i == 0 ? key.time != 0 : key.time <= previous) || key.time > candidate.durationMs ||
+        key.curve >= KEYFRAME_CURVE_COUNT)
+    {
+      return false;
+    }
+    previous = key.time;
+  }
+
+  // Each index entry is the keyframe in effect at its bucket's start, and no
+  // bucket holds more keyframes than a lookup may probe
+  uint32_t active = 0;
+  for (uint32_t bucket = 0; bucket < candidate.bucketCount; bucket++)
+  {
+    uint32_t start = bucket << candidate.bucketShift;
+    while (active + 1 < candidate.keyCount && keyTime(candidate, active + 1) <= start)
+    {
+      active++;
+    }
+    uint32_t next = bucket + 1 < candidate.bucketCount ? indexAt(candidate, bucket + 1) : candidate.keyCount - 1;
+    if (indexAt(candidate, bucket) != active || next < active || next - active > KEYFRAME_MAX_PER_BUCKET)
+    {
+      return false;
+    }
+  }
+
+  track = candidate;
+  return true;
+}
+
+uint32_t keyframeTrackTime(const KeyframeTrack &track, unsigned long elapsed)
+{
+  if (track.loop)
+  {
+    return track.durationMs == 0 ? 0 : elapsed % track.durationMs;
+  }
+  return elapsed < track.durationMs ? elapsed : track.durationMs;
+}
+
+uint32_t keyframeFind(const KeyframeTrack &track, uint32_t t, uint32_t *probes)
+{
+  uint32_t index = indexAt(track, t >> track.bucketShift);
+  uint32_t examined = 0;
+  while (index + 1 < track.keyCount && keyTime(track, index + 1) <= t)
+  {
+    index++;
+    examined++;
+  }
+  if (probes != nullptr)
+  {
+    *probes = examined;
+  }
+  return index;
+}
+
+template <typename Scalar>
+void keyframeSample(const KeyframeTrack &track, uint32_t t, EffectOutputT<Scalar> &out)
+{
+  uint32_t index = keyframeFind(track, t);
+  Keyframe from = keyframeAt(track, index);
+  out.r = Scalar(from.r);
+  out.g = Scalar(from.g);
+  out.b = Scalar(from.b);
+  out.level = Scalar(from.level);
+  if (index + 1 >= track.keyCount || from.curve == KEYFRAME_STEP)
+  {
+    return;
+  }
+
+  Keyframe to = keyframeAt(track, index + 1);
+  Scalar progress = scalarRatio<Scalar>(t - from.time, to.time - from.time);
+  if (from.curve == KEYFRAME_SMOOTH)
+  {
+    progress = progress * progress * (Scalar(3) - Scalar(2) * progress);
+  }
+  out.r += (Scalar(to.r) - out.r) * progress;
+  out.g += (Scalar(to.g) - out.g) * progress;
+  out.b += (Scalar(to.b) - out.b) * progress;
+  out.level += (Scalar(to.level) - out.level) * progress;
+}
+
+uint32_t keyframeFrameInterval(const KeyframeTrack &track, uint32_t t)
+{
+  uint32_t index = keyframeFind(track, t);
+  if (index + 1 >= track.keyCount)
+  {
+    // Holding the last keyframe until the end, then starting over or done
+    return track.loop ? track.durationMs - t : EFFECT_FRAME_STATIC;
+  }
+  Keyframe from = keyframeAt(track, index);
+  Keyframe to = keyframeAt(track, index + 1);
+  bool holds = from.curve == KEYFRAME_STEP ||
+               (from.r == to.r && from.g == to.g && from.b == to.b && from.level == to.level);
+  return holds ? to.time - t : KEYFRAME_FRAME_MS;
+}
+
+template void keyframeSample<float>(const KeyframeTrack &, uint32_t, EffectOutputT<float> &);
+template void keyframeSample<Fix16>(const KeyframeTrack &, uint32_t, EffectOutputT<Fix16> &);
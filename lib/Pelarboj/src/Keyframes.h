@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+#include "Effects.h"
+
+// Keyframe animations: long choreographed sequences computed on a PC
+// (tools/keyframe_encode.py) and written to the raw `anim` flash partition.
+// The firmware memory-maps the partition and EFFECT_KEYFRAMES interpolates
+// straight from flash: nothing is copied to RAM, and a frame costs one index
+// read, at most KEYFRAME_MAX_PER_BUCKET keyframe probes and one
+// interpolation, however long the file is.
+//
+// File: "PKF", version, flags, bucket shift, 2 reserved bytes, keyframe count
+// (u32 LE), duration in ms (u32 LE), bucket count (u32 LE), header CRC-8,
+// 3 reserved bytes; then the bucket index, one u32 LE per 2^shift ms holding
+// the keyframe active at the bucket's start; then the keyframes.
+//
+// Keyframe (8 bytes): time in ms (u24 LE), curve to the next keyframe, red,
+// green, blue, level. Colors are absolute; the level is scaled by the Hue
+// level, so the lamp's dimmer still works. Stack it in LAYERED to blend it
+// over the Hue color instead.
+
+enum KeyframeCurve
+{
+  KEYFRAME_LINEAR = 0, // Straight line to the next keyframe
+  KEYFRAME_STEP = 1,   // Hold until the next keyframe
+  KEYFRAME_SMOOTH = 2, // Smoothstep to the next keyframe
+  KEYFRAME_CURVE_COUNT = 3
+};
+
+const uint8_t KEYFRAME_VERSION = 1;
+const uint8_t KEYFRAME_FLAG_LOOP = 0x01;    // Start over at the end instead of holding the last keyframe
+const size_t KEYFRAME_HEADER_SIZE = 24;
+const size_t KEYFRAME_SIZE = 8;
+const uint32_t KEYFRAME_MAX_PER_BUCKET = 4; // Bounds the probes per frame; the encoder picks the bucket size
+const uint32_t KEYFRAME_MAX_TIME_MS = 0xFFFFFF;
+const uint32_t KEYFRAME_FRAME_MS = 20;      // Frame interval while interpolating
+
+struct Keyframe
+{
+  uint32_t time;
+  uint8_t curve;
+  uint8_t r, g, b, level;
+};
+
+// A validated file, read in place
+struct KeyframeTrack
+{
+  const uint8_t *index; // Bucket index
+  const uint8_t *keys;  // Keyframes
+  uint32_t keyCount;    // 0 when nothing is loaded
+  uint32_t durationMs;
+  uint32_t bucketCount;
+  uint8_t bucketShift;
+  bool loop;
+};
+
+// The track EFFECT_KEYFRAMES plays, nullptr (the base shows) until the
+// firmware has mapped and checked a file. That happens after the LED task has
+// started, so the first frame does not wait for the flash to be read: the
+// checked track is published with one release store and read-only afterwards.
+extern std::atomic<const KeyframeTrack *> keyframeActive;
+
+// Check a file in place - header, keyframe order and curves, and every index
+// entry and bucket bound - and point track at it. Reads the whole file once;
+// afterwards playback trusts it. False (and an empty track) when invalid.
+bool keyframeOpen(KeyframeTrack &track, const uint8_t *data, size_t size);
+
+Keyframe keyframeAt(const KeyframeTrack &track, uint32_t index);
+
+// Position in the track elapsed ms after the effect started: wrapped when it
+// loops, held at the end otherwise
+uint32_t keyframeTrackTime(const KeyframeTrack &track, unsigned long elapsed);
+
+// Index of the keyframe in effect at position t. probes, when given, receives
+// the keyframes examined past the index entry (at most KEYFRAME_MAX_PER_BUCKET).
+uint32_t keyframeFind(const KeyframeTrack &track, uint32_t t, uint32_t *probes = nullptr);
+
+// Interpolated keyframe values at position t (0-255 each)
+template <typename Scalar>
+void keyframeSample(const KeyframeTrack &track, uint32_t t, EffectOutputT<Scalar> &out);
+
+// Milliseconds from position t until the output next changes: every frame
+// while interpolating, the next keyframe while holding, EFFECT_FRAME_STATIC at
+// the end of a track that does not loop
+uint32_t keyframeFrameInterval(const KeyframeTrack &track, uint32_t t);
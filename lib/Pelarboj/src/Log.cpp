@@ -0,0 +1,65 @@
+#include "Log.h"
+
+LogRing logRing = {};
+void (*logConsumerWake)() = nullptr;
+
+bool logPush(LogRing &ring, const LogRecord &record)
+{
+  uint32_t pos = ring.head.load(std::memory_order_relaxed);
+  LogSlot *slot;
+  while (true)
+  {
+    uint32_t index = pos & (LOG_RING_SIZE - 1);
+    slot = &ring.slots[index];
+    int32_t turn = (int32_t)(slot->sequence.load(std::memory_order_acquire) - (pos - index));
+    if (turn == 0)
+    {
+      // Free for this position - claim it unless another producer got there first
+      if (ring.head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (turn < 0)
+    {
+      // Still holds the record from one lap ago: full
+      ring.dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    else
+    {
+      pos = ring.head.load(std::memory_order_relaxed); // Claimed meanwhile, try the next one
+    }
+  }
+
+  slot->record = record;
+  slot->sequence.store(pos - (pos & (LOG_RING_SIZE - 1)) + 1, std::memory_order_release);
+  return true;
+}
+
+bool logPop(LogRing &ring, LogRecord &record)
+{
+  uint32_t pos = ring.tail.load(std::memory_order_relaxed);
+  uint32_t index = pos & (LOG_RING_SIZE - 1);
+  LogSlot &slot = ring.slots[index];
+  if (slot.sequence.load(std::memory_order_acquire) != pos - index + 1)
+  {
+    return false; // Empty, or the producer has not finished writing it
+  }
+  record = slot.record;
+  slot.sequence.store(pos - index + LOG_RING_SIZE, std::memory_order_release);
+  ring.tail.store(pos + 1, std::memory_order_relaxed);
+  return true;
+}
+
+uint32_t logDrain(LogRing &ring)
+{
+  uint32_t count = 0;
+  LogRecord record;
+  while (logPop(ring, record))
+  {
+    Serial.printf(record.format, record.args[0], record.args[1], record.args[2], record.args[3]);
+    count++;
+  }
+  return count;
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <type_traits>
+
+#include "Platform.h"
+
+// Deferred logging for the render, button and Zigbee paths. A log call stores a
+// compact record - the address of its format string plus up to LOG_MAX_ARGS
+// raw arguments - in a lock-free ring and returns; a low-priority task formats
+// the records and writes them to the serial port. A full ring drops the record
+// and counts it instead of blocking. Levels above PELARBOJ_LOG_LEVEL compile to
+// nothing.
+//
+// Arguments are integers, enums or string literals/static strings (the pointer
+// is stored, not the text), formatted with %d, %u, %x, %c or %s. No floats.
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_DEBUG 3
+
+#ifndef PELARBOJ_LOG_LEVEL
+#define PELARBOJ_LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+const uint32_t LOG_RING_SIZE = 32; // Records, power of two
+const uint32_t LOG_MAX_ARGS = 4;
+
+struct LogRecord
+{
+  const char *format;
+  uint8_t level;
+  uintptr_t args[LOG_MAX_ARGS];
+};
+
+// Bounded multi-producer single-consumer ring. Each slot's sequence tells
+// whose turn it is: free for the producer of position pos when it equals
+// pos - index, ready for the consumer one later. It is kept relative to the
+// slot index so an all-zero ring is empty.
+struct LogSlot
+{
+  std::atomic<uint32_t> sequence;
+  LogRecord record;
+};
+
+struct LogRing
+{
+  std::atomic<uint32_t> head;    // Next position to claim, shared by the producers
+  std::atomic<uint32_t> tail;    // Next position to read, owned by the consumer
+  std::atomic<uint32_t> dropped; // Records lost to a full ring since boot
+  LogSlot slots[LOG_RING_SIZE];
+};
+
+extern LogRing logRing;
+
+// Called after every record is queued - the firmware wakes its log task here
+extern void (*logConsumerWake)();
+
+// Queue a record. Returns false (and counts a drop) when the ring is full.
+bool logPush(LogRing &ring, const LogRecord &record);
+
+// Consumer: take the oldest record, false when the ring is empty
+bool logPop(LogRing &ring, LogRecord &record);
+
+// Consumer: format and print every queued record. Returns how many.
+uint32_t logDrain(LogRing &ring);
+
+template <typename T>
+inline uintptr_t logArg(T value)
+{
+  static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "Log arguments are integers or static strings");
+  return (uintptr_t)value;
+}
+
+inline uintptr_t logArg(const char *text)
+{
+  return (uintptr_t)text;
+}
+
+template <typename... Args>
+inline void logWrite(uint8_t level, const char *format, Args... args)
+{
+  static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "Too many log arguments");
+  LogRecord record = {format, level, {logArg(args)...}};
+  logPush(logRing, record);
+  if (logConsumerWake != nullptr)
+  {
+    logConsumerWake();
+  }
+}
+
+#if PELARBOJ_LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) logWrite(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+
+#if PELARBOJ_LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) logWrite(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+
+#if PELARBOJ_LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) logWrite(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
@@ -0,0 +1,73 @@
+#include "Oscillator.h"
+
+#include <string.h>
+
+// Taylor series for the table generator - only ever evaluated by the compiler,
+// on [0, PI/2] where 12 terms are exact to double precision
+static constexpr double constexprSin(double x)
+{
+  double term = x;
+  double sum = x;
+  for (int n = 1; n < 12; n++)
+  {
+    term *= -x * x / ((2 * n) * (2 * n + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+static constexpr SineTable buildSineQuarterWave()
+{
+  SineTable table = {};
+  for (int i = 0; i <= SINE_TABLE_SIZE; i++)
+  {
+    double angle = (3.14159265358979323846 / 2) * i / SINE_TABLE_SIZE;
+    table.values[i] = (int32_t)(constexprSin(angle) * 65536.0 + 0.5);
+  }
+  return table;
+}
+
+constexpr SineTable SINE_QUARTER_WAVE = buildSineQuarterWave();
+
+void oscillatorBankReset(OscillatorBank &bank)
+{
+  bank.count = 0;
+  bank.owner = -1;
+  bank.epoch = 0;
+}
+
+uint8_t oscillatorRegister(OscillatorBank &bank, const char *name, Phase step)
+{
+  if (bank.count >= MAX_OSCILLATORS)
+  {
+    return MAX_OSCILLATORS - 1; // Share the last slot rather than overrun the bank
+  }
+
+  Oscillator &oscillator = bank.oscillators[bank.count];
+  oscillator.name = name;
+  oscillator.phase = 0;
+  oscillator.step = step;
+  return bank.count++;
+}
+
+void oscillatorBankSeek(OscillatorBank &bank, uint32_t now)
+{
+  // Wrapping multiply: exact modulo one turn for any elapsed time
+  uint32_t elapsed = now - bank.epoch;
+  for (uint8_t i = 0; i < bank.count; i++)
+  {
+    bank.oscillators[i].phase = elapsed * bank.oscillators[i].step;
+  }
+}
+
+int oscillatorFind(const OscillatorBank &bank, const char *name)
+{
+  for (uint8_t i = 0; i < bank.count; i++)
+  {
+    if (strcmp(bank.oscillators[i].name, name) == 0)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "FixedPoint.h"
+
+// Oscillator subsystem: phases derived from the frame time and sampled through
+// a quarter-wave sine table, so the render path never calls libm.
+
+// Phases are 32-bit binary angles: 2^32 is one full turn, so phases wrap for
+// free and never lose precision however long an effect runs.
+typedef uint32_t Phase;
+
+constexpr double PHASE_UNITS_PER_RADIAN = 683565275.5764316; // 2^32 / (2 * PI)
+
+// Phase increment for a step given in radians (folds to a constant at compile time)
+constexpr Phase phaseStep(float radians)
+{
+  return (Phase)(int64_t)(radians * PHASE_UNITS_PER_RADIAN + 0.5);
+}
+
+// Quarter-wave sine table: 256 segments over [0, PI/2] plus the end point,
+// entries are Q16.16. Built at compile time and kept in flash.
+const int SINE_TABLE_BITS = 8;
+const int SINE_TABLE_SIZE = 1 << SINE_TABLE_BITS;
+
+struct SineTable
+{
+  int32_t values[SINE_TABLE_SIZE + 1];
+};
+
+extern const SineTable SINE_QUARTER_WAVE;
+
+// Sine of a phase as raw Q16.16, linearly interpolated (max error ~1.2e-5)
+inline int32_t sineRaw(Phase phase)
+{
+  uint32_t quadrant = phase >> 30;
+  uint32_t offset = phase & 0x3FFFFFFF;
+  if (quadrant & 1)
+  {
+    offset = 0x40000000 - offset; // Mirror the second and fourth quadrants
+  }
+
+  uint32_t index = offset >> (30 - SINE_TABLE_BITS);
+  int32_t fraction = (offset >> (14 - SINE_TABLE_BITS)) & 0xFFFF;
+  int32_t value = SINE_QUARTER_WAVE.values[index];
+  if (index < SINE_TABLE_SIZE)
+  {
+    int32_t next = SINE_QUARTER_WAVE.values[index + 1];
+    value += (int32_t)(((int64_t)(next - value) * fraction) >> 16);
+  }
+
+  return quadrant >= 2 ? -value : value;
+}
+
+template <typename Scalar>
+inline Scalar sineLookup(Phase phase)
+{
+  return scalarFromRaw<Scalar>(sineRaw(phase));
+}
+
+const uint8_t MAX_OSCILLATORS = 4;
+
+struct Oscillator
+{
+  const char *name; // For diagnostics; effects address oscillators by index
+  Phase phase;      // Phase at the last seek
+  Phase step;       // Phase advance per millisecond
+};
+
+// Oscillators registered by the running effect
+struct OscillatorBank
+{
+  Oscillator oscillators[MAX_OSCILLATORS];
+  uint8_t count;
+  int owner;      // Effect that registered the current set, -1 when empty
+  uint32_t epoch; // Time (ms) at which every oscillator was at phase 0
+};
+
+void oscillatorBankReset(OscillatorBank &bank);
+
+// Register an oscillator and return its index (oscillators start at phase 0)
+uint8_t oscillatorRegister(OscillatorBank &bank, const char *name, Phase step);
+
+// Move every oscillator to its phase at time now (ms, same clock as epoch).
+// Phases are a pure function of time: frames can be skipped or repeated and
+// the rate changed without the animation speeding up or slowing down.
+void oscillatorBankSeek(OscillatorBank &bank, uint32_t now);
+
+// Index of a named oscillator, or -1 if it is not registered
+int oscillatorFind(const OscillatorBank &bank, const char *name);
+
+template <typename Scalar>
+inline Scalar oscillatorSample(const OscillatorBank &bank, uint8_t index)
+{
+  return sineLookup<Scalar>(bank.oscillators[index].phase);
+}
@@ -0,0 +1,26 @@
+#include "OutputLut.h"
+
+// Relative luminance (0..1) for a CIE L* lightness (0..1)
+static constexpr double cieLightnessToLuminance(double lightness)
+{
+  if (lightness <= 0.08)
+  {
+    return lightness / 9.033;
+  }
+  double cubeRoot = (lightness + 0.16) / 1.16;
+  return cubeRoot * cubeRoot * cubeRoot;
+}
+
+static constexpr OutputLut buildOutputLut(int curve)
+{
+  OutputLut table = {};
+  for (int i = 0; i <= OUTPUT_LUT_SIZE; i++)
+  {
+    double input = (double)i / OUTPUT_LUT_SIZE;
+    double duty = curve == OUTPUT_CURVE_CIE_LSTAR ? cieLightnessToLuminance(input) : input;
+    table.values[i] = (uint16_t)(duty * (LED_PWM_MAX_VALUE << OUTPUT_LUT_FRACTION_BITS) + 0.5);
+  }
+  return table;
+}
+
+constexpr OutputLut OUTPUT_LUT = buildOutputLut(PELARBOJ_OUTPUT_CURVE);
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stdint.h>
+
+// Output stage lookup: maps the level onto a PWM duty cycle through a
+// perceptual curve, which each channel then scales in linear light. The table
+// is built at compile time and kept in flash; the per-frame path is integer
+// only.
+
+// LED PWM configuration
+#ifdef PELARBOJ_LIGHT_SLEEP
+// LEDC runs from RC_FAST (~17.5 MHz) to keep driving the LEDs through light
+// sleep, which caps 12-bit PWM just above 4 kHz
+const int LED_PWM_FREQUENCY = 4000; // 4 kHz PWM frequency for 12-bit resolution
+#else
+const int LED_PWM_FREQUENCY = 5000; // 5 kHz PWM frequency for 12-bit resolution
+#endif
+const int LED_PWM_RESOLUTION = 12;  // 12-bit resolution (0-4095)
+const int LED_PWM_MAX_VALUE = 4095; // Maximum PWM value for 12-bit
+
+enum OutputCurve
+{
+  OUTPUT_CURVE_LINEAR = 0,    // Duty proportional to input (the old behaviour)
+  OUTPUT_CURVE_CIE_LSTAR = 1, // Input is CIE L* lightness, duty is luminance
+};
+
+// Select with -DPELARBOJ_OUTPUT_CURVE=OUTPUT_CURVE_LINEAR
+#ifndef PELARBOJ_OUTPUT_CURVE
+#define PELARBOJ_OUTPUT_CURVE OUTPUT_CURVE_CIE_LSTAR
+#endif
+
+const int OUTPUT_LUT_BITS = 8;
+const int OUTPUT_LUT_SIZE = 1 << OUTPUT_LUT_BITS;
+const int OUTPUT_LUT_FRACTION_BITS = 4; // Entries keep 4 bits below one PWM step
+
+// Temporal dithering: bits of the table fraction carried into the PWM duty by
+// a per-channel sigma-delta residual, spread over dither steps between frames
+// (see ditherApplies()). 2 gives 14 effective bits, 3 gives 15 with a step
+// every millisecond. Off by default, as the steps keep the LED task awake.
+// Set per board with -DPELARBOJ_DITHER_BITS=n
+#ifndef PELARBOJ_DITHER_BITS
+#define PELARBOJ_DITHER_BITS 0
+#endif
+
+const int OUTPUT_DITHER_BITS = PELARBOJ_DITHER_BITS;
+static_assert(OUTPUT_DITHER_BITS >= 0 && OUTPUT_DITHER_BITS <= OUTPUT_LUT_FRACTION_BITS,
+              "PELARBOJ_DITHER_BITS must be between 0 and OUTPUT_LUT_FRACTION_BITS");
+
+// Intensities are Q16: 0 = off, 65536 = full level
+const uint32_t OUTPUT_INTENSITY_MAX = 65536;
+
+struct OutputLut
+{
+  uint16_t values[OUTPUT_LUT_SIZE + 1]; // PWM duty << OUTPUT_LUT_FRACTION_BITS
+};
+
+extern const OutputLut OUTPUT_LUT;
+
+// Duty cycle with OUTPUT_LUT_FRACTION_BITS of fraction, linearly interpolated
+inline uint32_t outputLookupFine(uint32_t intensity)
+{
+  if (intensity >= OUTPUT_INTENSITY_MAX)
+  {
+    return OUTPUT_LUT.values[OUTPUT_LUT_SIZE];
+  }
+
+  uint32_t index = intensity >> (16 - OUTPUT_LUT_BITS);
+  uint32_t fraction = intensity & ((1 << (16 - OUTPUT_LUT_BITS)) - 1);
+  uint32_t low = OUTPUT_LUT.values[index];
+  uint32_t high = OUTPUT_LUT.values[index + 1];
+  return low + (((high - low) * fraction) >> (16 - OUTPUT_LUT_BITS));
+}
+
+// Fine duty rounded to the nearest PWM step
+inline uint16_t outputRound(uint32_t fine)
+{
+  return (uint16_t)((fine + (1 << (OUTPUT_LUT_FRACTION_BITS - 1))) >> OUTPUT_LUT_FRACTION_BITS);
+}
+
+// 12-bit duty cycle, rounded
+inline uint16_t outputLookup(uint32_t intensity)
+{
+  return outputRound(outputLookupFine(intensity));
+}
+
+// level / 255 as a Q16 intensity; level is 0..255 in Q16.16
+inline uint32_t outputIntensity(uint32_t level)
+{
+  return level / 255;
+}
+
+// A fine duty scaled by a linear channel (0..255 in Q16.16): fine * channel / 255
+inline uint32_t outputScale(uint32_t fine, uint32_t channel)
+{
+  // Fine duties stay below 2^16 and the Q8 channel at 255 << 8, so the product fits 32 bits
+  return fine * (channel >> 8) / (255 << 8);
+}
+
+// One sigma-delta step: the fine duty rounded to OUTPUT_DITHER_BITS of
+// fraction, plus the residual the previous frames left behind. Emits the whole
+// steps and keeps the rest, so the average duty over 2^OUTPUT_DITHER_BITS
+// frames is the fine duty. Fixed cost, no branches.
+inline uint16_t outputDither(uint32_t fine, uint16_t &residual)
+{
+  const int drop = OUTPUT_LUT_FRACTION_BITS - OUTPUT_DITHER_BITS;
+  uint32_t value = ((fine + ((1 << drop) >> 1)) >> drop) + residual;
+  // fine tops out at LED_PWM_MAX_VALUE whole steps, so value >> bits does too
+  residual = (uint16_t)(value & ((1 << OUTPUT_DITHER_BITS) - 1));
+  return (uint16_t)(value >> OUTPUT_DITHER_BITS);
+}
+
+// The part of a fine duty below one PWM step, rounded to OUTPUT_DITHER_BITS:
+// zero when dithering it would show the same as rounding
+inline uint32_t outputDitherFraction(uint32_t fine)
+{
+  const int drop = OUTPUT_LUT_FRACTION_BITS - OUTPUT_DITHER_BITS;
+  return ((fine + ((1 << drop) >> 1)) >> drop) & ((1 << OUTPUT_DITHER_BITS) - 1);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+// Platform layer shared by the firmware and the host (native) builds.
+// On the device this is just Arduino + FreeRTOS. On the host it provides a thin
+// shim with a virtual clock, a deterministic random() and no-op critical
+// sections so the render path can be exercised without a board.
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// CPU cycles, for timing short stretches of the render path
+inline uint32_t cpuCycleCount()
+{
+  return ESP.getCycleCount();
+}
+
+#else // Host build
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+
+using std::max;
+using std::min;
+
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Virtual clock - only advances when the host code says so
+unsigned long millis();
+unsigned long micros();
+void hostSetMillis(unsigned long ms);
+void hostAdvanceMillis(unsigned long ms);
+
+// Cycle counter of a nominal 1000 MHz CPU: real nanoseconds on the host
+uint32_t cpuCycleCount();
+uint32_t getCpuFrequencyMhz();
+
+// Arduino-compatible random() backed by a deterministic generator
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+class HostSerial
+{
+public:
+  bool muted = false; // Benchmarks mute the log output of the render path
+
+  int printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  size_t println(const char *text);
+};
+
+extern HostSerial Serial;
+
+// Minimal FreeRTOS surface used by the render path
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdPASS pdTRUE
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+// Critical sections are a plain spinlock on the host, so threaded tests
+// still get mutual exclusion between writers
+typedef std::atomic_flag portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED ATOMIC_FLAG_INIT
+void portENTER_CRITICAL(portMUX_TYPE *mux);
+void portEXIT_CRITICAL(portMUX_TYPE *mux);
+
+void vTaskDelay(TickType_t ticks); // Advances the virtual clock
+
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "FixedPoint.h"
+
+// Effect random streams: a 32-bit PCG generator (RXS-M-XS output) owned by
+// each effect instance instead of the shared Arduino random(). A draw is a
+// multiply-add and an output permutation, and a stream depends on nothing but
+// its seed, so any run can be replayed bit-exact on the host.
+
+struct Prng
+{
+  uint32_t state;
+};
+
+const uint32_t PRNG_MULTIPLIER = 747796405u;
+const uint32_t PRNG_INCREMENT = 2891336453u;
+
+inline uint32_t prngNext(Prng &prng)
+{
+  uint32_t state = prng.state;
+  prng.state = state * PRNG_MULTIPLIER + PRNG_INCREMENT;
+  uint32_t word = ((state >> ((state >> 28) + 4)) ^ state) * 277803737u;
+  return (word >> 22) ^ word;
+}
+
+// Any seed is valid, zero included
+inline void prngSeed(Prng &prng, uint32_t seed)
+{
+  prng.state = 0;
+  prngNext(prng);
+  prng.state += seed;
+  prngNext(prng);
+}
+
+// Seed of an independent stream derived from a parent seed, e.g. one per
+// effect started in a slot (murmur3 finalizer, so neighbouring streams differ
+// in every bit)
+inline uint32_t prngStreamSeed(uint32_t seed, uint32_t stream)
+{
+  uint32_t hash = seed ^ (stream * 0x9E3779B9u);
+  hash = (hash ^ (hash >> 16)) * 0x85EBCA6Bu;
+  hash = (hash ^ (hash >> 13)) * 0xC2B2AE35u;
+  return hash ^ (hash >> 16);
+}
+
+// Uniform integer in [low, high), like random(low, high); low when the range
+// is empty. Multiply-high instead of a modulo: no division, no bias beyond
+// 2^-32.
+inline int32_t prngRange(Prng &prng, int32_t low, int32_t high)
+{
+  if (high <= low)
+  {
+    return low;
+  }
+  uint32_t span = (uint32_t)(high - low);
+  return low + (int32_t)(((uint64_t)prngNext(prng) * span) >> 32);
+}
+
+// Uniform scalar in [0, 1), at Q16.16 resolution on both engines
+template <typename Scalar>
+inline Scalar prngUnit(Prng &prng)
+{
+  return scalarFromRaw<Scalar>((int32_t)(prngNext(prng) >> 16));
+}
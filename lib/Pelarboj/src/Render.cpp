@@ -0,0 +1,525 @@
+#include "Render.h"
+
+#include "Log.h"
+
+LightState lightState = {
+    // Initialize base values
+    RenderScalar(0), RenderScalar(0), RenderScalar(0), // base RGB
+    RenderScalar(0),                                   // base level
+    false,                                             // base state
+
+    // Initialize target values
+    0, 0, 0, // target RGB
+    255,     // target level
+    false,   // target state
+
+    // Initialize the transition (none running)
+    RenderScalar(0), RenderScalar(0), RenderScalar(0), RenderScalar(0), // from RGB and level
+    RenderScalar(0), RenderScalar(0), RenderScalar(0), RenderScalar(0), // slopes
+    0,                                                                 // transitionMs
+    0,                                                                 // transitionElapsed
+
+    // Initialize final values
+    RenderScalar(0), RenderScalar(0), RenderScalar(0), // final RGB
+    RenderScalar(0),                                   // final level
+
+    // Initialize special modes
+    MODE_NORMAL,                                       // specialMode
+    0,                                                 // modeStartTime
+    0,                                                 // blinkCount
+    0,                                                 // lastBlinkTime
+    false,                                             // blinkOn
+    RenderScalar(0), RenderScalar(0), RenderScalar(0), // savedR, savedG, savedB
+    EFFECT_NONE,                                       // savedEffect
+    false                                              // statusLedOn
+};
+
+void frameClockAdvance(FrameClock &clock, uint32_t now)
+{
+  clock.dt = min(now - clock.now, MAX_FRAME_DT_MS);
+  clock.now = now;
+}
+
+const Phase RESET_BLINK_STEP_PER_MS = phaseStep(0.006283f);  // 2*PI/1000 for 1Hz
+const Phase EFFECT_BLINK_STEP_PER_MS = phaseStep(0.012566f); // 2*PI/500 for 2Hz
+
+template <typename Scalar>
+static bool baseSettled(const LightStateT<Scalar> &light)
+{
+  return light.base_r == workingChannel<Scalar>(light.target_r) &&
+         light.base_g == workingChannel<Scalar>(light.target_g) &&
+         light.base_b == workingChannel<Scalar>(light.target_b) && light.base_level == Scalar(light.target_level);
+}
+
+// Cubic Hermite from `from` (leaving at slope) to target (arriving at rest) at
+// progress u: the smoothstep plus the carried-over speed, which dies out
+// as u(1 - u)^2. Clamped: after a reversal the base first carries on a little
+// the old way, which may run into the channel range.
+template <typename Scalar>
+static Scalar easedChannel(Scalar from, Scalar slope, Scalar target, Scalar u)
+{
+  Scalar rest = Scalar(1) - u;
+  Scalar value = from + (target - from) * (u * u * (Scalar(3) - Scalar(2) * u)) + slope * (u * rest * rest);
+  return constrain(value, Scalar(0), Scalar(255));
+}
+
+// Slope of the running curve at progress u, rescaled from a transition of
+// fromMs to one of toMs so the base keeps its speed in units per ms. Heading
+// toward the new target, at most three times the distance left (faster would
+// overshoot it); reversing, at most TRANSITION_MAX_SLOPE.
+template <typename Scalar>
+static Scalar carriedSlope(Scalar from, Scalar slope, Scalar oldTarget, Scalar u, uint32_t fromMs, uint32_t toMs,
+                           Scalar base, Scalar newTarget)
+{
+  Scalar rest = Scalar(1) - u;
+  Scalar velocity = Scalar(6) * u * rest * (oldTarget - from) + rest * (Scalar(1) - Scalar(3) * u) * slope;
+  int64_t scaled = (int64_t)scalarToRaw(velocity) * toMs / fromMs;
+  int64_t distance = 3 * (int64_t)scalarToRaw(newTarget - base);
+  int64_t limit = (int64_t)TRANSITION_MAX_SLOPE << 16;
+  int64_t low = distance < 0 ? distance : -limit;
+  int64_t high = distance > 0 ? distance : limit;
+  return scalarFromRaw<Scalar>((int32_t)constrain(scaled, low, high));
+}
+
+template <typename Scalar>
+void advanceBase(LightStateT<Scalar> &light, uint32_t ms)
+{
+  light.transitionElapsed += min(ms, light.transitionMs - light.transitionElapsed);
+  if (light.transitionElapsed >= light.transitionMs)
+  {
+    // Done (or instant): exactly on the targets, so the scheduler can idle
+    light.base_r = workingChannel<Scalar>(light.target_r);
+    light.base_g = workingChannel<Scalar>(light.target_g);
+    light.base_b = workingChannel<Scalar>(light.target_b);
+    light.base_level = Scalar(light.target_level);
+    return;
+  }
+
+  Scalar u = scalarRatio<Scalar>(light.transitionElapsed, light.transitionMs);
+  light.base_r = easedChannel(light.from_r, light.slope_r, workingChannel<Scalar>(light.target_r), u);
+  light.base_g = easedChannel(light.from_g, light.slope_g, workingChannel<Scalar>(light.target_g), u);
+  light.base_b = easedChannel(light.from_b, light.slope_b, workingChannel<Scalar>(light.target_b), u);
+  light.base_level = easedChannel(light.from_level, light.slope_level, Scalar(light.target_level), u);
+}
+
+template <typename Scalar>
+void renderFrame(LightStateT<Scalar> &light, EffectStateT<Scalar> &effect, const FrameClock &clock)
+{
+  // Check special modes first
+  if (light.specialMode == MODE_RESET_BLINKING)
+  {
+    uint32_t elapsed = clock.now - light.modeStartTime;
+
+    // Slow pulsation during reset (1Hz pulse, 30%-100% range)
+    Scalar pulse = (sineLookup<Scalar>(elapsed * RESET_BLINK_STEP_PER_MS) + Scalar(1)) * Scalar(0.5f);
+    Scalar level = Scalar(0.3f) + (pulse * Scalar(0.7f)); // 30% to 100% range
+
+    light.final_r = Scalar(255);
+    light.final_g = Scalar(0);
+    light.final_b = Scalar(0);
+    light.final_level = level * Scalar(255);
+
+    // Also pulse built-in LED
+    light.statusLedOn = pulse > Scalar(0.5f);
+  }
+  else if (light.specialMode == MODE_EFFECT_BLINKING)
+  {
+    uint32_t elapsed = clock.now - light.modeStartTime;
+
+    // Fast pulsation for effect indication (2Hz pulse, 30%-100% range)
+    Scalar pulse = (sineLookup<Scalar>(elapsed * EFFECT_BLINK_STEP_PER_MS) + Scalar(1)) * Scalar(0.5f);
+    Scalar level = Scalar(0.3f) + (pulse * Scalar(0.7f)); // 30% to 100% range
+
+    // Use saved current color
+    light.final_r = light.savedR;
+    light.final_g = light.savedG;
+    light.final_b = light.savedB;
+    light.final_level = level * Scalar(255);
+
+    // Count pulses instead of discrete blinks
+    uint32_t pulseCount = elapsed / 500; // One complete pulse cycle every 500ms
+    if (pulseCount >= light.blinkCount)
+    {
+      LOG_INFO("Pulse mode finished, restoring effect: %d\n", light.savedEffect);
+      light.specialMode = MODE_NORMAL;
+      effect.type = light.savedEffect; // Restore effect
+    }
+  }
+  else
+  {
+    // Normal operation
+    // Smooth interpolation toward target values (creates base color)
+    advanceBase(light, clock.dt);
+    light.base_state = light.target_state;
+
+    // Skip effect calculations when light is off for better performance
+    if (light.base_state)
+    {
+      // Apply effects to base values to get final values
+      FrameContextT<Scalar> frame = {clock.now,    clock.dt,     light.base_r, light.base_g, light.base_b,
+                                     light.base_level, {light.target_r, light.target_g, light.target_b}};
+      applyEffects(effect, frame, light.final_r, light.final_g, light.final_b, light.final_level);
+    }
+    else
+    {
+      // Light is off - just copy base values to final (no effects processing)
+      light.final_r = light.base_r;
+      light.final_g = light.base_g;
+      light.final_b = light.base_b;
+      light.final_level = light.base_level;
+    }
+  }
+}
+
+template <typename Scalar>
+uint32_t renderFrameInterval(const LightStateT<Scalar> &light, const EffectStateT<Scalar> &effect,
+                             const FrameClock &clock)
+{
+  if (light.specialMode != MODE_NORMAL || !baseSettled(light))
+  {
+    return LED_UPDATE_RATE_MS;
+  }
+  if (!light.base_state)
+  {
+    return FRAME_INTERVAL_IDLE; // Off and settled - the output stays black
+  }
+
+  uint32_t interval = effectFrameInterval(effect, clock.now);
+  if (interval == EFFECT_FRAME_STATIC)
+  {
+    return FRAME_INTERVAL_IDLE;
+  }
+  return max(interval, (uint32_t)LED_UPDATE_RATE_MS);
+}
+
+template <typename Scalar>
+bool hardwareFadeApplies(const LightStateT<Scalar> &light, const EffectStateT<Scalar> &effect)
+{
+  return light.specialMode == MODE_NORMAL && light.target_state && light.base_state == light.target_state &&
+         effect.type == EFFECT_NONE && light.transitionElapsed < light.transitionMs && !baseSettled(light);
+}
+
+// PWM duty the software transition shows ms from now
+template <typename Scalar>
+static PwmOutput fadeOutputAt(const LightStateT<Scalar> &light, uint32_t ms)
+{
+  LightStateT<Scalar> ahead = light;
+  applyHardwareFade(ahead, ms);
+  return computeOutput(ahead);
+}
+
+static bool withinFadeTolerance(uint16_t actual, uint16_t start, uint16_t end, uint32_t part, uint32_t parts)
+{
+  int32_t linear = start + ((int32_t)end - start) * (int32_t)part / (int32_t)parts;
+  int32_t deviation = (int32_t)actual - linear;
+  return deviation <= FADE_MAX_DEVIATION && deviation >= -FADE_MAX_DEVIATION;
+}
+
+template <typename Scalar>
+uint32_t planFadeSegment(const LightStateT<Scalar> &light, PwmOutput &end)
+{
+  PwmOutput start = fadeOutputAt(light, 0);
+  uint32_t length = min(FADE_SEGMENT_MAX_MS, light.transitionMs - light.transitionElapsed);
+  for (; length > FADE_SEGMENT_MIN_MS; length /= 2)
+  {
+    // Check the line against the curve at the quarter points
+    end = fadeOutputAt(light, length);
+    bool straight = true;
+    for (uint32_t part = 1; part < 4 && straight; part++)
+    {
+      PwmOutput curve = fadeOutputAt(light, length * part / 4);
+      straight = withinFadeTolerance(curve.r, start.r, end.r, part, 4) &&
+                 withinFadeTolerance(curve.g, start.g, end.g, part, 4) &&
+                 withinFadeTolerance(curve.b, start.b, end.b, part, 4);
+    }
+    if (straight)
+    {
+      return length;
+    }
+  }
+  end = fadeOutputAt(light, length);
+  return length;
+}
+
+template <typename Scalar>
+void applyHardwareFade(LightStateT<Scalar> &light, uint32_t ms)
+{
+  advanceBase(light, ms);
+  light.final_r = light.base_r; // EFFECT_NONE: final = base
+  light.final_g = light.base_g;
+  light.final_b = light.base_b;
+  light.final_level = light.base_level;
+}
+
+template <typename Scalar>
+void applyTargets(LightStateT<Scalar> &light, const LightTargets &targets)
+{
+  light.target_state = targets.state;
+  if (targets.r == light.target_r && targets.g == light.target_g && targets.b == light.target_b &&
+      targets.level == light.target_level)
+  {
+    return; // Same color and level: the running transition carries on
+  }
+
+  // Retarget from where the base is, at the speed it is moving
+  bool moving = light.transitionElapsed < light.transitionMs;
+  uint32_t durationMs = min(targets.transitionMs, TRANSITION_MAX_MS);
+  if (moving && durationMs > 0)
+  {
+    Scalar u = scalarRatio<Scalar>(light.transitionElapsed, light.transitionMs);
+    uint32_t fromMs = light.transitionMs;
+    light.slope_r = carriedSlope(light.from_r, light.slope_r, workingChannel<Scalar>(light.target_r), u, fromMs,
+                                 durationMs, light.base_r, workingChannel<Scalar>(targets.r));
+    light.slope_g = carriedSlope(light.from_g, light.slope_g, workingChannel<Scalar>(light.target_g), u, fromMs,
+                                 durationMs, light.base_g, workingChannel<Scalar>(targets.g));
+    light.slope_b = carriedSlope(light.from_b, light.slope_b, workingChannel<Scalar>(light.target_b), u, fromMs,
+                                 durationMs, light.base_b, workingChannel<Scalar>(targets.b));
+    light.slope_level = carriedSlope(light.from_level, light.slope_level, Scalar(light.target_level), u, fromMs,
+                                     durationMs, light.base_level, Scalar(targets.level));
+  }
+  else
+  {
+    light.slope_r = light.slope_g = light.slope_b = light.slope_level = Scalar(0);
+  }
+  light.from_r = light.base_r;
+  light.from_g = light.base_g;
+  light.from_b = light.base_b;
+  light.from_level = light.base_level;
+  light.transitionMs = durationMs;
+  light.transitionElapsed = 0;
+
+  light.target_r = targets.r;
+  light.target_g = targets.g;
+  light.target_b = targets.b;
+  light.target_level = targets.level;
+}
+
+template <typename Scalar>
+static void switchToNextEffect(EffectStateT<Scalar> &effect, uint32_t now)
+{
+  effectStart(effect, (EffectType)((effect.type + 1) % MAX_EFFECT_NUMBER), now);
+
+  LOG_INFO("Switched to effect: %d %s\n", effect.type, effectName(effect.type));
+}
+
+template <typename Scalar>
+static void blinkEffectNumber(LightStateT<Scalar> &light, EffectStateT<Scalar> &effect, uint8_t effectNum,
+                              uint32_t now)
+{
+  // Save current state
+  light.savedR = light.final_r;
+  light.savedG = light.final_g;
+  light.savedB = light.final_b;
+  light.savedEffect = effect.type;
+
+  // Start effect blinking mode
+  light.specialMode = MODE_EFFECT_BLINKING;
+  light.modeStartTime = now;
+  light.blinkCount = effectNum; // Number of complete pulse cycles
+  light.lastBlinkTime = now;
+  light.blinkOn = true;
+
+  // Temporarily disable effects
+  effect.type = EFFECT_NONE;
+
+  LOG_INFO("Starting blink mode: %d blinks (count=%d)\n", effectNum, light.blinkCount);
+}
+
+template <typename Scalar>
+void applyControlEvent(LightStateT<Scalar> &light, EffectStateT<Scalar> &effect, const ControlEvent &event,
+                       uint32_t now)
+{
+  switch (event.type)
+  {
+  case CONTROL_NEXT_EFFECT:
+    switchToNextEffect(effect, now);
+    // Blink the effect number (1-11) instead of enum value (0-10)
+    blinkEffectNumber(light, effect, effect.type + 1, now);
+    break;
+
+  case CONTROL_RESET_START:
+    light.specialMode = MODE_RESET_BLINKING;
+    light.modeStartTime = now;
+    break;
+
+  case CONTROL_RESET_CANCEL:
+    light.specialMode = MODE_NORMAL;
+    break;
+
+  case CONTROL_RESET_BLANK:
+    light.specialMode = MODE_NORMAL;
+    light.final_r = Scalar(0);
+    light.final_g = Scalar(0);
+    light.final_b = Scalar(0);
+    light.final_level = Scalar(0);
+    break;
+  }
+}
+
+// Final value as Q16.16, clamped to the 0-255 channel range
+template <typename Scalar>
+static uint32_t channelRaw(Scalar value)
+{
+  return (uint32_t)constrain(scalarToRaw(value), (int32_t)0, (int32_t)(255 << 16));
+}
+
+// Duty cycles with OUTPUT_LUT_FRACTION_BITS of fraction, before rounding or dithering
+template <typename Scalar>
+static PwmOutput computeOutputFine(const LightStateT<Scalar> &light)
+{
+  // In special modes, ignore base_state and use final values directly
+  if (light.specialMode == MODE_NORMAL && !light.base_state)
+  {
+    PwmOutput off = {0, 0, 0};
+    return off;
+  }
+
+  // Integer from here on: the level through the perceptual table, then each
+  // channel's share of it in linear light. Working colors are normalized when
+  // a command arrives, so nothing is rescaled per frame.
+  uint32_t duty = outputLookupFine(outputIntensity(channelRaw(light.final_level)));
+  PwmOutput fine = {(uint16_t)outputScale(duty, channelRaw(light.final_r)),
+                    (uint16_t)outputScale(duty, channelRaw(light.final_g)),
+                    (uint16_t)outputScale(duty, channelRaw(light.final_b))};
+  return fine;
+}
+
+static PwmOutput roundOutput(const PwmOutput &fine)
+{
+  PwmOutput pwm = {outputRound(fine.r), outputRound(fine.g), outputRound(fine.b)};
+  return pwm;
+}
+
+static PwmOutput ditherOutput(const PwmOutput &fine, DitherState &dither)
+{
+  PwmOutput pwm = {outputDither(fine.r, dither.residual[0]), outputDither(fine.g, dither.residual[1]),
+                   outputDither(fine.b, dither.residual[2])};
+  return pwm;
+}
+
+template <typename Scalar>
+PwmOutput computeOutput(const LightStateT<Scalar> &light)
+{
+  return roundOutput(computeOutputFine(light));
+}
+
+template <typename Scalar>
+PwmOutput computeOutputDithered(const LightStateT<Scalar> &light, DitherState &dither)
+{
+  return ditherOutput(computeOutputFine(light), dither);
+}
+
+void ledTaskStart(LedTaskState &task, uint32_t now)
+{
+  LedTaskState start = {{now, 0}, 0, false, 0, false, 0, {0, 0, 0}, {0, 0, 0}, {{0, 0, 0}}};
+  task = start;
+}
+
+template <typename Scalar>
+LedFrame ledTaskFrame(LedTaskState &task, LightStateT<Scalar> &light, EffectStateT<Scalar> &effect,
+                      const TargetMailbox &mailbox, ControlQueue &queue, uint32_t now, bool hardwareFades)
+{
+  LedFrame frame = {{0, 0, 0}, 0, false, false, false, false};
+
+  // Between the frames of dithered output: the next step of the pattern on the
+  // last frame's duty, unless new targets or events want a frame now
+  if (task.dithering && (int32_t)(task.renderDue - now) > 0 && !targetMailboxPending(mailbox, task.targetSequence) &&
+      !controlQueuePending(queue))
+  {
+    frame.pwm = ditherOutput(task.fine, task.dither);
+    frame.hold = frame.pwm.r == task.shown.r && frame.pwm.g == task.shown.g && frame.pwm.b == task.shown.b;
+    frame.wait = min(DITHER_STEP_MS, task.renderDue - now);
+    task.shown = frame.pwm;
+    return frame;
+  }
+  task.dithering = false;
+
+  // The one clock read of the frame - effects are functions of it
+  frameClockAdvance(task.clock, now);
+  if (task.fading)
+  {
+    // The LEDC has been fading while the task slept - catch the base up
+    applyHardwareFade(light, task.clock.now - task.fadeStart);
+    task.clock.dt = 0;
+    task.fading = false;
+  }
+
+  // Pick up the latest Hue targets and pending button events - never blocks
+  LightTargets targets;
+  if (targetMailboxRead(mailbox, task.targetSequence, targets))
+  {
+    applyTargets(light, targets);
+    frame.changed = true;
+  }
+  else if (targetMailboxPending(mailbox, task.targetSequence))
+  {
+    frame.mailboxRetry = true;
+  }
+  ControlEvent event;
+  while (controlQueuePop(queue, event))
+  {
+    applyControlEvent(light, effect, event, task.clock.now);
+    frame.changed = true;
+  }
+
+  if (hardwareFades && hardwareFadeApplies(light, effect))
+  {
+    // Plain transition: the next segment runs on the fade engine
+    frame.wait = planFadeSegment(light, frame.pwm);
+    frame.fade = true;
+    task.fading = true;
+    task.fadeStart = task.clock.now;
+    return frame;
+  }
+
+  renderFrame(light, effect, task.clock);
+
+  // Wait as long as the output allows; new targets and control events
+  // notify the task and end the wait early
+  frame.wait = renderFrameInterval(light, effect, task.clock);
+
+  // Dim animated output gets the sub-step part of the duty through dither
+  // steps until the next frame is due; everything else is rounded
+  PwmOutput fine = computeOutputFine(light);
+  if (ditherApplies(frame.wait, fine))
+  {
+    task.dithering = true;
+    task.renderDue = task.clock.now + frame.wait;
+    task.fine = fine;
+    frame.pwm = ditherOutput(fine, task.dither);
+    frame.wait = DITHER_STEP_MS;
+  }
+  else
+  {
+    frame.pwm = roundOutput(fine);
+  }
+  task.shown = frame.pwm;
+  return frame;
+}
+
+template void renderFrame<float>(LightStateT<float> &, EffectStateT<float> &, const FrameClock &);
+template void renderFrame<Fix16>(LightStateT<Fix16> &, EffectStateT<Fix16> &, const FrameClock &);
+template uint32_t renderFrameInterval<float>(const LightStateT<float> &, const EffectStateT<float> &,
+                                             const FrameClock &);
+template uint32_t renderFrameInterval<Fix16>(const LightStateT<Fix16> &, const EffectStateT<Fix16> &,
+                                             const FrameClock &);
+template void advanceBase<float>(LightStateT<float> &, uint32_t);
+template void advanceBase<Fix16>(LightStateT<Fix16> &, uint32_t);
+template bool hardwareFadeApplies<float>(const LightStateT<float> &, const EffectStateT<float> &);
+template bool hardwareFadeApplies<Fix16>(const LightStateT<Fix16> &, const EffectStateT<Fix16> &);
+template uint32_t planFadeSegment<float>(const LightStateT<float> &, PwmOutput &);
+template uint32_t planFadeSegment<Fix16>(const LightStateT<Fix16> &, PwmOutput &);
+template void applyHardwareFade<float>(LightStateT<float> &, uint32_t);
+template void applyHardwareFade<Fix16>(LightStateT<Fix16> &, uint32_t);
+template void applyTargets<float>(LightStateT<float> &, const LightTargets &);
+template void applyTargets<Fix16>(LightStateT<Fix16> &, const LightTargets &);
+template void applyControlEvent<float>(LightStateT<float> &, EffectStateT<float> &, const ControlEvent &, uint32_t);
+template void applyControlEvent<Fix16>(LightStateT<Fix16> &, EffectStateT<Fix16> &, const ControlEvent &, uint32_t);
+template PwmOutput computeOutput<float>(const LightStateT<float> &);
+template PwmOutput computeOutput<Fix16>(const LightStateT<Fix16> &);
+template PwmOutput computeOutputDithered<float>(const LightStateT<float> &, DitherState &);
+template PwmOutput computeOutputDithered<Fix16>(const LightStateT<Fix16> &, DitherState &);
+template LedFrame ledTaskFrame<float>(LedTaskState &, LightStateT<float> &, EffectStateT<float> &,
+                                      const TargetMailbox &, ControlQueue &, uint32_t, bool);
+template LedFrame ledTaskFrame<Fix16>(LedTaskState &, LightStateT<Fix16> &, EffectStateT<Fix16> &,
+                                      const TargetMailbox &, ControlQueue &, uint32_t, bool);
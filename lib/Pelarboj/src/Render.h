@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Effects.h"
+#include "OutputLut.h"
+#include "StateHandoff.h"
+
+const int LED_UPDATE_RATE_MS = 20;                // 50 FPS update rate
+const uint32_t MAX_FRAME_DT_MS = 100;             // Longer gaps between frames count as this much
+const uint32_t FRAME_INTERVAL_IDLE = 0xFFFFFFFF;  // Nothing to render until the LED task is woken
+const uint32_t FADE_SEGMENT_MIN_MS = 20;          // Shortest hardware fade segment, one software frame
+const uint32_t FADE_SEGMENT_MAX_MS = 640;         // Longest hardware fade segment (MIN_MS * 2^n)
+const int32_t FADE_MAX_DEVIATION = 16;            // PWM LSB a fade segment may stray from the transition curve
+const uint32_t DITHER_MAX_PATTERN_MS = 8;         // Longest dither pattern, well above flicker fusion (125 Hz)
+const uint32_t DITHER_MAX_DUTY = 512;             // Dimmest duty (PWM steps) left undithered, one step is under 0.2%
+const int32_t TRANSITION_MAX_SLOPE = 255;         // Fastest carried-over start of a reversed transition (units per transition)
+
+// Special modes for LED control
+enum SpecialMode
+{
+  MODE_NORMAL = 0,
+  MODE_RESET_BLINKING = 1,
+  MODE_EFFECT_BLINKING = 2
+};
+
+// Light state structure with current and target values
+template <typename Scalar>
+struct LightStateT
+{
+  // Base values (from Hue coordinator - the foundation for effects)
+  Scalar base_r, base_g, base_b; // Base linear RGB values (0.0-255.0)
+  Scalar base_level;             // Base brightness level (0.0-255.0)
+  bool base_state;               // Base on/off state
+
+  // Target values (set by Hue commands - interpolated to base)
+  uint16_t target_r, target_g, target_b; // Target working color (ColorSpace.h, 0-65535 linear)
+  uint8_t target_level;                  // Target brightness level (0-255)
+  bool target_state;                     // Target on/off state
+
+  // Transition from the base at the last retarget to the targets
+  Scalar from_r, from_g, from_b, from_level;     // Base when the transition started
+  Scalar slope_r, slope_g, slope_b, slope_level; // Speed it started with, in units per whole transition
+  uint32_t transitionMs;                         // Commanded duration
+  uint32_t transitionElapsed;                    // Time into the transition, at most transitionMs
+
+  // Final output values (base + effects - sent to LEDs)
+  Scalar final_r, final_g, final_b; // Final RGB after effects (0.0-255.0)
+  Scalar final_level;               // Final brightness after effects (0.0-255.0)
+
+  // Special modes
+  SpecialMode specialMode;       // Current special mode
+  uint32_t modeStartTime;        // When special mode started
+  uint8_t blinkCount;            // Number of blinks remaining (for effect blinking)
+  uint32_t lastBlinkTime;        // Last blink toggle time
+  bool blinkOn;                  // Current blink state
+  Scalar savedR, savedG, savedB; // Saved current color for blinking
+  EffectType savedEffect;        // Saved effect type during blinking
+  bool statusLedOn;              // Built-in LED state while reset blinking
+};
+
+typedef LightStateT<RenderScalar> LightState;
+
+extern LightState lightState;
+
+// 12-bit duty cycles for the three LED channels
+struct PwmOutput
+{
+  uint16_t r, g, b;
+};
+
+// Sigma-delta residuals carried from one dither step to the next, one per channel
+struct DitherState
+{
+  uint16_t residual[3];
+};
+
+// Frame clock: the render loop reads millis() once per frame and everything
+// in the frame works from this
+struct FrameClock
+{
+  uint32_t now; // Frame timestamp (ms)
+  uint32_t dt;  // Time since the previous frame (ms), at most MAX_FRAME_DT_MS
+};
+
+// Start a new frame at time now
+void frameClockAdvance(FrameClock &clock, uint32_t now);
+
+// Working color channel (0-65535) on the 0-255 scale of the base and the
+// effects, exact on both engines: 65536 / 257 = 255 + 1/257
+template <typename Scalar>
+inline Scalar workingChannel(uint16_t value)
+{
+  return scalarFromRaw<Scalar>((int32_t)value * 255 + value / 257);
+}
+
+// Move the base ms further along its transition. The curve is a function of
+// the time into the transition, so the base arrives exactly transitionMs
+// after the command whatever the frame rate: a cubic that starts at the speed
+// the base already had (zero from rest, where it is a smoothstep) and eases
+// into the targets without overshooting them.
+template <typename Scalar>
+void advanceBase(LightStateT<Scalar> &light, uint32_t ms);
+
+// Advance one frame: special modes, base interpolation toward the targets and
+// effects. Writes the final_* values; the LED task owns both states.
+template <typename Scalar>
+void renderFrame(LightStateT<Scalar> &light, EffectStateT<Scalar> &effect, const FrameClock &clock);
+
+// How long the LED task may wait before the next frame (ms), or
+// FRAME_INTERVAL_IDLE when the output is static and only a new target or a
+// control event can change it. Full rate while blinking or while the base
+// moves toward its targets, the effect's own rate otherwise.
+template <typename Scalar>
+uint32_t renderFrameInterval(const LightStateT<Scalar> &light, const EffectStateT<Scalar> &effect,
+                             const FrameClock &clock);
+
+// Hardware fades. A plain transition - normal mode, light on, EFFECT_NONE,
+// base still moving - needs no per-frame work: the LED task hands it to the
+// LEDC fade engine as a few linear segments that follow the interpolation
+// curve, and sleeps through each one.
+template <typename Scalar>
+bool hardwareFadeApplies(const LightStateT<Scalar> &light, const EffectStateT<Scalar> &effect);
+
+// Next segment from now: the longest (halving from FADE_SEGMENT_MAX_MS, and
+// never past the end of the transition) whose straight line stays within
+// FADE_MAX_DEVIATION of the software transition. Returns its length in ms and
+// the duty it ends on.
+template <typename Scalar>
+uint32_t planFadeSegment(const LightStateT<Scalar> &light, PwmOutput &end);
+
+// Account for ms of hardware fade: base and final values catch up with what
+// the LEDC has been showing
+template <typename Scalar>
+void applyHardwareFade(LightStateT<Scalar> &light, uint32_t ms);
+
+// Copy a snapshot received through the target mailbox into the light state.
+// New targets start a transition of targets.transitionMs from where the base
+// is, at the speed it is moving, so a command arriving mid-transition bends
+// the fade toward the new targets without a jump or a kink. Only a speed that
+// would carry the base past the new targets is reined in. A snapshot with
+// unchanged targets leaves a running transition alone.
+template <typename Scalar>
+void applyTargets(LightStateT<Scalar> &light, const LightTargets &targets);
+
+// Apply a button/mode event taken from the control queue at time now
+template <typename Scalar>
+void applyControlEvent(LightStateT<Scalar> &light, EffectStateT<Scalar> &effect, const ControlEvent &event,
+                       uint32_t now);
+
+// Convert the final color and level into PWM duty cycles through the
+// perceptual output table. Integer only, whatever the Scalar.
+template <typename Scalar>
+PwmOutput computeOutput(const LightStateT<Scalar> &light);
+
+// computeOutput() with temporal dithering: the sub-step part of each duty is
+// carried in dither and spread over the following frames
+template <typename Scalar>
+PwmOutput computeOutputDithered(const LightStateT<Scalar> &light, DitherState &dither);
+
+// Time between dither steps: the whole pattern, 2^OUTPUT_DITHER_BITS steps,
+// repeats within DITHER_MAX_PATTERN_MS
+const uint32_t DITHER_STEP_MS = DITHER_MAX_PATTERN_MS >> OUTPUT_DITHER_BITS;
+static_assert(DITHER_STEP_MS >= 1, "PELARBOJ_DITHER_BITS would need dither steps shorter than a millisecond");
+
+// Whether a frame with fine duties (OUTPUT_LUT_FRACTION_BITS of fraction) and
+// interval ms until the next is dithered: animated, dim enough for one PWM
+// step to show and with a sub-step part left at OUTPUT_DITHER_BITS. The LED
+// task then steps the sigma-delta every DITHER_STEP_MS until the next frame,
+// which still comes after interval. Held and brighter output is rounded.
+inline bool ditherApplies(uint32_t interval, const PwmOutput &fine)
+{
+  const uint32_t dimmest = DITHER_MAX_DUTY << OUTPUT_LUT_FRACTION_BITS;
+  return OUTPUT_DITHER_BITS > 0 && interval != FRAME_INTERVAL_IDLE && interval > DITHER_STEP_MS &&
+         fine.r < dimmest && fine.g < dimmest && fine.b < dimmest &&
+         (outputDitherFraction(fine.r) | outputDitherFraction(fine.g) | outputDitherFraction(fine.b)) != 0;
+}
+
+// What the LED task carries from one frame to the next
+struct LedTaskState
+{
+  FrameClock clock;
+  uint32_t targetSequence; // Last mailbox snapshot applied
+  bool fading;             // A hardware fade segment was started before the wait
+  uint32_t fadeStart;      // When it started
+  bool dithering;          // Dither steps run until the next frame
+  uint32_t renderDue;      // When the next frame renders
+  PwmOutput fine;          // Fine duty of the last frame, which the steps dither
+  PwmOutput shown;         // Duty of the last frame or step
+  DitherState dither;
+};
+
+// What one frame of the LED task asks of the hardware
+struct LedFrame
+{
+  PwmOutput pwm;     // Duty to write, or to fade to when fade is set
+  uint32_t wait;     // ms until the next frame, or FRAME_INTERVAL_IDLE
+  bool fade;         // Fade to pwm over wait ms instead of writing it
+  bool changed;      // New targets or control events were applied
+  bool mailboxRetry; // A mailbox read collided with a writer, the next frame retries
+  bool hold;         // A dither step that left the duty as it was, nothing to write
+};
+
+// Start the LED task's frames at time now
+void ledTaskStart(LedTaskState &task, uint32_t now);
+
+// One frame of the LED task at time now: pick up the latest targets and
+// control events, then either plan a hardware fade segment (when hardwareFades
+// and it applies) or render and compute the output. Between the frames of
+// dithered output it is a dither step instead, unless new targets or events
+// are waiting. The firmware and the host harnesses run the same frames; any
+// fade still running must have been stopped before a frame that follows one.
+template <typename Scalar>
+LedFrame ledTaskFrame(LedTaskState &task, LightStateT<Scalar> &light, EffectStateT<Scalar> &effect,
+                      const TargetMailbox &mailbox, ControlQueue &queue, uint32_t now, bool hardwareFades);
@@ -0,0 +1,74 @@
+#include "Residency.h"
+
+ResidencyTracker residency = {{0, 0, 0, 0, 0}, 0, false, {0}};
+
+// Serializes the LED task (recording) and loop() (reporting)
+static portMUX_TYPE residencyLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Charge the time since the last state change to the state being left
+static void closeState(ResidencyTracker &tracker, uint32_t nowUs)
+{
+  uint32_t spent = nowUs - tracker.stateSinceUs;
+  if (tracker.rendering)
+  {
+    tracker.window.activeUs += spent;
+  }
+  else
+  {
+    tracker.window.waitingUs += spent;
+  }
+  tracker.stateSinceUs = nowUs;
+}
+
+void residencyFrameStart(ResidencyTracker &tracker, uint32_t nowUs, bool notified)
+{
+  portENTER_CRITICAL(&residencyLock);
+  closeState(tracker, nowUs);
+  tracker.rendering = true;
+  tracker.window.frames++;
+  if (notified)
+  {
+    tracker.window.notifiedWakes++;
+  }
+  portEXIT_CRITICAL(&residencyLock);
+}
+
+void residencyFrameEnd(ResidencyTracker &tracker, uint32_t nowUs)
+{
+  portENTER_CRITICAL(&residencyLock);
+  closeState(tracker, nowUs);
+  tracker.rendering = false;
+  portEXIT_CRITICAL(&residencyLock);
+}
+
+void residencyAddSleep(ResidencyTracker &tracker, uint32_t sleptUs)
+{
+  tracker.sleepUs.fetch_add(sleptUs, std::memory_order_relaxed);
+}
+
+ResidencyStats residencyTakeWindow(ResidencyTracker &tracker, uint32_t nowUs)
+{
+  portENTER_CRITICAL(&residencyLock);
+  closeState(tracker, nowUs);
+  ResidencyStats window = tracker.window;
+  ResidencyStats empty = {0, 0, 0, 0, 0};
+  tracker.window = empty;
+  portEXIT_CRITICAL(&residencyLock);
+
+  window.sleepUs = tracker.sleepUs.exchange(0, std::memory_order_relaxed);
+  return window;
+}
+
+static float percentOf(uint64_t part, uint64_t total)
+{
+  return total == 0 ? 0.0f : 100.0f * (float)part / (float)total;
+}
+
+void residencyLog(const ResidencyStats &window)
+{
+  uint64_t wallUs = window.activeUs + window.waitingUs;
+  Serial.printf("Residency: render %.2f%%, waiting %.2f%%, light sleep %.2f%% over %lu s; %lu frames, %lu woken by events\n",
+                percentOf(window.activeUs, wallUs), percentOf(window.waitingUs, wallUs),
+                percentOf(window.sleepUs, wallUs), (unsigned long)(wallUs / 1000000),
+                (unsigned long)window.frames, (unsigned long)window.notifiedWakes);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+#include "Platform.h"
+
+// Power residency accounting: how much of the time the LED task spends
+// rendering versus waiting, how often it wakes, and how much of the wall time
+// the chip actually spent in light sleep. The LED task records, loop() takes a
+// window every RESIDENCY_REPORT_MS and logs it.
+
+const uint32_t RESIDENCY_REPORT_MS = 60000; // Report window (1 minute)
+
+struct ResidencyStats
+{
+  uint64_t activeUs;      // LED task rendering
+  uint64_t waitingUs;     // LED task blocked until its next frame or a notification
+  uint64_t sleepUs;       // Chip in light sleep (0 when light sleep is off)
+  uint32_t frames;        // Frames rendered
+  uint32_t notifiedWakes; // Waits ended early by a target or control event
+};
+
+struct ResidencyTracker
+{
+  ResidencyStats window;         // Accumulated since the last report, guarded by the tracker lock
+  uint32_t stateSinceUs;         // When the LED task last started or stopped rendering
+  bool rendering;                // LED task state
+  std::atomic<uint32_t> sleepUs; // Light sleep time, added from the sleep exit hook
+};
+
+extern ResidencyTracker residency;
+
+// LED task: a frame starts at nowUs. notified is true when the wait before it
+// was ended by a task notification rather than by its timeout.
+void residencyFrameStart(ResidencyTracker &tracker, uint32_t nowUs, bool notified);
+
+// LED task: the frame is done and the task is about to wait
+void residencyFrameEnd(ResidencyTracker &tracker, uint32_t nowUs);
+
+// Light sleep exit hook: the chip slept for sleptUs. Lock-free, safe with
+// interrupts disabled.
+void residencyAddSleep(ResidencyTracker &tracker, uint32_t sleptUs);
+
+// Close the current window at nowUs: returns its totals and starts a new one
+ResidencyStats residencyTakeWindow(ResidencyTracker &tracker, uint32_t nowUs);
+
+// Log a window as percentages of its wall time
+void residencyLog(const ResidencyStats &window);
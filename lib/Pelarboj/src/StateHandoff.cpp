@@ -0,0 +1,111 @@
+#include "StateHandoff.h"
+
+TargetMailbox targetMailbox = {{0}, {0}, {0}, {0}};
+ControlQueue controlQueue = {{0}, {0}, {}};
+
+// Serializes the writers only; the LED task never takes it
+static portMUX_TYPE targetWriterLock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t packBlue(uint16_t b, uint8_t level)
+{
+  return (uint32_t)b | (uint32_t)level << 16;
+}
+
+static uint32_t packState(bool state, uint32_t transitionMs)
+{
+  return (state ? 1 : 0) | min(transitionMs, TRANSITION_MAX_MS) << 8;
+}
+
+static void writeSnapshot(TargetMailbox &mailbox, uint32_t red, uint32_t blue, uint32_t state)
+{
+  uint32_t sequence = mailbox.sequence.load(std::memory_order_relaxed);
+  mailbox.sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  mailbox.red.store(red, std::memory_order_relaxed);
+  mailbox.blue.store(blue, std::memory_order_relaxed);
+  mailbox.state.store(state, std::memory_order_relaxed);
+
+  mailbox.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void targetMailboxPublish(TargetMailbox &mailbox, const LightTargets &targets)
+{
+  portENTER_CRITICAL(&targetWriterLock);
+  writeSnapshot(mailbox, (uint32_t)targets.r | (uint32_t)targets.g << 16, packBlue(targets.b, targets.level),
+                packState(targets.state, targets.transitionMs));
+  portEXIT_CRITICAL(&targetWriterLock);
+}
+
+bool targetMailboxTogglePower(TargetMailbox &mailbox)
+{
+  portENTER_CRITICAL(&targetWriterLock);
+  bool state = (mailbox.state.load(std::memory_order_relaxed) & 1) == 0;
+  uint32_t red = mailbox.red.load(std::memory_order_relaxed);
+  uint16_t b = mailbox.blue.load(std::memory_order_relaxed) & 0xFFFF;
+  writeSnapshot(mailbox, red, packBlue(b, state ? 255 : 0), packState(state, TRANSITION_DEFAULT_MS));
+  portEXIT_CRITICAL(&targetWriterLock);
+  return state;
+}
+
+bool targetMailboxRead(const TargetMailbox &mailbox, uint32_t &lastSequence, LightTargets &targets)
+{
+  uint32_t before = mailbox.sequence.load(std::memory_order_acquire);
+  if (before == lastSequence || (before & 1))
+  {
+    return false; // Nothing new, or a write is in progress
+  }
+
+  uint32_t red = mailbox.red.load(std::memory_order_relaxed);
+  uint32_t blue = mailbox.blue.load(std::memory_order_relaxed);
+  uint32_t state = mailbox.state.load(std::memory_order_relaxed);
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (mailbox.sequence.load(std::memory_order_relaxed) != before)
+  {
+    return false; // Torn read - a writer got in between
+  }
+
+  targets.r = red & 0xFFFF;
+  targets.g = red >> 16;
+  targets.b = blue & 0xFFFF;
+  targets.level = (blue >> 16) & 0xFF;
+  targets.state = (state & 1) != 0;
+  targets.transitionMs = state >> 8;
+  lastSequence = before;
+  return true;
+}
+
+bool targetMailboxPending(const TargetMailbox &mailbox, uint32_t lastSequence)
+{
+  return mailbox.sequence.load(std::memory_order_relaxed) != lastSequence;
+}
+
+bool controlQueuePush(ControlQueue &queue, const ControlEvent &event)
+{
+  uint32_t head = queue.head.load(std::memory_order_relaxed);
+  if (head - queue.tail.load(std::memory_order_acquire) >= CONTROL_QUEUE_SIZE)
+  {
+    return false;
+  }
+  queue.events[head & (CONTROL_QUEUE_SIZE - 1)] = event;
+  queue.head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+bool controlQueuePop(ControlQueue &queue, ControlEvent &event)
+{
+  uint32_t tail = queue.tail.load(std::memory_order_relaxed);
+  if (tail == queue.head.load(std::memory_order_acquire))
+  {
+    return false;
+  }
+  event = queue.events[tail & (CONTROL_QUEUE_SIZE - 1)];
+  queue.tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+bool controlQueuePending(const ControlQueue &queue)
+{
+  return queue.tail.load(std::memory_order_relaxed) != queue.head.load(std::memory_order_acquire);
+}
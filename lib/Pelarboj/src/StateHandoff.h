@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+#include "Platform.h"
+
+// Lock-free handoff from the Zigbee and button tasks to the LED task.
+//
+// Hue targets go through a seqlock mailbox: writers (the Zigbee stack, and
+// the button task for a local toggle) publish a whole snapshot, the LED task
+// picks up the latest one once per frame. Each command carries the complete
+// light state, so a newer snapshot supersedes an unread older one and nothing
+// is ever dropped on a timeout. Button/mode events go through a single-producer
+// single-consumer ring. Neither side ever waits on the other.
+
+const uint32_t TRANSITION_DEFAULT_MS = 400;    // Commands without a transition time fade like a Hue bulb
+const uint32_t TRANSITION_MAX_MS = 0x00FFFFFF; // Longest transition the mailbox carries (ZCL allows 6553.4 s)
+
+// Light state requested by the coordinator (or the button)
+struct LightTargets
+{
+  uint16_t r, g, b;                              // Target working color (ColorSpace.h, 0-65535 linear)
+  uint8_t level;                                 // Target brightness level (0-255)
+  bool state;                                    // Target on/off state
+  uint32_t transitionMs = TRANSITION_DEFAULT_MS; // Time to reach the targets from wherever the light is
+};
+
+// Seqlock-protected LightTargets. The fields are packed into atomic words so
+// a reader racing a writer sees a stale or torn value but never a data race,
+// and the sequence tells it to discard the read.
+struct TargetMailbox
+{
+  std::atomic<uint32_t> sequence; // Odd while a write is in progress
+  std::atomic<uint32_t> red;      // r | g << 16
+  std::atomic<uint32_t> blue;     // b | level << 16
+  std::atomic<uint32_t> state;    // On/off | transitionMs << 8
+};
+
+extern TargetMailbox targetMailbox;
+
+// Publish a new snapshot. Writers are serialized by a short critical section
+// (a handful of stores), which the reader never takes.
+void targetMailboxPublish(TargetMailbox &mailbox, const LightTargets &targets);
+
+// Flip the on/off state of the latest snapshot (level 255 when on, 0 when off)
+// in one step, so a concurrent Zigbee command is never overwritten with stale
+// color. Fades over TRANSITION_DEFAULT_MS. Returns the new state.
+bool targetMailboxTogglePower(TargetMailbox &mailbox);
+
+// Wait-free read for the LED task. Returns true and fills targets when a
+// snapshot newer than lastSequence is available and was read consistently;
+// on a collision with a writer it returns false and the next frame retries.
+bool targetMailboxRead(const TargetMailbox &mailbox, uint32_t &lastSequence, LightTargets &targets);
+
+// Whether a snapshot newer than lastSequence exists or is being written - after
+// a failed read, tells a collision with a writer apart from nothing new
+bool targetMailboxPending(const TargetMailbox &mailbox, uint32_t lastSequence);
+
+// Button and mode events, applied by the LED task between frames
+enum ControlEventType
+{
+  CONTROL_NEXT_EFFECT = 0,  // Switch to the next effect and blink its number
+  CONTROL_RESET_START = 1,  // Long press: start reset blinking
+  CONTROL_RESET_CANCEL = 2, // Button released early: back to normal
+  CONTROL_RESET_BLANK = 3,  // Reset confirmed: blank the output
+};
+
+struct ControlEvent
+{
+  ControlEventType type;
+};
+
+const uint32_t CONTROL_QUEUE_SIZE = 8; // Power of two
+
+// Single-producer (button task) single-consumer (LED task) ring buffer
+struct ControlQueue
+{
+  std::atomic<uint32_t> head; // Next slot to write, owned by the producer
+  std::atomic<uint32_t> tail; // Next slot to read, owned by the consumer
+  ControlEvent events[CONTROL_QUEUE_SIZE];
+};
+
+extern ControlQueue controlQueue;
+
+// Returns false (and drops the event) when the queue is full
+bool controlQueuePush(ControlQueue &queue, const ControlEvent &event);
+
+// Returns false when the queue is empty
+bool controlQueuePop(ControlQueue &queue, ControlEvent &event);
+
+// Whether events are waiting, without taking one
+bool controlQueuePending(const ControlQueue &queue);
@@ -0,0 +1,147 @@
+#include "StateStore.h"
+
+#include <string.h>
+
+const uint32_t FLASH_BLOCK_BYTES = 4096;    // Erase unit
+const uint32_t FLASH_ERASE_CYCLES = 100000; // Rated erase cycles per block
+const uint32_t MS_PER_DAY = 24UL * 3600 * 1000;
+
+uint8_t crc8(const uint8_t *data, size_t length)
+{
+  uint8_t crc = 0;
+  for (size_t i = 0; i < length; i++)
+  {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++)
+    {
+      crc = crc & 0x80 ? (uint8_t)(crc << 1 ^ 0x07) : (uint8_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+size_t storeRecordEncode(uint8_t key, uint32_t sequence, const uint8_t *payload, uint8_t length, uint8_t *buffer)
+{
+  buffer[0] = STORE_RECORD_MAGIC;
+  buffer[1] = key;
+  buffer[2] = length;
+  for (int i = 0; i < 4; i++)
+  {
+    buffer[3 + i] = (sequence >> (8 * i)) & 0xFF;
+  }
+  memcpy(buffer + 7, payload, length);
+  buffer[7 + length] = crc8(buffer, 7 + length);
+  return STORE_RECORD_OVERHEAD + length;
+}
+
+void storeScan(const uint8_t *data, size_t length, StoreIndex &index)
+{
+  memset(&index, 0, sizeof(index));
+  size_t offset = 0;
+  while (offset + STORE_RECORD_OVERHEAD <= length)
+  {
+    const uint8_t *record = data + offset;
+    uint8_t key = record[1];
+    uint8_t payloadLength = record[2];
+    size_t size = STORE_RECORD_OVERHEAD + payloadLength;
+    if (record[0] != STORE_RECORD_MAGIC || key >= STORE_MAX_KEYS || payloadLength > STORE_MAX_PAYLOAD ||
+        offset + size > length || record[size - 1] != crc8(record, size - 1))
+    {
+      break; // Torn or corrupt: the rest of the file is lost
+    }
+
+    uint32_t sequence = 0;
+    for (int i = 0; i < 4; i++)
+    {
+      sequence |= (uint32_t)record[3 + i] << (8 * i);
+    }
+    StoreEntry &entry = index.entries[key];
+    entry.present = true;
+    entry.length = payloadLength;
+    entry.sequence = sequence;
+    memcpy(entry.payload, record + 7, payloadLength);
+    index.nextSequence = max(index.nextSequence, sequence + 1);
+    index.records++;
+    offset += size;
+  }
+  index.validLength = offset;
+}
+
+bool storeNeedsCompaction(const StoreIndex &index, size_t fileLength)
+{
+  return fileLength >= STORE_COMPACT_BYTES || index.validLength < fileLength;
+}
+
+size_t storeCompact(const StoreIndex &index, uint8_t *buffer)
+{
+  size_t size = 0;
+  for (uint8_t key = 0; key < STORE_MAX_KEYS; key++)
+  {
+    const StoreEntry &entry = index.entries[key];
+    if (entry.present)
+    {
+      size += storeRecordEncode(key, entry.sequence, entry.payload, entry.length, buffer + size);
+    }
+  }
+  return size;
+}
+
+void storeIndexUpdate(StoreIndex &index, uint8_t key, const uint8_t *payload, uint8_t length)
+{
+  StoreEntry &entry = index.entries[key];
+  entry.present = true;
+  entry.length = length;
+  entry.sequence = index.nextSequence++;
+  memcpy(entry.payload, payload, length);
+  index.records++;
+  index.validLength += STORE_RECORD_OVERHEAD + length;
+}
+
+void coalescerChange(PersistCoalescer &coalescer, uint32_t now)
+{
+  if (!coalescer.pending)
+  {
+    coalescer.pending = true;
+    coalescer.firstChangeMs = now;
+  }
+  coalescer.lastChangeMs = now;
+}
+
+uint32_t coalescerWait(const PersistCoalescer &coalescer, uint32_t now)
+{
+  if (!coalescer.pending)
+  {
+    return PERSIST_IDLE;
+  }
+  uint32_t quiet = now - coalescer.lastChangeMs;
+  uint32_t waited = now - coalescer.firstChangeMs;
+  if (quiet >= PERSIST_QUIET_MS || waited >= PERSIST_MAX_DELAY_MS)
+  {
+    return 0;
+  }
+  return min(PERSIST_QUIET_MS - quiet, PERSIST_MAX_DELAY_MS - waited);
+}
+
+void coalescerWritten(PersistCoalescer &coalescer)
+{
+  coalescer.pending = false;
+}
+
+void storeStatsLog(const StoreStats &stats, uint32_t uptimeMs, uint32_t partitionBytes)
+{
+  // Every written block's worth of bytes costs about one erase; LittleFS
+  // spreads them over the whole partition
+  float erasesPerDay = uptimeMs == 0 ? 0.0f : (float)stats.bytes / FLASH_BLOCK_BYTES * MS_PER_DAY / uptimeMs;
+  float budget = (float)(partitionBytes / FLASH_BLOCK_BYTES) * FLASH_ERASE_CYCLES;
+  Serial.printf("Store: %lu changes, %lu appends, %lu compactions, %lu bytes written; ~%.2f block erases/day",
+                (unsigned long)stats.changes, (unsigned long)stats.appends, (unsigned long)stats.compactions,
+                (unsigned long)stats.bytes, erasesPerDay);
+  if (erasesPerDay > 0.0f)
+  {
+    Serial.printf(", flash lasts ~%.0f years at this rate\n", budget / erasesPerDay / 365.0f);
+  }
+  else
+  {
+    Serial.printf("\n");
+  }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Platform.h"
+
+// Log-structured key/value store for persisted state on the LittleFS
+// partition. Every save appends one small record to a single file instead of
+// rewriting a value in place; on boot the file is scanned and the newest
+// valid record of each key wins, so a power cut mid-append loses at most that
+// record. When the file grows past STORE_COMPACT_BYTES it is rewritten with
+// only the live records. Bursts of changes are coalesced into one delayed
+// append first. The format and the policies live here; the firmware does the
+// file I/O from a low-priority task.
+//
+// Record: magic, key, payload length, sequence (u32 LE), payload, CRC-8.
+
+enum StoreKey
+{
+  STORE_KEY_LIGHT = 1, // PersistedLight (BootState.h)
+};
+
+const uint8_t STORE_RECORD_MAGIC = 0xA7;
+const uint32_t STORE_MAX_KEYS = 8;                                     // Keys 0..7
+const uint32_t STORE_MAX_PAYLOAD = 32;                                 // Bytes per record
+const size_t STORE_RECORD_OVERHEAD = 8;                                // Header and CRC
+const size_t STORE_MAX_RECORD = STORE_RECORD_OVERHEAD + STORE_MAX_PAYLOAD;
+const size_t STORE_COMPACT_BYTES = 4096;                               // Compact once the file fills a flash block
+const size_t STORE_MAX_FILE = STORE_COMPACT_BYTES + STORE_MAX_RECORD; // Largest file scanned at boot
+
+const uint32_t PERSIST_QUIET_MS = 5000;      // Write once changes stop for this long
+const uint32_t PERSIST_MAX_DELAY_MS = 30000; // ...or at the latest this long after the first one
+const uint32_t PERSIST_IDLE = 0xFFFFFFFF;    // Nothing pending
+
+// CRC-8, polynomial 0x07
+uint8_t crc8(const uint8_t *data, size_t length);
+
+// Encode one record into buffer (at least STORE_RECORD_OVERHEAD + length
+// bytes). Returns its size.
+size_t storeRecordEncode(uint8_t key, uint32_t sequence, const uint8_t *payload, uint8_t length, uint8_t *buffer);
+
+struct StoreEntry
+{
+  bool present;
+  uint8_t length;
+  uint32_t sequence;
+  uint8_t payload[STORE_MAX_PAYLOAD];
+};
+
+// What a scan of the file found
+struct StoreIndex
+{
+  StoreEntry entries[STORE_MAX_KEYS]; // Newest record of each key
+  uint32_t nextSequence;              // For the next append
+  size_t validLength;                 // Bytes up to the first torn or corrupt record
+  uint32_t records;                   // Valid records, superseded ones included
+};
+
+// Scan a file image. Stops at the first record that is cut short or fails its
+// CRC - everything after it is lost to an interrupted write.
+void storeScan(const uint8_t *data, size_t length, StoreIndex &index);
+
+// Whether the file should be rewritten: grown past STORE_COMPACT_BYTES, or
+// holding garbage after its last valid record
+bool storeNeedsCompaction(const StoreIndex &index, size_t fileLength);
+
+// Write the live records of index into buffer (at least STORE_MAX_KEYS *
+// STORE_MAX_RECORD bytes). Returns the compacted file size.
+size_t storeCompact(const StoreIndex &index, uint8_t *buffer);
+
+// Record an append in the index, as a later scan would see it
+void storeIndexUpdate(StoreIndex &index, uint8_t key, const uint8_t *payload, uint8_t length);
+
+// Delays writes until a burst of changes is over
+struct PersistCoalescer
+{
+  bool pending;           // Changed since the last write
+  uint32_t firstChangeMs; // First change not written yet
+  uint32_t lastChangeMs;  // Latest change
+};
+
+void coalescerChange(PersistCoalescer &coalescer, uint32_t now);
+
+// Milliseconds until the pending change is due (0 when due now), or
+// PERSIST_IDLE when nothing is pending
+uint32_t coalescerWait(const PersistCoalescer &coalescer, uint32_t now);
+
+void coalescerWritten(PersistCoalescer &coalescer);
+
+// Flash wear accounting since boot
+struct StoreStats
+{
+  uint32_t changes;     // State changes seen
+  uint32_t appends;     // Records appended
+  uint32_t compactions; // File rewrites
+  uint32_t bytes;       // Bytes written, compactions included
+};
+
+// Log the counters and the wear they imply for a partition of
+// partitionBytes over uptimeMs
+void storeStatsLog(const StoreStats &stats, uint32_t uptimeMs, uint32_t partitionBytes);
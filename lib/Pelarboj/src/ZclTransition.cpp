@@ -0,0 +1,80 @@
+#include "ZclTransition.h"
+
+// Where a command keeps its transition time, in tenths of a second
+struct TransitionField
+{
+  uint16_t cluster;
+  uint8_t command;
+  uint8_t offset; // Payload offset
+  uint8_t bytes;  // 2, or 1 for the old step hue/saturation commands
+};
+
+static const TransitionField TRANSITION_FIELDS[] = {
+    {ZCL_CLUSTER_LEVEL_CONTROL, 0x00, 1, 2}, // Move to level: level, time
+    {ZCL_CLUSTER_LEVEL_CONTROL, 0x02, 2, 2}, // Step: mode, size, time
+    {ZCL_CLUSTER_LEVEL_CONTROL, 0x04, 1, 2}, // Move to level with on/off
+    {ZCL_CLUSTER_LEVEL_CONTROL, 0x06, 2, 2}, // Step with on/off
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x00, 2, 2}, // Move to hue: hue, direction, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x02, 2, 1}, // Step hue: mode, size, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x03, 1, 2}, // Move to saturation: saturation, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x05, 2, 1}, // Step saturation: mode, size, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x06, 2, 2}, // Move to hue and saturation: hue, saturation, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x07, 4, 2}, // Move to color: x, y, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x09, 4, 2}, // Step color: step x, step y, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x0A, 2, 2}, // Move to color temperature: mireds, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x40, 3, 2}, // Enhanced move to hue: hue, direction, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x42, 3, 2}, // Enhanced step hue: mode, size, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x43, 3, 2}, // Enhanced move to hue and saturation: hue, saturation, time
+    {ZCL_CLUSTER_COLOR_CONTROL, 0x4C, 3, 2}, // Step color temperature: mode, size, time
+    {ZCL_CLUSTER_SCENES, 0x05, 3, 2},        // Recall scene: group, scene, optional time
+};
+
+const uint8_t ZCL_SCENES_RECALL = 0x05;
+
+bool zclCommandTransition(uint16_t cluster, uint8_t command, const uint8_t *payload, size_t length,
+                          uint32_t &transitionMs)
+{
+  if (cluster == ZCL_CLUSTER_SCENES && command != ZCL_SCENES_RECALL)
+  {
+    return false; // Adding, viewing and storing scenes leave the light alone
+  }
+  if (cluster != ZCL_CLUSTER_ON_OFF && cluster != ZCL_CLUSTER_SCENES && cluster != ZCL_CLUSTER_LEVEL_CONTROL &&
+      cluster != ZCL_CLUSTER_COLOR_CONTROL)
+  {
+    return false;
+  }
+
+  transitionMs = TRANSITION_DEFAULT_MS;
+  for (const TransitionField &field : TRANSITION_FIELDS)
+  {
+    if (field.cluster != cluster || field.command != command)
+    {
+      continue;
+    }
+    if (length < (size_t)field.offset + field.bytes)
+    {
+      break; // Truncated, or a recall without the optional time
+    }
+    uint16_t tenths = payload[field.offset];
+    if (field.bytes == 2)
+    {
+      tenths |= payload[field.offset + 1] << 8;
+    }
+    if (tenths != ZCL_TRANSITION_UNSET)
+    {
+      transitionMs = tenths * 100u;
+    }
+    break;
+  }
+  return true;
+}
+
+uint32_t commandTransitionRemaining(const CommandTransition &command, uint32_t now)
+{
+  uint32_t elapsed = now - command.receivedMs;
+  if (elapsed > command.durationMs + ZCL_REPORT_WINDOW_MS)
+  {
+    return TRANSITION_DEFAULT_MS;
+  }
+  return elapsed < command.durationMs ? command.durationMs - elapsed : 0;
+}
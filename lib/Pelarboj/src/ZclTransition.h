@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "StateHandoff.h"
+
+// Transition times of Zigbee light commands. The Hue library only reports the
+// attributes a command changed (ZigbeeHueLight::onLightChange), so the
+// firmware peeks at each raw ZCL command to the light before the stack
+// handles it, notes the transition time it carries, and the light change
+// callback that follows publishes the targets with it. Scenes recalled across
+// several lamps then fade in step.
+
+const uint16_t ZCL_CLUSTER_ON_OFF = 0x0006;
+const uint16_t ZCL_CLUSTER_SCENES = 0x0005;
+const uint16_t ZCL_CLUSTER_LEVEL_CONTROL = 0x0008;
+const uint16_t ZCL_CLUSTER_COLOR_CONTROL = 0x0300;
+const uint16_t ZCL_TRANSITION_UNSET = 0xFFFF; // "Use the device default" in the commands with a 16-bit time
+const uint32_t ZCL_REPORT_WINDOW_MS = 200;     // Attribute changes later than this after a transition are not its own
+
+// Transition of a cluster-specific command to the light, in ms, from its
+// payload (the ZCL header already stripped). Commands without one - on/off,
+// rate-based moves and stops - and unset or truncated fields give
+// TRANSITION_DEFAULT_MS. False for commands that do not change the light.
+bool zclCommandTransition(uint16_t cluster, uint8_t command, const uint8_t *payload, size_t length,
+                          uint32_t &transitionMs);
+
+// The last light command seen, owned by the Zigbee task
+struct CommandTransition
+{
+  uint32_t receivedMs; // millis() when it arrived
+  uint32_t durationMs; // Its transition time
+};
+
+// Transition for an attribute change reported at now: what is left of the
+// command's transition, so the lamp arrives when the command said even if the
+// stack reports late or steps the attribute itself. A change more than
+// ZCL_REPORT_WINDOW_MS after the command played out was not caused by it and
+// gets TRANSITION_DEFAULT_MS.
+uint32_t commandTransitionRemaining(const CommandTransition &command, uint32_t now);
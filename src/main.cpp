@@ -1,67 +1,30 @@
 #include <Arduino.h>
+#include <LittleFS.h>
 #include <Zigbee.h>
 #include <bootloader_random.h>
+#include <driver/ledc.h>
+#include <esp_partition.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-
-// Courtesy http://www.instructables.com/id/How-to-Use-an-RGB-LED/?ALLSTEPS
-// function to convert a color to its Red, Green, and Blue components.
-void hueToRGB(uint8_t hue, uint8_t brightness, uint32_t &R, uint32_t &G, uint32_t &B)
-{
-  const boolean invert = true; // set true if common anode, false if common cathode
-
-  uint16_t scaledHue = (hue * 6);
-  uint8_t segment = scaledHue / 256;                    // segment 0 to 5 around the
-                                                        // color wheel
-  uint16_t segmentOffset = scaledHue - (segment * 256); // position within the segment
-
-  uint8_t complement = 0;
-  uint16_t prev = (brightness * (255 - segmentOffset)) / 256;
-  uint16_t next = (brightness * segmentOffset) / 256;
-
-  if (invert)
-  {
-    brightness = 255 - brightness;
-    complement = 255;
-    prev = 255 - prev;
-    next = 255 - next;
-  }
-
-  switch (segment)
-  {
-  case 0: // red
-    R = brightness;
-    G = next;
-    B = complement;
-    break;
-  case 1: // yellow
-    R = prev;
-    G = brightness;
-    B = complement;
-    break;
-  case 2: // green
-    R = complement;
-    G = brightness;
-    B = next;
-    break;
-  case 3: // cyan
-    R = complement;
-    G = prev;
-    B = brightness;
-    break;
-  case 4: // blue
-    R = next;
-    G = complement;
-    B = brightness;
-    break;
-  case 5: // magenta
-  default:
-    R = brightness;
-    G = complement;
-    B = prev;
-    break;
-  }
-}
+#include <zboss_api.h>
+
+#ifdef PELARBOJ_LIGHT_SLEEP
+#include <driver/gpio.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#endif
+
+#include "BootState.h"
+#include "ColorSpace.h"
+#include "Compositor.h"
+#include "EffectVm.h"
+#include "Instrumentation.h"
+#include "Keyframes.h"
+#include "Log.h"
+#include "Render.h"
+#include "Residency.h"
+#include "StateStore.h"
+#include "ZclTransition.h"
 
 // Set up the rgb led names
 const uint8_t ledR = D9;
@@ -70,11 +33,24 @@ const uint8_t ledB = D7;
 const uint8_t EXTERNAL_BUTTON_PIN = D0;
 
 const uint8_t ENDPOINT = 10;
+const uint8_t ENHANCED_COLOR_MODE_HUE = 3; // EnhancedColorMode value for enhanced hue and saturation
+
+// Manufacturer-specific attribute on the Basic cluster holding the encoded
+// DiagnosticsSummary as an octet string
+const uint16_t DIAGNOSTICS_MANUFACTURER_CODE = 0x131B; // Espressif
+const uint16_t DIAGNOSTICS_ATTR_ID = 0xFC00;
+const uint32_t DIAGNOSTICS_UPDATE_MS = 60000; // Attribute refresh interval
+const char DIAGNOSTICS_DUMP_COMMAND = 'd';    // Serial: dump the instrumentation
+const char PROGRAM_NEXT_COMMAND = 'p';        // Serial: run the next effect program
+
+// Light sleep: how often loop() looks for the join until it happens
+const uint32_t JOIN_POLL_MS = 100;
 
 // Button handling constants
 const uint32_t DEBOUNCE_TIME_MS = 50;
 const uint32_t DOUBLE_PRESS_WINDOW_MS = 300;
 const uint32_t LONG_PRESS_TIME_MS = 5000;
+const uint32_t BUTTON_IDLE_POLL_MS = 200; // Light sleep: idle poll backing up the button interrupt
 
 volatile int random_seed = 0;
 
@@ -99,836 +75,450 @@ struct ButtonHandler
 
 ButtonHandler buttonHandler = {BTN_IDLE, 0, 0, false, HIGH};
 
-// Effects system
-enum EffectType
-{
-  EFFECT_NONE = 0,
-  EFFECT_COLOR_WANDER = 1,
-  EFFECT_LEVEL_PULSE = 2,
-  EFFECT_COMBO = 3,
-  EFFECT_SCENE_CHANGE = 4,
-  EFFECT_FIREPLACE = 5,
-  EFFECT_RAINBOW = 6,
-  EFFECT_COLOR_STEPS = 7,
-  EFFECT_BROKEN_ELECTRICITY = 8,
-  EFFECT_BREATHING = 9,
-  EFFECT_AUTO_CYCLE = 10,
-  MAX_EFFECT_NUMBER = 11
-};
+// Octet string: length byte, then the encoded summary
+uint8_t diagnosticsAttribute[1 + DIAGNOSTICS_ENCODED_SIZE] = {DIAGNOSTICS_ENCODED_SIZE};
 
-// Special modes for LED control
-enum SpecialMode
-{
-  MODE_NORMAL = 0,
-  MODE_RESET_BLINKING = 1,
-  MODE_EFFECT_BLINKING = 2
-};
+// Advertised color temperature range, so the bridge keeps white scenes inside it
+uint16_t colorTempMinMireds = COLOR_TEMP_MIN_MIREDS;
+uint16_t colorTempMaxMireds = COLOR_TEMP_MAX_MIREDS;
 
-struct EffectState
+// Hue light with the diagnostics attribute added to its Basic cluster
+class PelarbojLight : public ZigbeeHueLight
 {
-  EffectType type;
-  unsigned long startTime;
-  float phase1, phase2, phase3; // Multiple phase counters for complex effects
-
-  // Scene change effect state
-  float sceneTargetR, sceneTargetG, sceneTargetB;    // Target color for scene change
-  float sceneTargetLevel;                            // Target level for scene change
-  float sceneCurrentR, sceneCurrentG, sceneCurrentB; // Current scene color during transition
-  float sceneCurrentLevel;                           // Current scene level during transition
-  unsigned long sceneChangeTime;                     // When the current scene change started
-  unsigned long sceneHoldTime;                       // How long to hold current scene (5-10s random)
-  unsigned long sceneTransitionTime;                 // How long transition should take (1-2s, set once)
-  bool sceneTransitioning;                           // True if transitioning, false if holding
-
-  // Auto-cycle effect state (separate from sub-effects)
-  float autoCycleStartTime; // When current sub-effect started
-  float autoCycleDuration;  // How long current sub-effect should run
-  int autoCycleSubEffect;   // Current sub-effect (1-9)
-  bool autoCycleNeedsReset; // Flag to reset sub-effect state
-
-  // Auto-cycle transition state for smooth blending
-  bool autoCycleInTransition;                                               // True if transitioning between effects
-  float autoCycleTransitionStart;                                           // When transition started
-  int autoCyclePrevEffect;                                                  // Previous effect (for blending from)
-  float autoCyclePrevR, autoCyclePrevG, autoCyclePrevB, autoCyclePrevLevel; // Previous effect output
+public:
+  PelarbojLight(uint8_t endpoint) : ZigbeeHueLight(endpoint, ESP_ZB_HUE_LIGHT_TYPE_COLOR)
+  {
+    esp_zb_attribute_list_t *basic =
+        esp_zb_cluster_list_get_cluster(_cluster_list, ESP_ZB_ZCL_CLUSTER_ID_BASIC, ESP_ZB_ZCL_CLUSTER_SERVER_ROLE);
+    esp_zb_cluster_add_manufacturer_attr(basic, ESP_ZB_ZCL_CLUSTER_ID_BASIC, DIAGNOSTICS_ATTR_ID,
+                                         DIAGNOSTICS_MANUFACTURER_CODE, ESP_ZB_ZCL_ATTR_TYPE_OCTET_STRING,
+                                         ESP_ZB_ZCL_ATTR_ACCESS_READ_ONLY, diagnosticsAttribute);
+
+    esp_zb_attribute_list_t *color = esp_zb_cluster_list_get_cluster(
+        _cluster_list, ESP_ZB_ZCL_CLUSTER_ID_COLOR_CONTROL, ESP_ZB_ZCL_CLUSTER_SERVER_ROLE);
+    esp_zb_cluster_update_attr(color, ESP_ZB_ZCL_ATTR_COLOR_CONTROL_COLOR_TEMP_PHYSICAL_MIN_MIREDS_ID,
+                               &colorTempMinMireds);
+    esp_zb_cluster_update_attr(color, ESP_ZB_ZCL_ATTR_COLOR_CONTROL_COLOR_TEMP_PHYSICAL_MAX_MIREDS_ID,
+                               &colorTempMaxMireds);
+  }
 };
 
-// Light state structure with current and target values
-struct LightState
+PelarbojLight *pelarboj;
+TaskHandle_t ledTaskHandle = NULL;
+TaskHandle_t buttonTaskHandle = NULL;
+TaskHandle_t logTaskHandle = NULL;
+TaskHandle_t persistTaskHandle = NULL;
+
+// CPU frequency the LED task renders at, which its cycle counts convert at
+uint32_t renderCpuMhz = 0;
+#ifdef PELARBOJ_LIGHT_SLEEP
+esp_pm_lock_handle_t renderLock = NULL; // CPU_FREQ_MAX, held by the LED task from a frame's start to its wait
+#endif
+
+// Persisted state: a record file on the LittleFS partition (StateStore.h)
+const char *STORE_PATH = "/state.log";
+const char *STORE_COMPACT_PATH = "/state.tmp"; // Compacted file before it replaces STORE_PATH
+bool storeMounted = false;
+StoreIndex storeIndex;                                 // Live records, owned by the persist task after setup()
+StoreStats storeStats = {0, 0, 0, 0};                  // Guarded by storeStatsLock
+static portMUX_TYPE storeStatsLock = portMUX_INITIALIZER_UNLOCKED;
+std::atomic<uint8_t> persistEffect(EFFECT_AUTO_CYCLE); // Selected effect, published by the LED task
+PersistedLight savedLight;                             // Last light state written, owned by the persist task
+
+// Effect programs for EFFECT_PROGRAM (EffectVm.h), assembled with tools/pvm_asm.py
+const char *PROGRAM_DIR = "/effects";
+
+// Keyframe track for EFFECT_KEYFRAMES, played straight from the mapped partition
+const char *KEYFRAME_PARTITION = "anim";
+
+// Transition time of the last light command, noted by zclRawCommandHandler()
+// and used by the light change callback it causes - both run in the Zigbee task
+CommandTransition commandTransition = {0, TRANSITION_DEFAULT_MS};
+
+// LEDC channels, fixed so the fade engine can be addressed directly
+const uint8_t LED_CHANNEL_R = 0;
+const uint8_t LED_CHANNEL_G = 1;
+const uint8_t LED_CHANNEL_B = 2;
+
+#ifdef PELARBOJ_SOFTWARE_FADE
+const bool USE_HARDWARE_FADE = false;
+#else
+const bool USE_HARDWARE_FADE = true; // Plain transitions run on the LEDC fade engine
+#endif
+
+// Wake the LED task early - it may be waiting out a long frame interval or
+// suspended until something changes
+void wakeLedTask()
 {
-  // Base values (from Hue coordinator - the foundation for effects)
-  float base_r, base_g, base_b; // Base RGB values (0.0-255.0)
-  float base_level;             // Base brightness level (0.0-255.0)
-  bool base_state;              // Base on/off state
-
-  // Target values (set by Hue commands - interpolated to base)
-  uint8_t target_r, target_g, target_b; // Target RGB values (0-255)
-  uint8_t target_level;                 // Target brightness level (0-255)
-  bool target_state;                    // Target on/off state
-
-  // Final output values (base + effects - sent to LEDs)
-  float final_r, final_g, final_b; // Final RGB after effects (0.0-255.0)
-  float final_level;               // Final brightness after effects (0.0-255.0)
-
-  // Special modes
-  SpecialMode specialMode;      // Current special mode
-  uint32_t modeStartTime;       // When special mode started
-  uint8_t blinkCount;           // Number of blinks remaining (for effect blinking)
-  uint32_t lastBlinkTime;       // Last blink toggle time
-  bool blinkOn;                 // Current blink state
-  float savedR, savedG, savedB; // Saved current color for blinking
-  EffectType savedEffect;       // Saved effect type during blinking
-};
-
-LightState lightState = {
-    // Initialize base values
-    0.0f, 0.0f, 0.0f, // base RGB
-    0.0f,             // base level
-    false,            // base state
-
-    // Initialize target values
-    0, 0, 0, // target RGB
-    255,     // target level
-    false,   // target state
-
-    // Initialize final values
-    0.0f, 0.0f, 0.0f, // final RGB
-    0.0f,             // final level
-
-    // Initialize special modes
-    MODE_NORMAL,      // specialMode
-    0,                // modeStartTime
-    0,                // blinkCount
-    0,                // lastBlinkTime
-    false,            // blinkOn
-    0.0f, 0.0f, 0.0f, // savedR, savedG, savedB
-    EFFECT_NONE       // savedEffect
-};
-
-EffectState effectState = {
-    EFFECT_COLOR_WANDER, // Start with color wander effect
-    0,                   // Will be set when effect starts
-    0.0f, 0.0f, 0.0f,    // Phase counters
-
-    // Scene change effect initialization
-    0.0f, 0.0f, 0.0f, // sceneTargetR, sceneTargetG, sceneTargetB
-    0.0f,             // sceneTargetLevel
-    0.0f, 0.0f, 0.0f, // sceneCurrentR, sceneCurrentG, sceneCurrentB
-    0.0f,             // sceneCurrentLevel
-    0,                // sceneChangeTime
-    0,                // sceneHoldTime
-    0,                // sceneTransitionTime
-    false             // sceneTransitioning
-};
+  if (ledTaskHandle != NULL)
+  {
+    xTaskNotifyGive(ledTaskHandle);
+  }
+}
 
-SemaphoreHandle_t colorMutex;
-
-ZigbeeHueLight *pelarboj;
-
-const int LED_UPDATE_RATE_MS = 20;   // 50 FPS update rate
-const float TRANSITION_SPEED = 0.1f; // Interpolation speed (0.0-1.0)
-
-// LED PWM configuration
-const int LED_PWM_FREQUENCY = 5000; // 5 kHz PWM frequency for 12-bit resolution
-const int LED_PWM_RESOLUTION = 12;  // 12-bit resolution (0-4095)
-const int LED_PWM_MAX_VALUE = 4095; // Maximum PWM value for 12-bit
-
-// Effect parameters
-const float COLOR_WANDER_RANGE = 10.0f;  // How far colors can wander from base (0-255)
-const float COLOR_WANDER_SPEED = 0.01f;  // Speed of color wandering
-const float COLOR_STEPS_RANGE = 30.0f;   // Range for rapid color steps (0-255)
-const float COLOR_STEPS_INTERVAL = 1.0f; // Time between steps in seconds
-const float LEVEL_PULSE_RANGE = 0.4f;    // Pulse range as fraction of base level (0.0-1.0)
-const float LEVEL_PULSE_SPEED = 0.01f;   // Speed of level pulsation
-
-// Fireplace effect parameters
-const float FIREPLACE_FLICKER_SPEED = 0.08f;  // Speed of flame flickering (faster)
-const float FIREPLACE_INTENSITY_RANGE = 0.3f; // How much brightness can vary (reduced range)
-const float FIREPLACE_RED_BOOST = 1.1f;       // Subtle red boost for warm fire colors
-const float FIREPLACE_ORANGE_MIX = 0.15f;     // Subtle orange mix to stay closer to base
-
-// Rainbow effect parameters
-const float RAINBOW_CYCLE_SPEED = 0.02f; // Speed of color spectrum cycling (faster)
-
-// Broken electricity effect parameters
-const float ELECTRICITY_STABLE_MIN = 5.0f;         // Minimum stable time (2s)
-const float ELECTRICITY_STABLE_MAX = 20.0f;        // Maximum stable time (8s)
-const float ELECTRICITY_BLACKOUT_CHANCE = 0.05f;   // 5% chance of complete blackout
-const float ELECTRICITY_SURGE_CHANCE = 0.1f;       // 10% chance of bright surge
-const float ELECTRICITY_FLICKER_CHANCE = 0.85f;    // 85% chance of normal flicker
-const float ELECTRICITY_BLACKOUT_DURATION = 0.15f; // Duration of blackouts (150ms)
-const float ELECTRICITY_SURGE_MULTIPLIER = 1.6f;   // Brightness multiplier for surges
-
-// Breathing effect parameters
-const float BREATHING_SPEED = 0.01f;          // Speed of breathing cycle (very slow)
-const float BREATHING_MIN_LEVEL = 0.2f;       // Minimum brightness (20% of base level)
-const float BREATHING_MAX_LEVEL = 1.0f;       // Maximum brightness (100% of base level)
-const float BREATHING_COLOR_VARIATION = 5.0f; // Subtle color warmth variation (±5 RGB units)
-
-// Auto-cycle effect parameters
-const float AUTO_CYCLE_MIN_TIME = 30.0f;       // Minimum time per effect
-const float AUTO_CYCLE_MAX_TIME = 300.0f;      // Maximum time per effect
-const float AUTO_CYCLE_TRANSITION_TIME = 2.0f; // Smooth transition duration between effects (2s)
-
-const float RAINBOW_SATURATION = 0.8f; // How vivid the rainbow colors are (0.0-1.0)
-
-// Effect management functions
-void switchToNextEffect()
+// Wake the log task to print what the other tasks queued
+void wakeLogTask()
 {
-  effectState.type = (EffectType)((effectState.type + 1) % MAX_EFFECT_NUMBER);
-  effectState.startTime = millis();
-  effectState.phase1 = 0.0f;
-  effectState.phase2 = 0.0f;
-  effectState.phase3 = 0.0f;
-
-  // Reset scene change state when switching to/from scene change effect
-  effectState.sceneChangeTime = 0;
-  effectState.sceneHoldTime = 0;
-  effectState.sceneTransitionTime = 0;
-  effectState.sceneTransitioning = false;
-
-  Serial.printf("Switched to effect: %d\n", effectState.type);
+  if (logTaskHandle != NULL)
+  {
+    xTaskNotifyGive(logTaskHandle);
+  }
 }
 
-void blinkEffectNumber(uint8_t effectNum)
+// Formats the deferred log records whenever the higher priority tasks are idle,
+// so a slow serial port never holds up rendering or the button
+void logTask(void *parameter)
 {
-  if (xSemaphoreTake(colorMutex, pdMS_TO_TICKS(50)) == pdTRUE)
+  uint32_t reportedDrops = 0;
+  while (true)
   {
-    // Save current state
-    lightState.savedR = lightState.final_r;
-    lightState.savedG = lightState.final_g;
-    lightState.savedB = lightState.final_b;
-    lightState.savedEffect = effectState.type;
-
-    // Start effect blinking mode
-    lightState.specialMode = MODE_EFFECT_BLINKING;
-    lightState.modeStartTime = millis();
-    lightState.blinkCount = effectNum; // Number of complete pulse cycles
-    lightState.lastBlinkTime = millis();
-    lightState.blinkOn = true;
-
-    // Temporarily disable effects
-    effectState.type = EFFECT_NONE;
-
-    Serial.printf("Starting blink mode: %d blinks (count=%d)\n", effectNum, lightState.blinkCount);
-    xSemaphoreGive(colorMutex);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    logDrain(logRing);
+
+    uint32_t dropped = logRing.dropped.load(std::memory_order_relaxed);
+    if (dropped != reportedDrops)
+    {
+      Serial.printf("Log ring full, dropped %lu records\n", (unsigned long)(dropped - reportedDrops));
+      reportedDrops = dropped;
+    }
   }
 }
 
-void toggleLightState()
+// Flash wear accounting for the write report
+void countStoreWrite(bool compaction, size_t bytes)
 {
-  bool newState;
-
-  // Update internal state first
-  if (xSemaphoreTake(colorMutex, pdMS_TO_TICKS(50)) == pdTRUE)
+  portENTER_CRITICAL(&storeStatsLock);
+  if (compaction)
   {
-    lightState.target_state = !lightState.target_state;
-    lightState.target_level = lightState.target_state ? 255 : 0;
-    newState = lightState.target_state;
-    xSemaphoreGive(colorMutex);
+    storeStats.compactions++;
   }
   else
   {
-    Serial.println("Failed to acquire mutex for light toggle");
-    return;
+    storeStats.appends++;
   }
-
-  // Update coordinator state outside mutex to avoid deadlock
-  pelarboj->setLightState(newState);
-  pelarboj->zbUpdateStateFromAttributes();
-
-  Serial.printf("Toggled light: %s\n", newState ? "ON" : "OFF");
+  storeStats.bytes += bytes;
+  portEXIT_CRITICAL(&storeStatsLock);
 }
 
-void performFactoryReset()
+// Replace the record file with just the live records. The new file is written
+// next to it and renamed over it, so a power cut leaves one or the other.
+void storeRewrite()
 {
-  Serial.println("=== Factory Reset Initiated ===");
-
-  // Start reset blinking mode - LED task will handle blinking
-  if (xSemaphoreTake(colorMutex, pdMS_TO_TICKS(50)) == pdTRUE)
+  uint8_t image[STORE_MAX_KEYS * STORE_MAX_RECORD];
+  size_t size = storeCompact(storeIndex, image);
+  File file = LittleFS.open(STORE_COMPACT_PATH, FILE_WRITE);
+  bool written = file && file.write(image, size) == size;
+  file.close();
+  if (!written || !LittleFS.rename(STORE_COMPACT_PATH, STORE_PATH))
   {
-    lightState.specialMode = MODE_RESET_BLINKING;
-    lightState.modeStartTime = millis();
-    xSemaphoreGive(colorMutex);
+    LOG_ERROR("Store compaction failed\n");
+    return;
   }
+  storeIndex.validLength = size;
+  countStoreWrite(true, size);
+}
 
-  // Wait for 5 seconds while checking if button is still pressed
-  for (int i = 0; i < 50; i++)
-  { // Check every 100ms for 5 seconds
-    if (digitalRead(BOOT_PIN) == HIGH && digitalRead(EXTERNAL_BUTTON_PIN) == HIGH)
-    { // Button released
-      Serial.println("Button released - reset cancelled");
-
-      // Stop reset mode and restore normal operation
-      if (xSemaphoreTake(colorMutex, pdMS_TO_TICKS(50)) == pdTRUE)
-      {
-        lightState.specialMode = MODE_NORMAL;
-        xSemaphoreGive(colorMutex);
-      }
-
-      digitalWrite(LED_BUILTIN, LOW);
-      return; // Exit without resetting
-    }
-    vTaskDelay(pdMS_TO_TICKS(100));
+// Append one record. A failed append may leave a torn record at the end of the
+// file, which would hide every later one from the boot scan - rewrite instead.
+void storeAppend(uint8_t key, const uint8_t *payload, uint8_t length)
+{
+  uint8_t record[STORE_MAX_RECORD];
+  size_t size = storeRecordEncode(key, storeIndex.nextSequence, payload, length, record);
+  File file = LittleFS.open(STORE_PATH, FILE_APPEND);
+  bool written = file && file.write(record, size) == size;
+  file.close();
+
+  storeIndexUpdate(storeIndex, key, payload, length);
+  if (written)
+  {
+    countStoreWrite(false, size);
   }
-
-  // If we get here, button was held for full 5 seconds - proceed with reset
-  Serial.println("Reset confirmed - proceeding with factory reset");
-
-  // Stop reset mode and turn off LEDs
-  if (xSemaphoreTake(colorMutex, pdMS_TO_TICKS(50)) == pdTRUE)
+  if (!written || storeNeedsCompaction(storeIndex, storeIndex.validLength))
   {
-    lightState.specialMode = MODE_NORMAL;
-    lightState.final_r = 0.0f;
-    lightState.final_g = 0.0f;
-    lightState.final_b = 0.0f;
-    lightState.final_level = 0.0f;
-    xSemaphoreGive(colorMutex);
+    storeRewrite();
   }
-
-  digitalWrite(LED_BUILTIN, LOW);
-
-  Serial.println("Resetting Zigbee network...");
-  // Zigbee.factoryReset();
-
-  Serial.println("System reset complete - device will restart");
-  vTaskDelay(pdMS_TO_TICKS(500));
-  ESP.restart();
 }
 
-// Apply effects to base color and return final output values
-void applyEffects(float baseR, float baseG, float baseB, float baseLevel,
-                  float &finalR, float &finalG, float &finalB, float &finalLevel)
+// Mount the partition and scan the record file into storeIndex
+void storeLoad()
 {
-
-  if (effectState.startTime == 0)
+  memset(&storeIndex, 0, sizeof(storeIndex));
+  storeMounted = LittleFS.begin(true);
+  if (!storeMounted)
   {
-    effectState.startTime = millis();
+    Serial.println("LittleFS mount failed, light state will not be saved");
+    return;
   }
+  LittleFS.remove(STORE_COMPACT_PATH); // Left over from a compaction cut short
 
-  unsigned long elapsed = millis() - effectState.startTime;
-  float time = elapsed / 1000.0f; // Convert to seconds
-
-  // Start with base values
-  finalR = baseR;
-  finalG = baseG;
-  finalB = baseB;
-  finalLevel = baseLevel;
-
-  switch (effectState.type)
+  File file = LittleFS.open(STORE_PATH, FILE_READ);
+  if (!file)
   {
-  case EFFECT_COLOR_WANDER:
+    return;
+  }
+  size_t fileLength = file.size();
+  uint8_t *image = (uint8_t *)malloc(STORE_MAX_FILE);
+  size_t length = image != NULL ? file.read(image, STORE_MAX_FILE) : 0;
+  file.close();
+  storeScan(image, length, storeIndex);
+  free(image);
+  Serial.printf("Store: %lu records, %u of %u bytes valid\n", (unsigned long)storeIndex.records,
+                (unsigned)storeIndex.validLength, (unsigned)fileLength);
+
+  if (storeNeedsCompaction(storeIndex, fileLength))
   {
-    // Update phase counters at different speeds for organic movement
-    effectState.phase1 += COLOR_WANDER_SPEED * 1.0f;
-    effectState.phase2 += COLOR_WANDER_SPEED * 1.3f;
-    effectState.phase3 += COLOR_WANDER_SPEED * 0.7f;
-
-    // Generate smooth wandering offsets using sine waves
-    float offsetR = sin(effectState.phase1) * COLOR_WANDER_RANGE;
-    float offsetG = sin(effectState.phase2) * COLOR_WANDER_RANGE;
-    float offsetB = sin(effectState.phase3) * COLOR_WANDER_RANGE;
-
-    // Apply offsets to base color
-    finalR = constrain(baseR + offsetR, 0.0f, 255.0f);
-    finalG = constrain(baseG + offsetG, 0.0f, 255.0f);
-    finalB = constrain(baseB + offsetB, 0.0f, 255.0f);
+    storeRewrite();
   }
-  break;
+}
 
-  case EFFECT_LEVEL_PULSE:
+// Add every program image in PROGRAM_DIR to the library
+void loadEffectPrograms()
+{
+  if (!storeMounted)
   {
-    // Update phase counter for pulsation
-    effectState.phase1 += LEVEL_PULSE_SPEED;
-
-    // Generate smooth pulsation using sine wave
-    float pulseMultiplier = 1.0f + (sin(effectState.phase1) * LEVEL_PULSE_RANGE);
-
-    // Apply pulsation to level
-    finalLevel = constrain(baseLevel * pulseMultiplier, 0.0f, 255.0f);
+    return;
   }
-  break;
-
-  case EFFECT_COMBO:
+  File dir = LittleFS.open(PROGRAM_DIR);
+  if (!dir || !dir.isDirectory())
   {
-    // Combine color wandering and level pulsation
-    // Update phase counters at different speeds for organic movement
-    effectState.phase1 += COLOR_WANDER_SPEED * 1.0f; // For color wander R
-    effectState.phase2 += COLOR_WANDER_SPEED * 1.3f; // For color wander G
-    effectState.phase3 += COLOR_WANDER_SPEED * 0.7f; // For color wander B
-
-    // Generate smooth wandering offsets using sine waves
-    float offsetR = sin(effectState.phase1) * COLOR_WANDER_RANGE;
-    float offsetG = sin(effectState.phase2) * COLOR_WANDER_RANGE;
-    float offsetB = sin(effectState.phase3) * COLOR_WANDER_RANGE;
-
-    // Apply offsets to base color
-    finalR = constrain(baseR + offsetR, 0.0f, 255.0f);
-    finalG = constrain(baseG + offsetG, 0.0f, 255.0f);
-    finalB = constrain(baseB + offsetB, 0.0f, 255.0f);
-
-    // Add level pulsation using a different phase counter
-    // Use time-based calculation to avoid phase counter conflicts
-    float pulsePhase = elapsed * LEVEL_PULSE_SPEED * 0.001f; // Convert to phase
-    float pulseMultiplier = 1.0f + (sin(pulsePhase) * LEVEL_PULSE_RANGE);
-
-    // Apply pulsation to level
-    finalLevel = constrain(baseLevel * pulseMultiplier, 0.0f, 255.0f);
+    return;
   }
-  break;
-
-  case EFFECT_SCENE_CHANGE:
+  uint8_t *image = (uint8_t *)malloc(VM_MAX_IMAGE);
+  for (File file = dir.openNextFile(); file && image != NULL; file = dir.openNextFile())
   {
-    // Initialize scene change if needed
-    if (effectState.sceneChangeTime == 0)
+    size_t length = file.read(image, VM_MAX_IMAGE);
+    if (length == file.size() && vmLibraryAdd(vmLibrary, image, length))
     {
-      // Start with current base values
-      effectState.sceneCurrentR = baseR;
-      effectState.sceneCurrentG = baseG;
-      effectState.sceneCurrentB = baseB;
-      effectState.sceneCurrentLevel = baseLevel;
-
-      // Generate first target based on base color variations
-      effectState.sceneTargetR = constrain(baseR + random(-50, 51), 0, 255);
-      effectState.sceneTargetG = constrain(baseG + random(-50, 51), 0, 255);
-      effectState.sceneTargetB = constrain(baseB + random(-50, 51), 0, 255);
-      effectState.sceneTargetLevel = constrain(baseLevel + random(-50, 51), 50, 255);
-
-      effectState.sceneChangeTime = millis();
-      effectState.sceneHoldTime = random(5000, 10000);      // 5-10 seconds hold
-      effectState.sceneTransitionTime = random(1000, 2000); // 1-2 seconds transition
-      effectState.sceneTransitioning = true;
-
-      Serial.printf("Scene change: New target R=%d G=%d B=%d L=%d\n",
-                    (int)effectState.sceneTargetR, (int)effectState.sceneTargetG,
-                    (int)effectState.sceneTargetB, (int)effectState.sceneTargetLevel);
-    }
-
-    unsigned long sceneElapsed = millis() - effectState.sceneChangeTime;
-
-    if (effectState.sceneTransitioning)
-    {
-      // Transition phase (1-2 seconds, time set once at start)
-      if (sceneElapsed < effectState.sceneTransitionTime)
-      {
-        // Smooth interpolation to target using fixed transition time
-        float progress = (float)sceneElapsed / effectState.sceneTransitionTime;
-        progress = min(progress, 1.0f);
-
-        // Use exponential interpolation for smoother transitions
-        float smoothProgress = progress * progress * (3.0f - 2.0f * progress); // Smoothstep
-
-        effectState.sceneCurrentR = effectState.sceneCurrentR + (effectState.sceneTargetR - effectState.sceneCurrentR) * smoothProgress * 0.1f;
-        effectState.sceneCurrentG = effectState.sceneCurrentG + (effectState.sceneTargetG - effectState.sceneCurrentG) * smoothProgress * 0.1f;
-        effectState.sceneCurrentB = effectState.sceneCurrentB + (effectState.sceneTargetB - effectState.sceneCurrentB) * smoothProgress * 0.1f;
-        effectState.sceneCurrentLevel = effectState.sceneCurrentLevel + (effectState.sceneTargetLevel - effectState.sceneCurrentLevel) * smoothProgress * 0.1f;
-
-        finalR = effectState.sceneCurrentR;
-        finalG = effectState.sceneCurrentG;
-        finalB = effectState.sceneCurrentB;
-        finalLevel = effectState.sceneCurrentLevel;
-      }
-      else
-      {
-        // Transition complete - switch to hold phase
-        effectState.sceneCurrentR = effectState.sceneTargetR;
-        effectState.sceneCurrentG = effectState.sceneTargetG;
-        effectState.sceneCurrentB = effectState.sceneTargetB;
-        effectState.sceneCurrentLevel = effectState.sceneTargetLevel;
-        effectState.sceneTransitioning = false;
-        effectState.sceneChangeTime = millis(); // Reset timer for hold phase
-
-        finalR = effectState.sceneCurrentR;
-        finalG = effectState.sceneCurrentG;
-        finalB = effectState.sceneCurrentB;
-        finalLevel = effectState.sceneCurrentLevel;
-      }
+      uint8_t count = vmLibrary.count.load(std::memory_order_relaxed);
+      Serial.printf("Effect program %u: %s\n", count, vmLibrary.programs[count - 1].name);
     }
     else
     {
-      // Hold phase (5-10 seconds)
-      if (sceneElapsed < effectState.sceneHoldTime)
-      {
-        // Hold current scene
-        finalR = effectState.sceneCurrentR;
-        finalG = effectState.sceneCurrentG;
-        finalB = effectState.sceneCurrentB;
-        finalLevel = effectState.sceneCurrentLevel;
-      }
-      else
-      {
-        // Hold complete - generate new target based on base color variations
-        effectState.sceneTargetR = constrain(baseR + random(-50, 51), 0, 255);
-        effectState.sceneTargetG = constrain(baseG + random(-50, 51), 0, 255);
-        effectState.sceneTargetB = constrain(baseB + random(-50, 51), 0, 255);
-        effectState.sceneTargetLevel = constrain(baseLevel + random(-50, 51), 50, 255);
-
-        effectState.sceneChangeTime = millis();
-        effectState.sceneHoldTime = random(5000, 10000);      // New hold time
-        effectState.sceneTransitionTime = random(1000, 2000); // New transition time
-        effectState.sceneTransitioning = true;
-
-        Serial.printf("Scene change: New target R=%d G=%d B=%d L=%d\n",
-                      (int)effectState.sceneTargetR, (int)effectState.sceneTargetG,
-                      (int)effectState.sceneTargetB, (int)effectState.sceneTargetLevel);
-
-        // Start interpolating toward new target
-        finalR = effectState.sceneCurrentR;
-        finalG = effectState.sceneCurrentG;
-        finalB = effectState.sceneCurrentB;
-        finalLevel = effectState.sceneCurrentLevel;
-      }
+      Serial.printf("Effect program %s skipped: invalid, or the library is full\n", file.name());
     }
+    file.close();
   }
-  break;
+  free(image);
+}
 
-  case EFFECT_FIREPLACE:
+// Map the keyframe partition, check the track in it and hand it to
+// EFFECT_KEYFRAMES. Stays mapped for good: playback reads the flash through
+// the cache.
+void mapKeyframeTrack()
+{
+  static KeyframeTrack track;
+  const esp_partition_t *partition =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, KEYFRAME_PARTITION);
+  if (partition == NULL)
   {
-    // Simulate realistic fireplace flickering with warm colors
-    // Update multiple phase counters for organic flame movement
-    effectState.phase1 += FIREPLACE_FLICKER_SPEED * 1.0f; // Main flicker
-    effectState.phase2 += FIREPLACE_FLICKER_SPEED * 1.7f; // Secondary flicker
-    effectState.phase3 += FIREPLACE_FLICKER_SPEED * 0.6f; // Slow ember glow
-
-    // Generate multiple sine waves for realistic flame behavior
-    float mainFlicker = sin(effectState.phase1);
-    float secondaryFlicker = sin(effectState.phase2) * 0.4f;
-    float emberGlow = sin(effectState.phase3) * 0.2f;
-
-    // Combine flickers with bias toward brighter flames
-    float totalFlicker = (mainFlicker + secondaryFlicker + emberGlow + 1.5f) / 3.5f;
-    totalFlicker = constrain(totalFlicker, 0.0f, 1.0f);
-
-    // Create subtle warm fire colors closer to base
-    float fireRed = baseR * FIREPLACE_RED_BOOST;
-    float fireGreen = baseG * (0.9f + FIREPLACE_ORANGE_MIX * totalFlicker); // Subtle orange tint
-    float fireBlue = baseB * 0.8f;                                          // Slightly reduce blue for warmth
-
-    // Apply intensity variations for flickering (reduced range)
-    float intensity = 1.0f - (FIREPLACE_INTENSITY_RANGE * (1.0f - totalFlicker));
-
-    // Constrain colors to valid range
-    finalR = constrain(fireRed, 0.0f, 255.0f);
-    finalG = constrain(fireGreen, 0.0f, 255.0f);
-    finalB = constrain(fireBlue, 0.0f, 255.0f);
-    finalLevel = constrain(baseLevel * intensity, baseLevel * 0.7f, baseLevel);
+    Serial.println("No anim partition, keyframe playback disabled");
+    return;
   }
-  break;
-
-  case EFFECT_RAINBOW:
+  const void *data = NULL;
+  esp_partition_mmap_handle_t mapping;
+  if (esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &data, &mapping) != ESP_OK)
   {
-    // Smooth rainbow color cycling based on base color
-    effectState.phase1 += RAINBOW_CYCLE_SPEED;
-
-    // Cycle hue around base color (±120 degrees for variety while staying related)
-    float hueOffset = sin(effectState.phase1) * 120.0f; // -120 to +120 degrees
-
-    // Convert base color to approximate hue for starting point
-    float baseHue = 0.0f;
-    if (baseR >= baseG && baseR >= baseB)
-    {
-      // Red dominant
-      baseHue = 0.0f + (baseG - baseB) / (baseR - min(baseG, baseB)) * 60.0f;
-    }
-    else if (baseG >= baseR && baseG >= baseB)
-    {
-      // Green dominant
-      baseHue = 120.0f + (baseB - baseR) / (baseG - min(baseR, baseB)) * 60.0f;
-    }
-    else
-    {
-      // Blue dominant
-      baseHue = 240.0f + (baseR - baseG) / (baseB - min(baseR, baseG)) * 60.0f;
-    }
-
-    // Calculate final hue with offset
-    uint8_t finalHue = (uint8_t)constrain((baseHue + hueOffset) * 255.0f / 360.0f, 0, 255);
-
-    // Use existing hueToRGB function with base brightness
-    uint32_t rainbowR, rainbowG, rainbowB;
-    hueToRGB(finalHue, (uint8_t)baseLevel, rainbowR, rainbowG, rainbowB);
-
-    // Blend with base color to maintain base characteristics
-    float blendFactor = 0.08f; // 8% rainbow, 92% base color
-    finalR = rainbowR * blendFactor + baseR * (1.0f - blendFactor);
-    finalG = rainbowG * blendFactor + baseG * (1.0f - blendFactor);
-    finalB = rainbowB * blendFactor + baseB * (1.0f - blendFactor);
-    finalLevel = baseLevel; // Keep original brightness level
-
-    // Constrain to valid range
-    finalR = constrain(finalR, 0.0f, 255.0f);
-    finalG = constrain(finalG, 0.0f, 255.0f);
-    finalB = constrain(finalB, 0.0f, 255.0f);
+    Serial.println("Mapping the anim partition failed");
+    return;
   }
-  break;
-
-  case EFFECT_COLOR_STEPS:
+  if (!keyframeOpen(track, (const uint8_t *)data, partition->size))
   {
-    // Rapid color steps - like color wander but with sudden jumps at intervals
-    // Check if enough time has passed for a new step
-    if (effectState.sceneChangeTime == 0 || (time - effectState.sceneChangeTime) >= COLOR_STEPS_INTERVAL)
-    {
-      // Time for a new color step
-      effectState.sceneChangeTime = time;
-
-      // Generate new random offsets for each channel, similar to color wander but larger range
-      float offsetR = (random(0, 2001) - 1000) * COLOR_STEPS_RANGE / 1000.0f; // -30 to +30
-      float offsetG = (random(0, 2001) - 1000) * COLOR_STEPS_RANGE / 1000.0f; // -30 to +30
-      float offsetB = (random(0, 2001) - 1000) * COLOR_STEPS_RANGE / 1000.0f; // -30 to +30
-
-      // Store the new target in scene variables (reusing existing structure)
-      effectState.sceneTargetR = constrain(baseR + offsetR, 0.0f, 255.0f);
-      effectState.sceneTargetG = constrain(baseG + offsetG, 0.0f, 255.0f);
-      effectState.sceneTargetB = constrain(baseB + offsetB, 0.0f, 255.0f);
-    }
-
-    // Apply the current step values (instant change - no interpolation)
-    finalR = effectState.sceneTargetR;
-    finalG = effectState.sceneTargetG;
-    finalB = effectState.sceneTargetB;
+    Serial.println("No valid keyframe track in the anim partition");
+    esp_partition_munmap(mapping);
+    return;
   }
-  break;
+  keyframeActive.store(&track, std::memory_order_release);
+  wakeLedTask(); // A lamp restored to KEYFRAMES idles on the base until now
+  Serial.printf("Keyframes: %lu over %lu ms%s\n", (unsigned long)track.keyCount, (unsigned long)track.durationMs,
+                track.loop ? ", looping" : "");
+}
 
-  case EFFECT_BROKEN_ELECTRICITY:
+void wakePersistTask()
+{
+  if (persistTaskHandle != NULL)
   {
-    // Horror movie broken electricity - mostly stable with rare dramatic flickers
-    // Use phase1 as state: 0=stable, 1=in_event, 2=returning_to_stable
+    xTaskNotifyGive(persistTaskHandle);
+  }
+}
 
-    // Initialize with stable state if first time
-    if (effectState.sceneChangeTime == 0)
+// Saves the light state once a burst of changes is over. Runs at the lowest
+// priority so flash writes never hold up rendering or the Zigbee stack.
+void persistTask(void *parameter)
+{
+  PersistCoalescer coalescer = {false, 0, 0};
+  uint32_t targetSequence = 0;
+  PersistedLight current = savedLight;
+  while (true)
+  {
+    uint32_t wait = coalescerWait(coalescer, millis());
+    ulTaskNotifyTake(pdTRUE, wait == PERSIST_IDLE ? portMAX_DELAY : pdMS_TO_TICKS(wait));
+
+    PersistedLight latest = current;
+    targetMailboxRead(targetMailbox, targetSequence, latest.targets);
+    latest.effect = (EffectType)persistEffect.load(std::memory_order_relaxed);
+    latest.program = vmSelected.load(std::memory_order_relaxed);
+    if (!persistedEqual(latest, current))
     {
-      effectState.phase1 = 0; // Start in stable state
-      effectState.sceneTargetR = baseR;
-      effectState.sceneTargetG = baseG;
-      effectState.sceneTargetB = baseB;
-      effectState.sceneTargetLevel = baseLevel;
-
-      // Set next event time (2-8 seconds from now)
-      effectState.sceneTransitionTime = ELECTRICITY_STABLE_MIN +
-                                        (random(0, 1001) / 1000.0f) * (ELECTRICITY_STABLE_MAX - ELECTRICITY_STABLE_MIN);
-      effectState.sceneChangeTime = time;
+      current = latest;
+      coalescerChange(coalescer, millis());
+      portENTER_CRITICAL(&storeStatsLock);
+      storeStats.changes++;
+      portEXIT_CRITICAL(&storeStatsLock);
     }
 
-    float timeSinceLastChange = time - effectState.sceneChangeTime;
-
-    if (effectState.phase1 == 0) // Stable state - waiting for next event
-    {
-      if (timeSinceLastChange >= effectState.sceneTransitionTime)
-      {
-        // Time for an electrical event - roll for type
-        float eventRoll = random(0, 1001) / 1000.0f;
-        effectState.phase1 = 1; // Switch to event state
-
-        if (eventRoll < ELECTRICITY_BLACKOUT_CHANCE)
-        {
-          // Complete blackout
-          effectState.sceneTargetR = 0.0f;
-          effectState.sceneTargetG = 0.0f;
-          effectState.sceneTargetB = 0.0f;
-          effectState.sceneTargetLevel = 0.0f;
-          effectState.sceneTransitionTime = ELECTRICITY_BLACKOUT_DURATION;
-        }
-        else if (eventRoll < ELECTRICITY_BLACKOUT_CHANCE + ELECTRICITY_SURGE_CHANCE)
-        {
-          // Bright surge
-          effectState.sceneTargetR = min(255.0f, baseR * ELECTRICITY_SURGE_MULTIPLIER);
-          effectState.sceneTargetG = min(255.0f, baseG * ELECTRICITY_SURGE_MULTIPLIER);
-          effectState.sceneTargetB = min(255.0f, baseB * ELECTRICITY_SURGE_MULTIPLIER);
-          effectState.sceneTargetLevel = min(255.0f, baseLevel * ELECTRICITY_SURGE_MULTIPLIER);
-          effectState.sceneTransitionTime = 0.1f;
-        }
-        else if (eventRoll < ELECTRICITY_BLACKOUT_CHANCE + ELECTRICITY_SURGE_CHANCE + ELECTRICITY_FLICKER_CHANCE)
-        {
-          // Quick flicker
-          float variation = 0.4f + (random(0, 601) / 1000.0f);
-          effectState.sceneTargetR = baseR * variation;
-          effectState.sceneTargetG = baseG * variation;
-          effectState.sceneTargetB = baseB * variation;
-          effectState.sceneTargetLevel = baseLevel * variation;
-          effectState.sceneTransitionTime = 0.05f + (random(0, 101) / 1000.0f);
-        }
-        else
-        {
-          // No event this time - stay stable
-          effectState.phase1 = 0;
-          effectState.sceneTransitionTime = ELECTRICITY_STABLE_MIN +
-                                            (random(0, 1001) / 1000.0f) * (ELECTRICITY_STABLE_MAX - ELECTRICITY_STABLE_MIN);
-        }
-
-        effectState.sceneChangeTime = time;
-      }
-    }
-    else if (effectState.phase1 == 1) // In event state
+    if (coalescerWait(coalescer, millis()) == 0)
     {
-      if (timeSinceLastChange >= effectState.sceneTransitionTime)
+      coalescerWritten(coalescer);
+      if (!persistedEqual(current, savedLight)) // Changed back and forth: nothing to write
       {
-        // Event duration over - return to stable
-        effectState.phase1 = 0;
-        effectState.sceneTargetR = baseR;
-        effectState.sceneTargetG = baseG;
-        effectState.sceneTargetB = baseB;
-        effectState.sceneTargetLevel = baseLevel;
-
-        // Set next stable duration
-        effectState.sceneTransitionTime = ELECTRICITY_STABLE_MIN +
-                                          (random(0, 1001) / 1000.0f) * (ELECTRICITY_STABLE_MAX - ELECTRICITY_STABLE_MIN);
-        effectState.sceneChangeTime = time;
+        uint8_t payload[PERSISTED_ENCODED_SIZE];
+        persistedEncode(current, payload);
+        storeAppend(STORE_KEY_LIGHT, payload, sizeof(payload));
+        savedLight = current;
       }
     }
+  }
+}
 
-    // Apply current electrical state
-    finalR = effectState.sceneTargetR;
-    finalG = effectState.sceneTargetG;
-    finalB = effectState.sceneTargetB;
-    finalLevel = effectState.sceneTargetLevel;
+#ifdef PELARBOJ_LIGHT_SLEEP
+// A press wakes the button task, which otherwise sleeps while the button is idle
+static void IRAM_ATTR buttonInterrupt()
+{
+  BaseType_t higherPriorityTaskWoken = pdFALSE;
+  if (buttonTaskHandle != NULL)
+  {
+    vTaskNotifyGiveFromISR(buttonTaskHandle, &higherPriorityTaskWoken);
+  }
+  if (higherPriorityTaskWoken)
+  {
+    portYIELD_FROM_ISR();
   }
-  break;
+}
 
-  case EFFECT_BREATHING:
+#ifdef CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+// Runs with interrupts disabled on the way out of every light sleep
+static esp_err_t lightSleepExit(int64_t sleepTimeUs, void *arg)
+{
+  residencyAddSleep(residency, (uint32_t)sleepTimeUs);
+  return ESP_OK;
+}
+#endif
+#endif
+
+// Let the chip drop into automatic light sleep whenever every task is blocked
+// and no driver holds a power lock - the Zigbee radio takes one while it has to
+// listen, so a router sleeps only as much as the stack allows. Called before
+// the LEDC channels are attached.
+void setupPowerManagement()
+{
+  renderCpuMhz = getCpuFrequencyMhz();
+#ifdef PELARBOJ_LIGHT_SLEEP
+  // Keep LEDC clocked from RC_FAST so the LEDs hold their duty through sleep
+  ledcSetClockSource(LEDC_USE_RC_FAST_CLK);
+  esp_sleep_pd_config(ESP_PD_DOMAIN_RC_FAST, ESP_PD_OPTION_ON);
+  gpio_sleep_sel_dis((gpio_num_t)ledR);
+  gpio_sleep_sel_dis((gpio_num_t)ledG);
+  gpio_sleep_sel_dis((gpio_num_t)ledB);
+
+  // Button presses end a light sleep and wake the button task
+  gpio_wakeup_enable((gpio_num_t)BOOT_PIN, GPIO_INTR_LOW_LEVEL);
+  gpio_wakeup_enable((gpio_num_t)EXTERNAL_BUTTON_PIN, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  attachInterrupt(digitalPinToInterrupt(BOOT_PIN), buttonInterrupt, FALLING);
+  attachInterrupt(digitalPinToInterrupt(EXTERNAL_BUTTON_PIN), buttonInterrupt, FALLING);
+
+#ifdef CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+  esp_pm_sleep_cbs_register_config_t callbacks = {};
+  callbacks.exit_cb = lightSleepExit;
+  esp_pm_light_sleep_register_cbs(&callbacks);
+#endif
+
+  esp_pm_config_t config = {};
+  config.max_freq_mhz = renderCpuMhz;
+  config.min_freq_mhz = getXtalFrequencyMhz();
+  config.light_sleep_enable = true;
+  esp_err_t result = esp_pm_configure(&config);
+  if (result != ESP_OK)
   {
-    // Slow organic breathing effect - like the light is alive and sleeping
-    // Update breathing phase very slowly for calm, meditative rhythm
-    effectState.phase1 += BREATHING_SPEED;
+    // PM or tickless idle compiled out of the framework: keep running awake
+    Serial.printf("Light sleep unavailable: %s\n", esp_err_to_name(result));
+  }
+  else
+  {
+    // Frequency scaling would render at XTAL speed between sleeps
+    esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "render", &renderLock);
+    Serial.println("Automatic light sleep enabled");
+  }
+#endif
+}
 
-    // Create breathing curve using sine wave - smooth inhale and exhale
-    float breathingCycle = sin(effectState.phase1);
+// Queue a button/mode event for the LED task
+void sendControlEvent(ControlEventType type)
+{
+  ControlEvent event = {type};
+  if (!controlQueuePush(controlQueue, event))
+  {
+    instrumentControlDrop(instrumentation);
+    LOG_ERROR("Control queue full, dropped event %d\n", type);
+  }
+  wakeLedTask();
+}
 
-    // Map breathing cycle to brightness range (20% to 100% of base level)
-    float breathingMultiplier = BREATHING_MIN_LEVEL +
-                                (BREATHING_MAX_LEVEL - BREATHING_MIN_LEVEL) * (breathingCycle * 0.5f + 0.5f);
+void toggleLightState()
+{
+  // Update internal state first
+  uint32_t publishStart = cpuCycleCount();
+  bool newState = targetMailboxTogglePower(targetMailbox);
+  instrumentPublish(instrumentation, cpuCycleCount() - publishStart);
+  wakeLedTask();
 
-    // Apply breathing to brightness level
-    finalLevel = constrain(baseLevel * breathingMultiplier, 0.0f, 255.0f);
+  // Then report to the coordinator - before joining, the join reports it
+  if (Zigbee.connected())
+  {
+    pelarboj->setLightState(newState);
+    pelarboj->zbUpdateStateFromAttributes();
+  }
 
-    // Add subtle color warmth variation synchronized with breathing
-    // Warmer (more red/yellow) on exhale, cooler (more blue) on inhale
-    float colorVariation = breathingCycle * BREATHING_COLOR_VARIATION;
+  LOG_INFO("Toggled light: %s\n", newState ? "ON" : "OFF");
+}
 
-    // Slightly increase red/decrease blue on exhale for warmth
-    finalR = constrain(baseR + colorVariation * 0.6f, 0.0f, 255.0f);
-    finalG = constrain(baseG + colorVariation * 0.3f, 0.0f, 255.0f);
-    finalB = constrain(baseB - colorVariation * 0.4f, 0.0f, 255.0f);
-  }
-  break;
+void performFactoryReset()
+{
+  LOG_INFO("=== Factory Reset Initiated ===\n");
 
-  case EFFECT_AUTO_CYCLE:
-  {
-    // Auto-cycle through all other effects randomly with smooth transitions
-    // Uses dedicated auto-cycle variables to avoid conflicts with sub-effects
+  // Start reset blinking mode - LED task will handle blinking
+  sendControlEvent(CONTROL_RESET_START);
 
-    // Initialize auto-cycle if first time
-    if (effectState.autoCycleStartTime == 0)
-    {
-      // Pick random first effect (exclude EFFECT_NONE=0 and EFFECT_AUTO_CYCLE=10)
-      effectState.autoCycleSubEffect = 1 + random(0, 9); // Random from 1-9
-      effectState.autoCycleNeedsReset = true;
-      effectState.autoCycleInTransition = false;
-
-      // Set random duration for first effect
-      effectState.autoCycleDuration = AUTO_CYCLE_MIN_TIME +
-                                      (random(0, 1001) / 1000.0f) * (AUTO_CYCLE_MAX_TIME - AUTO_CYCLE_MIN_TIME);
-      effectState.autoCycleStartTime = time;
-    }
+  // Wait for 5 seconds while checking if button is still pressed
+  for (int i = 0; i < 50; i++)
+  { // Check every 100ms for 5 seconds
+    if (digitalRead(BOOT_PIN) == HIGH && digitalRead(EXTERNAL_BUTTON_PIN) == HIGH)
+    { // Button released
+      LOG_INFO("Button released - reset cancelled\n");
 
-    // Check if it's time to start transition to next effect
-    if (!effectState.autoCycleInTransition &&
-        (time - effectState.autoCycleStartTime) >= (effectState.autoCycleDuration - AUTO_CYCLE_TRANSITION_TIME))
-    {
-      // Start transition - capture current effect output for blending
-      EffectType originalType = effectState.type;
-      effectState.type = (EffectType)effectState.autoCycleSubEffect;
-      applyEffects(baseR, baseG, baseB, baseLevel,
-                   effectState.autoCyclePrevR, effectState.autoCyclePrevG,
-                   effectState.autoCyclePrevB, effectState.autoCyclePrevLevel);
-      effectState.type = originalType;
-
-      // Set up transition
-      effectState.autoCyclePrevEffect = effectState.autoCycleSubEffect;
-      effectState.autoCycleInTransition = true;
-      effectState.autoCycleTransitionStart = time;
-
-      // Pick new effect (different from current)
-      int newEffect;
-      do
-      {
-        newEffect = 1 + random(0, 9); // Random from 1-9
-      } while (newEffect == effectState.autoCycleSubEffect);
+      // Stop reset mode and restore normal operation
+      sendControlEvent(CONTROL_RESET_CANCEL);
 
-      effectState.autoCycleSubEffect = newEffect;
-      effectState.autoCycleNeedsReset = true;
+      digitalWrite(LED_BUILTIN, LOW);
+      return; // Exit without resetting
     }
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
 
-    // Check if transition is complete
-    if (effectState.autoCycleInTransition &&
-        (time - effectState.autoCycleTransitionStart) >= AUTO_CYCLE_TRANSITION_TIME)
-    {
-      // Transition complete - start new effect duration
-      effectState.autoCycleInTransition = false;
-      effectState.autoCycleDuration = AUTO_CYCLE_MIN_TIME +
-                                      (random(0, 1001) / 1000.0f) * (AUTO_CYCLE_MAX_TIME - AUTO_CYCLE_MIN_TIME);
-      effectState.autoCycleStartTime = time;
-    }
+  // If we get here, button was held for full 5 seconds - proceed with reset
+  LOG_INFO("Reset confirmed - proceeding with factory reset\n");
 
-    // Reset sub-effect state if needed (when switching effects)
-    if (effectState.autoCycleNeedsReset)
-    {
-      // Reset all effect state variables for clean sub-effect start
-      effectState.phase1 = 0;
-      effectState.phase2 = 0;
-      effectState.phase3 = 0;
-      effectState.sceneCurrentR = baseR;
-      effectState.sceneCurrentG = baseG;
-      effectState.sceneCurrentB = baseB;
-      effectState.sceneCurrentLevel = baseLevel;
-      effectState.sceneTargetR = baseR;
-      effectState.sceneTargetG = baseG;
-      effectState.sceneTargetB = baseB;
-      effectState.sceneTargetLevel = baseLevel;
-      effectState.sceneChangeTime = 0;
-      effectState.sceneTransitionTime = 0;
-      effectState.sceneHoldTime = 0;
-      effectState.sceneTransitioning = false;
-      effectState.autoCycleNeedsReset = false;
-    }
+  // Stop reset mode and turn off LEDs
+  sendControlEvent(CONTROL_RESET_BLANK);
 
-    if (effectState.autoCycleInTransition)
-    {
-      // During transition - blend between previous and current effects
-      float transitionProgress = (time - effectState.autoCycleTransitionStart) / AUTO_CYCLE_TRANSITION_TIME;
-      transitionProgress = constrain(transitionProgress, 0.0f, 1.0f);
-
-      // Get current effect output
-      EffectType originalType = effectState.type;
-      effectState.type = (EffectType)effectState.autoCycleSubEffect;
-      float currentR, currentG, currentB, currentLevel;
-      applyEffects(baseR, baseG, baseB, baseLevel, currentR, currentG, currentB, currentLevel);
-      effectState.type = originalType;
-
-      // Smooth interpolation using smoothstep for natural feel
-      float smoothProgress = transitionProgress * transitionProgress * (3.0f - 2.0f * transitionProgress);
-
-      // Blend between previous and current effects
-      finalR = effectState.autoCyclePrevR * (1.0f - smoothProgress) + currentR * smoothProgress;
-      finalG = effectState.autoCyclePrevG * (1.0f - smoothProgress) + currentG * smoothProgress;
-      finalB = effectState.autoCyclePrevB * (1.0f - smoothProgress) + currentB * smoothProgress;
-      finalLevel = effectState.autoCyclePrevLevel * (1.0f - smoothProgress) + currentLevel * smoothProgress;
-    }
-    else
-    {
-      // Not in transition - run current effect normally
-      EffectType originalType = effectState.type;
-      effectState.type = (EffectType)effectState.autoCycleSubEffect;
-      applyEffects(baseR, baseG, baseB, baseLevel, finalR, finalG, finalB, finalLevel);
-      effectState.type = originalType;
-    }
-  }
-  break;
+  digitalWrite(LED_BUILTIN, LOW);
 
-  case EFFECT_NONE:
-  default:
-    // No effects - final = base
-    break;
-  }
+  LOG_INFO("Resetting Zigbee network...\n");
+  // Zigbee.factoryReset();
+
+  LOG_INFO("System reset complete - device will restart\n");
+  vTaskDelay(pdMS_TO_TICKS(500));
+  ESP.restart();
 }
 
 // LED update task that handles smooth color interpolation and effects
@@ -957,7 +547,7 @@ void buttonTask(void *parameter)
         buttonHandler.isPressed = true;
         buttonHandler.pressStartTime = currentTime;
         buttonHandler.state = BTN_FIRST_PRESS;
-        Serial.println("Button pressed - first press detected");
+        LOG_INFO("Button pressed - first press detected\n");
       }
       break;
 
@@ -968,13 +558,13 @@ void buttonTask(void *parameter)
         buttonHandler.isPressed = false;
         buttonHandler.releaseTime = currentTime;
         buttonHandler.state = BTN_WAITING_SECOND;
-        Serial.println("Button released - waiting for second press");
+        LOG_INFO("Button released - waiting for second press\n");
       }
       else if (currentReading && (currentTime - buttonHandler.pressStartTime) >= LONG_PRESS_TIME_MS)
       {
         // Long press detected
         buttonHandler.state = BTN_LONG_PRESS_ACTIVE;
-        Serial.println("Long press detected - factory reset");
+        LOG_INFO("Long press detected - factory reset\n");
         performFactoryReset();
         buttonHandler.state = BTN_IDLE;
         buttonHandler.isPressed = false;
@@ -988,12 +578,12 @@ void buttonTask(void *parameter)
         buttonHandler.isPressed = true;
         buttonHandler.pressStartTime = currentTime;
         buttonHandler.state = BTN_SECOND_PRESS;
-        Serial.println("Second press detected - double press");
+        LOG_INFO("Second press detected - double press\n");
       }
       else if ((currentTime - buttonHandler.releaseTime) >= DOUBLE_PRESS_WINDOW_MS)
       {
         // Timeout - single press confirmed
-        Serial.println("Single press confirmed - toggling light");
+        LOG_INFO("Single press confirmed - toggling light\n");
         toggleLightState();
         buttonHandler.state = BTN_IDLE;
       }
@@ -1004,18 +594,15 @@ void buttonTask(void *parameter)
       {
         // Second press completed - double press confirmed
         buttonHandler.isPressed = false;
-        Serial.println("Double press confirmed - switching effect");
-        switchToNextEffect();
-        // Blink the effect number (1-7) instead of enum value (0-6)
-        uint8_t effectNumber = effectState.type + 1; // Convert 0-6 to 1-7
-        blinkEffectNumber(effectNumber);
+        LOG_INFO("Double press confirmed - switching effect\n");
+        sendControlEvent(CONTROL_NEXT_EFFECT); // LED task switches and blinks the number
         buttonHandler.state = BTN_IDLE;
       }
       else if (currentReading && (currentTime - buttonHandler.pressStartTime) >= LONG_PRESS_TIME_MS)
       {
         // Long press during second press
         buttonHandler.state = BTN_LONG_PRESS_ACTIVE;
-        Serial.println("Long press during second press - factory reset");
+        LOG_INFO("Long press during second press - factory reset\n");
         performFactoryReset();
         buttonHandler.state = BTN_IDLE;
         buttonHandler.isPressed = false;
@@ -1032,154 +619,211 @@ void buttonTask(void *parameter)
       break;
     }
 
+#ifdef PELARBOJ_LIGHT_SLEEP
+    if (buttonHandler.state == BTN_IDLE && !currentReading)
+    {
+      // Nothing in progress - sleep until the button interrupt fires
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BUTTON_IDLE_POLL_MS));
+      continue;
+    }
+#endif
     vTaskDelay(pdMS_TO_TICKS(10)); // Check every 10ms
   }
 }
 
+// Fade all three channels from their current duty to end over ms in hardware
+void startHardwareFade(const PwmOutput &end, uint32_t ms)
+{
+  ledcFade(ledR, ledcRead(ledR), end.r, ms);
+  ledcFade(ledG, ledcRead(ledG), end.g, ms);
+  ledcFade(ledB, ledcRead(ledB), end.b, ms);
+}
+
+// Freeze any fade still running (cut short by a notification) at its current
+// duty, so the next fade or ledcWrite does not wait for it to finish
+void stopHardwareFade()
+{
+  const uint8_t channels[] = {LED_CHANNEL_R, LED_CHANNEL_G, LED_CHANNEL_B};
+  for (uint8_t channel : channels)
+  {
+    ledc_fade_stop((ledc_mode_t)(channel / SOC_LEDC_CHANNEL_NUM), (ledc_channel_t)(channel % SOC_LEDC_CHANNEL_NUM));
+  }
+}
+
+// Light sleep: frames run at renderCpuMhz, not at whatever frequency scaling
+// left the CPU at, so they take as long as the instrumentation measures
+static void renderSpeedHold()
+{
+#ifdef PELARBOJ_LIGHT_SLEEP
+  if (renderLock != NULL)
+  {
+    esp_pm_lock_acquire(renderLock);
+  }
+#endif
+}
+
+static void renderSpeedRelease()
+{
+#ifdef PELARBOJ_LIGHT_SLEEP
+  if (renderLock != NULL)
+  {
+    esp_pm_lock_release(renderLock);
+  }
+#endif
+}
+
 void ledUpdateTask(void *parameter)
 {
-  randomSeed(random_seed);
+  LedTaskState task;
+  ledTaskStart(task, millis());
+  bool notified = false; // Whether the last wait was cut short by a notification
+  uint32_t layerCostReport = task.clock.now;
+  residencyTakeWindow(residency, micros()); // First report window starts with the task
   while (true)
   {
-    if (xSemaphoreTake(colorMutex, pdMS_TO_TICKS(5)) == pdTRUE)
+    renderSpeedHold();
+    uint32_t frameStartUs = micros();
+    residencyFrameStart(residency, frameStartUs, notified);
+    instrumentFrameStart(instrumentation, frameStartUs, cpuCycleCount(), notified);
+
+    if (task.fading)
     {
-      // Check special modes first
-      if (lightState.specialMode == MODE_RESET_BLINKING)
-      {
-        uint32_t elapsed = millis() - lightState.modeStartTime;
+      stopHardwareFade();
+    }
+    LedFrame frame = ledTaskFrame(task, lightState, effectState, targetMailbox, controlQueue, millis(),
+                                  USE_HARDWARE_FADE);
+    if (frame.mailboxRetry)
+    {
+      instrumentMailboxRetry(instrumentation);
+    }
+    if (frame.changed)
+    {
+      persistEffect.store(selectedEffect(lightState, effectState), std::memory_order_relaxed);
+      wakePersistTask();
+    }
 
-        // Slow pulsation during reset (1Hz pulse, 30%-100% range)
-        float pulse = (sin(elapsed * 0.006283f) + 1.0f) * 0.5f; // 0.006283 = 2*PI/1000 for 1Hz
-        float level = 0.3f + (pulse * 0.7f);                    // 30% to 100% range
+    if (frame.fade)
+    {
+      // Plain transition: program the next segment and sleep through it
+      startHardwareFade(frame.pwm, frame.wait);
+
+      uint32_t frameEndUs = micros();
+      residencyFrameEnd(residency, frameEndUs);
+      instrumentFrameEnd(instrumentation, frameEndUs, cpuCycleCount(), frame.wait);
+      renderSpeedRelease();
+      notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(frame.wait)) > 0;
+      continue;
+    }
 
-        lightState.final_r = 255.0f;
-        lightState.final_g = 0.0f;
-        lightState.final_b = 0.0f;
-        lightState.final_level = level * 255.0f;
+    // Layered effects report what each layer costs
+    if (effectState.type == EFFECT_LAYERED && task.clock.now - layerCostReport >= LAYER_COST_REPORT_MS)
+    {
+      compositorLogCost(effectState.composite.layers);
+      layerCostReport = task.clock.now;
+    }
 
-        // Also pulse built-in LED
-        digitalWrite(LED_BUILTIN, pulse > 0.5f ? HIGH : LOW);
-      }
-      else if (lightState.specialMode == MODE_EFFECT_BLINKING)
-      {
-        uint32_t elapsed = millis() - lightState.modeStartTime;
-
-        // Fast pulsation for effect indication (2Hz pulse, 30%-100% range)
-        float pulse = (sin(elapsed * 0.012566f) + 1.0f) * 0.5f; // 0.012566 = 2*PI/500 for 2Hz
-        float level = 0.3f + (pulse * 0.7f);                    // 30% to 100% range
-
-        // Use saved current color
-        lightState.final_r = lightState.savedR;
-        lightState.final_g = lightState.savedG;
-        lightState.final_b = lightState.savedB;
-        lightState.final_level = level * 255.0f;
-
-        // Count pulses instead of discrete blinks
-        uint32_t pulseCount = elapsed / 500; // One complete pulse cycle every 500ms
-        if (pulseCount >= lightState.blinkCount)
-        {
-          Serial.printf("Pulse mode finished, restoring effect: %d\n", lightState.savedEffect);
-          lightState.specialMode = MODE_NORMAL;
-          effectState.type = lightState.savedEffect; // Restore effect
-        }
-      }
-      else
-      {
-        // Normal operation
-        // Smooth interpolation toward target values (creates base color)
-        lightState.base_r += (lightState.target_r - lightState.base_r) * TRANSITION_SPEED;
-        lightState.base_g += (lightState.target_g - lightState.base_g) * TRANSITION_SPEED;
-        lightState.base_b += (lightState.target_b - lightState.base_b) * TRANSITION_SPEED;
-        lightState.base_level += (lightState.target_level - lightState.base_level) * TRANSITION_SPEED;
-        lightState.base_state = lightState.target_state;
-
-        // Skip effect calculations when light is off for better performance
-        if (lightState.base_state)
-        {
-          // Apply effects to base values to get final values
-          applyEffects(lightState.base_r, lightState.base_g, lightState.base_b, lightState.base_level,
-                       lightState.final_r, lightState.final_g, lightState.final_b, lightState.final_level);
-        }
-        else
-        {
-          // Light is off - just copy base values to final (no effects processing)
-          lightState.final_r = lightState.base_r;
-          lightState.final_g = lightState.base_g;
-          lightState.final_b = lightState.base_b;
-          lightState.final_level = lightState.base_level;
-        }
-      }
+    // Also pulse built-in LED during reset
+    if (lightState.specialMode == MODE_RESET_BLINKING)
+    {
+      digitalWrite(LED_BUILTIN, lightState.statusLedOn ? HIGH : LOW);
+    }
 
-      xSemaphoreGive(colorMutex);
+    // Serial.printf("%d %d %d\n", frame.pwm.r, frame.pwm.g, frame.pwm.b);
 
-      // Calculate final RGB values with brightness applied
-      // In special modes, ignore base_state and use final values directly
-      float outputR, outputG, outputB;
-      if (lightState.specialMode != MODE_NORMAL)
-      {
-        outputR = lightState.final_r * (lightState.final_level / 255.0f);
-        outputG = lightState.final_g * (lightState.final_level / 255.0f);
-        outputB = lightState.final_b * (lightState.final_level / 255.0f);
-      }
-      else
-      {
-        if (lightState.base_state)
-        {
-          // Scale up colors so RGB sum equals brightness level
-          float colorSum = lightState.final_r + lightState.final_g + lightState.final_b;
-          if (colorSum > 0 && colorSum < lightState.final_level)
-          {
-            float scaleFactor = lightState.final_level / colorSum;
-            outputR = (lightState.final_r * scaleFactor * (lightState.final_level / 255.0f));
-            outputG = (lightState.final_g * scaleFactor * (lightState.final_level / 255.0f));
-            outputB = (lightState.final_b * scaleFactor * (lightState.final_level / 255.0f));
-          }
-          else
-          {
-            outputR = lightState.final_r * (lightState.final_level / 255.0f);
-            outputG = lightState.final_g * (lightState.final_level / 255.0f);
-            outputB = lightState.final_b * (lightState.final_level / 255.0f);
-          }
-        }
-        else
-        {
-          outputR = 0.0f;
-          outputG = 0.0f;
-          outputB = 0.0f;
-        }
-      }
+    // Apply to LED hardware with 12-bit resolution; a dither step that did
+    // not carry leaves the duty as it is
+    if (!frame.hold)
+    {
+      ledcWrite(ledR, frame.pwm.r);
+      ledcWrite(ledG, frame.pwm.g);
+      ledcWrite(ledB, frame.pwm.b);
+      bootMark(bootTimeline.firstPwmUs, micros());
+    }
 
-      // Scale to 12-bit PWM range (0-4095) for ultra-smooth output
-      uint16_t pwmR = (uint16_t)constrain(outputR * (LED_PWM_MAX_VALUE / 255.0f), 0, LED_PWM_MAX_VALUE);
-      uint16_t pwmG = (uint16_t)constrain(outputG * (LED_PWM_MAX_VALUE / 255.0f), 0, LED_PWM_MAX_VALUE);
-      uint16_t pwmB = (uint16_t)constrain(outputB * (LED_PWM_MAX_VALUE / 255.0f), 0, LED_PWM_MAX_VALUE);
+    // Sleep until the next frame is due; new targets and control events
+    // notify the task and end the wait early
+    uint32_t interval = frame.wait;
+    uint32_t frameEndUs = micros();
+    residencyFrameEnd(residency, frameEndUs);
+    instrumentFrameEnd(instrumentation, frameEndUs, cpuCycleCount(), interval == FRAME_INTERVAL_IDLE ? 0 : interval);
+    renderSpeedRelease();
+    notified = ulTaskNotifyTake(pdTRUE, interval == FRAME_INTERVAL_IDLE ? portMAX_DELAY : pdMS_TO_TICKS(interval)) > 0;
+  }
+}
 
-      // Serial.printf("%d %d %d\n", pwmR, pwmG, pwmB);
+// A Color Control attribute of the light, or nullptr when the stack has none
+static const void *colorAttribute(uint16_t id)
+{
+  esp_zb_zcl_attr_t *attribute =
+      esp_zb_zcl_get_attribute(ENDPOINT, ESP_ZB_ZCL_CLUSTER_ID_COLOR_CONTROL, ESP_ZB_ZCL_CLUSTER_SERVER_ROLE, id);
+  return attribute ? attribute->data_p : nullptr;
+}
 
-      // Apply to LED hardware with 12-bit resolution
-      ledcWrite(ledR, pwmR);
-      ledcWrite(ledG, pwmG);
-      ledcWrite(ledB, pwmB);
+// The commanded color at full precision: the library hands on 8-bit sRGB,
+// so read the attributes the command set in its own color mode
+static WorkingColor commandColor(uint8_t red, uint8_t green, uint8_t blue, uint16_t mireds,
+                                 esp_zb_zcl_color_control_color_mode_t colorMode)
+{
+  if (colorMode == ESP_ZB_ZCL_COLOR_CONTROL_COLOR_MODE_TEMPERATURE)
+  {
+    return colorFromMireds(mireds);
+  }
+  if (colorMode == ESP_ZB_ZCL_COLOR_CONTROL_COLOR_MODE_CURRENT_X_Y)
+  {
+    const void *x = colorAttribute(ESP_ZB_ZCL_ATTR_COLOR_CONTROL_CURRENT_X_ID);
+    const void *y = colorAttribute(ESP_ZB_ZCL_ATTR_COLOR_CONTROL_CURRENT_Y_ID);
+    if (x && y)
+    {
+      return colorFromXy(*(const uint16_t *)x, *(const uint16_t *)y);
     }
-
-    vTaskDelay(pdMS_TO_TICKS(LED_UPDATE_RATE_MS));
   }
+  else if (colorMode == ESP_ZB_ZCL_COLOR_CONTROL_COLOR_MODE_HUE_SATURATION)
+  {
+    const void *mode = colorAttribute(ESP_ZB_ZCL_ATTR_COLOR_CONTROL_ENHANCED_COLOR_MODE_ID);
+    const void *enhancedHue = colorAttribute(ESP_ZB_ZCL_ATTR_COLOR_CONTROL_ENHANCED_CURRENT_HUE_ID);
+    const void *hue = colorAttribute(ESP_ZB_ZCL_ATTR_COLOR_CONTROL_CURRENT_HUE_ID);
+    const void *saturation = colorAttribute(ESP_ZB_ZCL_ATTR_COLOR_CONTROL_CURRENT_SATURATION_ID);
+    if (mode && *(const uint8_t *)mode == ENHANCED_COLOR_MODE_HUE && enhancedHue && saturation)
+    {
+      return colorFromHueSat(*(const uint16_t *)enhancedHue, *(const uint8_t *)saturation);
+    }
+    if (hue && saturation)
+    {
+      return colorFromHueSat(*(const uint8_t *)hue << 8, *(const uint8_t *)saturation);
+    }
+  }
+  return colorFromRgb8(red, green, blue);
 }
 
 // Static callback implementations
 static void staticLightChangeCallback(bool state, uint8_t endpoint, uint8_t red, uint8_t green, uint8_t blue, uint8_t level, uint16_t temperature, esp_zb_zcl_color_control_color_mode_t color_mode)
 {
   // Serial.printf("Command received - state:%d level:%d R:%d G:%d B:%d\n", state, level, red, green, blue);
-  //  Update target values for smooth interpolation
-  if (xSemaphoreTake(colorMutex, pdMS_TO_TICKS(10)) == pdTRUE)
+  //  Update target values for smooth interpolation (picked up on the next frame),
+  //  reached when the command that caused the change said
+  WorkingColor color = commandColor(red, green, blue, temperature, color_mode);
+  LightTargets targets = {color.r, color.g, color.b, level, state,
+                          commandTransitionRemaining(commandTransition, millis())};
+  uint32_t publishStart = cpuCycleCount();
+  targetMailboxPublish(targetMailbox, targets);
+  instrumentPublish(instrumentation, cpuCycleCount() - publishStart);
+  wakeLedTask();
+}
+
+// Raw ZCL commands pass through here before the stack handles them (the
+// buffer holds the payload past the ZCL header). The Hue library does not hand
+// on transition times, so note the one a light command carries.
+static bool zclRawCommandHandler(uint8_t bufid)
+{
+  zb_zcl_parsed_hdr_t *header = ZB_BUF_GET_PARAM(bufid, zb_zcl_parsed_hdr_t);
+  uint32_t transitionMs;
+  if (!header->is_common_command && ZB_ZCL_PARSED_HDR_SHORT_DATA(header).dst_endpoint == ENDPOINT &&
+      zclCommandTransition(header->cluster_id, header->cmd_id, (const uint8_t *)zb_buf_begin(bufid),
+                           zb_buf_len(bufid), transitionMs))
   {
-    lightState.target_state = state;
-    lightState.target_r = red;
-    lightState.target_g = green;
-    lightState.target_b = blue;
-    lightState.target_level = level;
-    xSemaphoreGive(colorMutex);
+    commandTransition = {(uint32_t)millis(), transitionMs};
   }
+  return false; // Not consumed - the stack still handles the command
 }
 
 static void staticIdentifyCallback(uint16_t time)
@@ -1187,44 +831,108 @@ static void staticIdentifyCallback(uint16_t time)
   // Static identify callback - implementation could be added if needed
 }
 
+// Last light state in the store, or the defaults when there is none
+PersistedLight loadLightState()
+{
+  storeLoad();
+  const StoreEntry &entry = storeIndex.entries[STORE_KEY_LIGHT];
+  PersistedLight saved;
+  if (!entry.present || !persistedDecode(entry.payload, entry.length, saved))
+  {
+    Serial.println("No saved light state, starting with defaults");
+    return persistedDefault();
+  }
+  return saved;
+}
+
+// Report the light state to the coordinator once joined
+void syncCoordinator(const LightTargets &targets)
+{
+  pelarboj->setLightState(targets.state);
+  pelarboj->setLightLevel(targets.level);
+  WorkingColor color = {targets.r, targets.g, targets.b};
+  uint8_t r, g, b;
+  colorToRgb8(color, r, g, b);
+  pelarboj->setLightColor(r, g, b);
+  pelarboj->zbUpdateStateFromAttributes();
+}
+
 // the setup routine runs once when you press reset:
 void setup()
 {
   Serial.begin(115200);
+  bootMark(bootTimeline.setupUs, micros());
 
   // Initialize random seed for truly random effects
   bootloader_random_enable();
   random_seed = esp_random();
   bootloader_random_disable();
   randomSeed(random_seed);
+  effectState.seed = random_seed; // Every effect's random stream derives from it
 
   pinMode(BOOT_PIN, INPUT_PULLUP);
   pinMode(EXTERNAL_BUTTON_PIN, INPUT_PULLUP);
+  setupPowerManagement();
+
   // Initialize pins as LEDC channels with high resolution
   // 12-bit resolution provides 4096 levels for ultra-smooth transitions
-  ledcAttach(ledR, LED_PWM_FREQUENCY, LED_PWM_RESOLUTION); // 5 kHz PWM, 12-bit resolution
-  ledcAttach(ledG, LED_PWM_FREQUENCY, LED_PWM_RESOLUTION);
-  ledcAttach(ledB, LED_PWM_FREQUENCY, LED_PWM_RESOLUTION);
+  ledcAttachChannel(ledR, LED_PWM_FREQUENCY, LED_PWM_RESOLUTION, LED_CHANNEL_R); // LED_PWM_FREQUENCY PWM, 12-bit resolution
+  ledcAttachChannel(ledG, LED_PWM_FREQUENCY, LED_PWM_RESOLUTION, LED_CHANNEL_G);
+  ledcAttachChannel(ledB, LED_PWM_FREQUENCY, LED_PWM_RESOLUTION, LED_CHANNEL_B);
 
   pinMode(LED_BUILTIN, OUTPUT);
 
-  // Initialize mutex for thread-safe color updates
-  colorMutex = xSemaphoreCreateMutex();
-  if (colorMutex == NULL)
+  // Come back as the user left it - the LED task is not running yet
+  PersistedLight saved = loadLightState();
+  bootRestore(lightState, effectState, saved, millis());
+  targetMailboxPublish(targetMailbox, saved.targets);
+  persistEffect.store(saved.effect, std::memory_order_relaxed);
+  savedLight = saved;
+  Serial.printf("Restored light: %s R=%d G=%d B=%d L=%d, effect %s, program %u\n",
+                saved.targets.state ? "ON" : "OFF", saved.targets.r, saved.targets.g, saved.targets.b,
+                saved.targets.level, effectName(saved.effect), (unsigned)saved.program);
+  effectRegistryLog();
+  Serial.printf("Effect seed: 0x%08x\n", (unsigned)effectState.seed);
+
+  // Start the log task first so the others can log from their first frame
+  if (xTaskCreate(logTask, "Log_Drain", 3072, NULL, 1, &logTaskHandle) != pdPASS)
+  {
+    Serial.println("Failed to create log task!");
+    ESP.restart();
+  }
+  logConsumerWake = wakeLogTask;
+
+  // Saving the state only makes sense with the partition mounted
+  if (storeMounted && xTaskCreate(persistTask, "Persist", 4096, NULL, 1, &persistTaskHandle) != pdPASS)
   {
-    Serial.println("Failed to create color mutex!");
+    Serial.println("Failed to create persist task!");
     ESP.restart();
   }
 
-  uint8_t color = 0;        // a value from 0 to 255 representing the hue
-  uint32_t R, G, B;         // the Red Green and Blue color components
-  uint8_t brightness = 255; // 255 is maximum brightness, but can be changed.  Might need 256 for common anode to fully turn off.
+  // Start button handling task (higher priority to avoid inheritance issues)
+  if (xTaskCreate(buttonTask, "Button_Handler", 2048, NULL, 3, &buttonTaskHandle) != pdPASS)
+  {
+    Serial.println("Failed to create button handling task!");
+    ESP.restart();
+  }
+
+  // Start LED update task - it shows the restored state on its first frame
+  if (xTaskCreate(ledUpdateTask, "LED_Update", 4096, NULL, 2, &ledTaskHandle) != pdPASS)
+  {
+    Serial.println("Failed to create LED update task!");
+    ESP.restart();
+  }
+
+  // Slow flash reads only once the light is on: PROGRAM runs the built-in
+  // program and KEYFRAMES shows the base until these are ready
+  loadEffectPrograms();
+  mapKeyframeTrack();
 
   uint8_t phillips_hue_key[] = {0x81, 0x45, 0x86, 0x86, 0x5D, 0xC6, 0xC8, 0xB1, 0xC8, 0xCB, 0xC4, 0x2E, 0x5D, 0x65, 0xD3, 0xB9};
   Zigbee.setEnableJoiningToDistributed(true);
   Zigbee.setStandardDistributedKey(phillips_hue_key);
 
-  pelarboj = new ZigbeeHueLight(ENDPOINT, ESP_ZB_HUE_LIGHT_TYPE_COLOR);
+  pelarboj = new PelarbojLight(ENDPOINT);
 
   // Configure the light
   pelarboj->onLightChange(staticLightChangeCallback);
@@ -1244,79 +952,91 @@ void setup()
     ESP.restart();
   }
 
-  Serial.println("Connecting Zigbee to network");
-
-  while (!Zigbee.connected())
-  {
-    color++;
-    hueToRGB(color, brightness, R, G, B); // call function to convert hue to RGB
-
-    // write the RGB values to the pins (scale to 12-bit resolution)
-    ledcWrite(ledR, R * (LED_PWM_MAX_VALUE / 255)); // Scale to 12-bit range
-    ledcWrite(ledG, G * (LED_PWM_MAX_VALUE / 255));
-    ledcWrite(ledB, B * (LED_PWM_MAX_VALUE / 255));
-    digitalWrite(LED_BUILTIN, HIGH);
-    delay(100);
-    digitalWrite(LED_BUILTIN, LOW);
-    delay(100);
-  }
-
-  effectState.type = EFFECT_AUTO_CYCLE;
-  effectState.startTime = millis();
-  // Generate random color for startup
-  uint8_t startR = random(30);
-  uint8_t startG = random(30);
-  uint8_t startB = random(30);
-  uint8_t startLevel = 255;
-  bool startState = true;
-
-  // Set coordinator state
-  pelarboj->setLightState(startState);
-  pelarboj->setLightLevel(startLevel);
-  pelarboj->setLightColor(startR, startG, startB);
-  pelarboj->zbUpdateStateFromAttributes();
-
-  // Set internal state to match to avoid race conditions
-  if (xSemaphoreTake(colorMutex, pdMS_TO_TICKS(100)) == pdTRUE)
-  {
-    lightState.target_state = startState;
-    lightState.target_r = startR;
-    lightState.target_g = startG;
-    lightState.target_b = startB;
-    lightState.target_level = startLevel;
-
-    // Also set base values directly for immediate effect
-    lightState.base_state = startState;
-    lightState.base_r = startR;
-    lightState.base_g = startG;
-    lightState.base_b = startB;
-    lightState.base_level = startLevel;
-
-    xSemaphoreGive(colorMutex);
-  }
-
-  // Start button handling task (higher priority to avoid inheritance issues)
-  if (xTaskCreate(buttonTask, "Button_Handler", 2048, NULL, 3, NULL) != pdPASS)
-  {
-    Serial.println("Failed to create button handling task!");
-    ESP.restart();
-  }
+  // See the light commands first, for their transition times
+  esp_zb_lock_acquire(portMAX_DELAY);
+  esp_zb_raw_command_handler_register(zclRawCommandHandler);
+  esp_zb_lock_release();
 
-  // Start LED update task
-  if (xTaskCreate(ledUpdateTask, "LED_Update", 4096, NULL, 2, NULL) != pdPASS)
-  {
-    Serial.println("Failed to create LED update task!");
-    ESP.restart();
-  }
+  // Joining continues in the background; loop() reports the state once joined
+  Serial.println("Connecting Zigbee to network");
 }
 
 // void loop runs over and over again
 void loop()
 {
   // Button handling is now done in async task
+#ifdef PELARBOJ_LIGHT_SLEEP
+  // No heartbeat - every blink would end a light sleep. Until the join, wake
+  // often enough to time it and sync the coordinator without delay.
+  delay(bootTimeline.joinedUs == 0 ? JOIN_POLL_MS : RESIDENCY_REPORT_MS);
+#else
   // Just keep the built-in LED heartbeat
   digitalWrite(LED_BUILTIN, HIGH);
   delay(500);
   digitalWrite(LED_BUILTIN, LOW);
   delay(500);
+#endif
+
+  // Time to light and to join, and the coordinator learns the current state
+  if (bootTimeline.joinedUs == 0 && Zigbee.connected())
+  {
+    bootMark(bootTimeline.joinedUs, micros());
+    bootTimelineLog(bootTimeline);
+    LightTargets targets;
+    uint32_t sequence = 0;
+    while (!targetMailboxRead(targetMailbox, sequence, targets))
+    {
+      // A writer got in between, read again
+    }
+    syncCoordinator(targets);
+  }
+
+  // Power residency once per report window
+  static uint32_t lastReport = 0;
+  if (millis() - lastReport >= RESIDENCY_REPORT_MS)
+  {
+    lastReport = millis();
+    residencyLog(residencyTakeWindow(residency, micros()));
+  }
+
+  // Instrumentation: on request over serial, and in the Zigbee attribute
+  bool dump = false;
+  while (Serial.available() > 0)
+  {
+    int command = Serial.read();
+    dump = dump || command == DIAGNOSTICS_DUMP_COMMAND;
+    if (command == PROGRAM_NEXT_COMMAND)
+    {
+      vmSelectNext();
+      wakeLedTask();
+      wakePersistTask();
+    }
+  }
+  static uint32_t lastDiagnostics = 0;
+  bool refresh = millis() - lastDiagnostics >= DIAGNOSTICS_UPDATE_MS;
+  if (dump || refresh)
+  {
+    InstrumentationStats stats = instrumentationSnapshot(instrumentation);
+    DiagnosticsSummary summary = diagnosticsSummarize(stats, renderCpuMhz,
+                                                      uxTaskGetStackHighWaterMark(buttonTaskHandle),
+                                                      uxTaskGetStackHighWaterMark(ledTaskHandle));
+    if (dump)
+    {
+      instrumentationLog(stats, summary);
+      portENTER_CRITICAL(&storeStatsLock);
+      StoreStats store = storeStats;
+      portEXIT_CRITICAL(&storeStatsLock);
+      storeStatsLog(store, millis(), storeMounted ? LittleFS.totalBytes() : 0);
+    }
+    if (refresh)
+    {
+      lastDiagnostics = millis();
+      diagnosticsEncode(summary, diagnosticsAttribute + 1);
+      esp_zb_lock_acquire(portMAX_DELAY);
+      esp_zb_zcl_set_manufacturer_attribute_val(ENDPOINT, ESP_ZB_ZCL_CLUSTER_ID_BASIC, ESP_ZB_ZCL_CLUSTER_SERVER_ROLE,
+                                                DIAGNOSTICS_MANUFACTURER_CODE, DIAGNOSTICS_ATTR_ID,
+                                                diagnosticsAttribute, false);
+      esp_zb_lock_release();
+    }
+  }
 }
\ No newline at end of file
@@ -0,0 +1,305 @@
+// Per-effect micro-benchmark for applyEffects() on the host.
+// Run with: pio test -e native -f test_bench_effects -v
+//
+// Every EffectType is driven for BENCH_FRAMES frames on a virtual 50 FPS clock
+// and the average/worst frame time and heap allocations are reported, for both
+// the float and the Q16.16 engine. AUTO_CYCLE's crossfades, which render two
+// effects per frame, and the output stage (computeOutput, with and without
+// temporal dithering) are timed separately. Effects that log, such as scene
+// changes, pay for queuing the record into the deferred log ring (logWrite);
+// the ring is emptied between frames, as the log task does, and formatting
+// is not timed. The numbers are a regression baseline for the render path,
+// not an absolute device figure: the host has an FPU, the C6 does not.
+
+#include <Log.h>
+#include <Render.h>
+#include <unity.h>
+
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef BENCH_FRAMES
+#define BENCH_FRAMES 2000000UL
+#endif
+
+const unsigned long BENCH_FRAME_MS = 20; // Matches LED_UPDATE_RATE_MS on the device
+
+// Count every heap allocation made while an effect is running
+static volatile size_t allocationCount = 0;
+
+void *operator new(size_t size)
+{
+  allocationCount++;
+  void *ptr = malloc(size);
+  if (ptr == NULL)
+  {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+  free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+  free(ptr);
+}
+
+struct BenchResult
+{
+  double nsPerFrame;
+  double worstFrameNs;
+  size_t allocations;
+  float checksum; // Keeps the optimizer from discarding the effect output
+};
+
+typedef std::chrono::steady_clock Clock;
+
+// Cost of the two clock reads around each frame, subtracted from the results
+static Clock::duration measureTimerOverhead()
+{
+  const int samples = 100000;
+  Clock::duration total = Clock::duration::zero();
+  for (int i = 0; i < samples; i++)
+  {
+    Clock::time_point start = Clock::now();
+    total += Clock::now() - start;
+  }
+  return total / samples;
+}
+
+static Clock::duration timerOverhead;
+
+// The log task's side of the ring, outside the timed frame: every record an
+// effect queues is a real push, never a drop on a full ring
+static void drainLog()
+{
+  LogRecord record;
+  while (logPop(logRing, record))
+  {
+  }
+}
+
+template <typename Scalar>
+static BenchResult runEffect(EffectType type, unsigned long frames)
+{
+  EffectStateT<Scalar> state = EffectStateT<Scalar>();
+  state.type = type;
+  hostSetMillis(1000);
+  state.slot.seed = 12345;
+
+  // A saturated, non-grey base so every effect takes its normal path
+  FrameContextT<Scalar> context = {(uint32_t)millis(), 0, Scalar(200), Scalar(120), Scalar(40), Scalar(180),
+                                   {200 * 257, 120 * 257, 40 * 257}};
+  Scalar finalR, finalG, finalB, finalLevel;
+
+  BenchResult result = {0.0, 0.0, 0, 0.0f};
+  size_t allocationsBefore = allocationCount;
+  Clock::duration total = Clock::duration::zero();
+  Clock::duration worst = Clock::duration::zero();
+
+  for (unsigned long frame = 0; frame < frames; frame++)
+  {
+    hostAdvanceMillis(BENCH_FRAME_MS);
+    context.now = millis();
+    context.dt = BENCH_FRAME_MS;
+
+    Clock::time_point start = Clock::now();
+    applyEffects(state, context, finalR, finalG, finalB, finalLevel);
+    Clock::duration spent = Clock::now() - start - timerOverhead;
+    drainLog();
+
+    total += spent;
+    if (spent > worst)
+    {
+      worst = spent;
+    }
+    result.checksum += scalarToFloat(finalR + finalG + finalB + finalLevel);
+  }
+
+  result.allocations = allocationCount - allocationsBefore;
+  result.nsPerFrame = std::chrono::duration<double, std::nano>(total).count() / frames;
+  result.worstFrameNs = std::chrono::duration<double, std::nano>(worst).count();
+  return result;
+}
+
+void test_bench_all_effects()
+{
+  timerOverhead = measureTimerOverhead();
+
+  printf("\n%-20s %12s %12s %14s %14s %12s\n", "effect", "float ns", "fix16 ns",
+         "float worst", "fix16 worst", "allocations");
+  for (int type = 0; type < MAX_EFFECT_NUMBER; type++)
+  {
+    BenchResult floatResult = runEffect<float>((EffectType)type, BENCH_FRAMES);
+    BenchResult fixedResult = runEffect<Fix16>((EffectType)type, BENCH_FRAMES);
+    printf("%-20s %12.1f %12.1f %14.1f %14.1f %12zu\n", effectName((EffectType)type),
+           floatResult.nsPerFrame, fixedResult.nsPerFrame, floatResult.worstFrameNs,
+           fixedResult.worstFrameNs, floatResult.allocations + fixedResult.allocations);
+
+    // The render path runs at 50 FPS forever - it must never touch the heap
+    TEST_ASSERT_EQUAL_UINT32(0, floatResult.allocations + fixedResult.allocations);
+    TEST_ASSERT_FALSE(isnan(floatResult.checksum));
+  }
+  printf("(%lu frames per effect, %lu ms virtual frame time)\n", BENCH_FRAMES, BENCH_FRAME_MS);
+}
+
+// AUTO_CYCLE crossfades only: every timed frame evaluates both the outgoing
+// and the incoming sub-effect. Between transitions the virtual clock jumps
+// straight to the next one.
+template <typename Scalar>
+static BenchResult runAutoCycleTransitions(unsigned long frames)
+{
+  EffectStateT<Scalar> state = EffectStateT<Scalar>();
+  state.type = EFFECT_AUTO_CYCLE;
+  hostSetMillis(1000);
+  state.slot.seed = 12345;
+
+  FrameContextT<Scalar> context = {(uint32_t)millis(), 0, Scalar(200), Scalar(120), Scalar(40), Scalar(180),
+                                   {200 * 257, 120 * 257, 40 * 257}};
+  Scalar finalR, finalG, finalB, finalLevel;
+  applyEffects(state, context, finalR, finalG, finalB, finalLevel);
+
+  BenchResult result = {0.0, 0.0, 0, 0.0f};
+  size_t allocationsBefore = allocationCount;
+  Clock::duration total = Clock::duration::zero();
+  Clock::duration worst = Clock::duration::zero();
+
+  for (unsigned long frame = 0; frame < frames; frame++)
+  {
+    if (!state.composite.autoCycle.inTransition)
+    {
+      // Skip to the frame that starts the next transition
+      const AutoCycleStateT<Scalar> &cycle = state.composite.autoCycle;
+      hostSetMillis(state.startTime + cycle.startTime + cycle.duration - AUTO_CYCLE_TRANSITION_TIME_MS);
+    }
+    else
+    {
+      hostAdvanceMillis(BENCH_FRAME_MS);
+    }
+    context.now = millis();
+    context.dt = BENCH_FRAME_MS;
+
+    Clock::time_point start = Clock::now();
+    applyEffects(state, context, finalR, finalG, finalB, finalLevel);
+    Clock::duration spent = Clock::now() - start - timerOverhead;
+    drainLog();
+
+    total += spent;
+    if (spent > worst)
+    {
+      worst = spent;
+    }
+    result.checksum += scalarToFloat(finalR + finalG + finalB + finalLevel);
+  }
+
+  result.allocations = allocationCount - allocationsBefore;
+  result.nsPerFrame = std::chrono::duration<double, std::nano>(total).count() / frames;
+  result.worstFrameNs = std::chrono::duration<double, std::nano>(worst).count();
+  return result;
+}
+
+void test_bench_auto_cycle_transitions()
+{
+  BenchResult floatResult = runAutoCycleTransitions<float>(BENCH_FRAMES);
+  BenchResult fixedResult = runAutoCycleTransitions<Fix16>(BENCH_FRAMES);
+  printf("%-20s %12.1f %12.1f %14.1f %14.1f %12zu\n", "AUTO_CYCLE_XFADE", floatResult.nsPerFrame,
+         fixedResult.nsPerFrame, floatResult.worstFrameNs, fixedResult.worstFrameNs,
+         floatResult.allocations + fixedResult.allocations);
+
+  TEST_ASSERT_EQUAL_UINT32(0, floatResult.allocations + fixedResult.allocations);
+  TEST_ASSERT_FALSE(isnan(floatResult.checksum));
+}
+
+template <typename Scalar>
+static BenchResult runOutputStage(unsigned long frames, bool dithered)
+{
+  LightStateT<Scalar> light = LightStateT<Scalar>();
+  light.base_state = true;
+  DitherState dither = {{0, 0, 0}};
+
+  BenchResult result = {0.0, 0.0, 0, 0.0f};
+  size_t allocationsBefore = allocationCount;
+  Clock::duration total = Clock::duration::zero();
+  Clock::duration worst = Clock::duration::zero();
+
+  for (unsigned long frame = 0; frame < frames; frame++)
+  {
+    // Sweep the color and level, dim channels included
+    light.final_r = Scalar((int)(frame % 256));
+    light.final_g = Scalar((int)(frame / 7 % 256));
+    light.final_b = Scalar((int)(frame / 3 % 64));
+    light.final_level = Scalar((int)(frame / 256 % 256));
+
+    Clock::time_point start = Clock::now();
+    PwmOutput pwm = dithered ? computeOutputDithered(light, dither) : computeOutput(light);
+    Clock::duration spent = Clock::now() - start - timerOverhead;
+
+    total += spent;
+    if (spent > worst)
+    {
+      worst = spent;
+    }
+    result.checksum += pwm.r + pwm.g + pwm.b;
+  }
+
+  result.allocations = allocationCount - allocationsBefore;
+  result.nsPerFrame = std::chrono::duration<double, std::nano>(total).count() / frames;
+  result.worstFrameNs = std::chrono::duration<double, std::nano>(worst).count();
+  return result;
+}
+
+static void benchOutputStage(const char *name, bool dithered)
+{
+  BenchResult floatResult = runOutputStage<float>(BENCH_FRAMES, dithered);
+  BenchResult fixedResult = runOutputStage<Fix16>(BENCH_FRAMES, dithered);
+  printf("%-20s %12.1f %12.1f %14.1f %14.1f %12zu\n", name, floatResult.nsPerFrame, fixedResult.nsPerFrame,
+         floatResult.worstFrameNs, fixedResult.worstFrameNs, floatResult.allocations + fixedResult.allocations);
+
+  TEST_ASSERT_EQUAL_UINT32(0, floatResult.allocations + fixedResult.allocations);
+}
+
+void test_bench_output_stage()
+{
+  benchOutputStage("OUTPUT_STAGE", false);
+  // The dithering stage adds a fixed few integer operations per channel; the
+  // difference to OUTPUT_STAGE is its per-frame cost
+  benchOutputStage("OUTPUT_DITHERED", true);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_bench_all_effects);
+  RUN_TEST(test_bench_auto_cycle_transitions);
+  RUN_TEST(test_bench_output_stage);
+  return UNITY_END();
+}
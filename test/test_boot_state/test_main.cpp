@@ -0,0 +1,179 @@
+// Instant-on boot from the persisted light state. Run with:
+// pio test -e native -f test_boot_state
+
+#include <BootState.h>
+#include <StateStore.h>
+#include <unity.h>
+
+const uint32_t BOOT_MS = 50;
+
+void test_record_round_trip()
+{
+  PersistedLight saved = {{51400, 23130, 2570, 180, true}, EFFECT_FIREPLACE, 2};
+  uint8_t buffer[PERSISTED_ENCODED_SIZE];
+  persistedEncode(saved, buffer);
+
+  PersistedLight loaded;
+  TEST_ASSERT_TRUE(persistedDecode(buffer, sizeof(buffer), loaded));
+  TEST_ASSERT_TRUE(persistedEqual(saved, loaded));
+
+  saved.targets.state = false;
+  TEST_ASSERT_FALSE(persistedEqual(saved, loaded));
+  saved = loaded;
+  saved.program = 0;
+  TEST_ASSERT_FALSE(persistedEqual(saved, loaded));
+}
+
+void test_bad_records_are_rejected()
+{
+  PersistedLight saved = {{1, 2, 3, 4, false}, EFFECT_BREATHING, 1};
+  uint8_t buffer[PERSISTED_ENCODED_SIZE];
+  PersistedLight loaded;
+
+  persistedEncode(saved, buffer);
+  TEST_ASSERT_FALSE(persistedDecode(buffer, 0, loaded)); // Nothing stored yet
+  TEST_ASSERT_FALSE(persistedDecode(buffer, PERSISTED_ENCODED_SIZE - 1, loaded));
+
+  // Any flipped bit fails the CRC
+  for (size_t byte = 0; byte < PERSISTED_ENCODED_SIZE; byte++)
+  {
+    for (int bit = 0; bit < 8; bit++)
+    {
+      persistedEncode(saved, buffer);
+      buffer[byte] ^= 1 << bit;
+      TEST_ASSERT_FALSE(persistedDecode(buffer, sizeof(buffer), loaded));
+    }
+  }
+
+  // A program the library can never hold
+  saved.program = VM_MAX_PROGRAMS + 1;
+  persistedEncode(saved, buffer);
+  TEST_ASSERT_FALSE(persistedDecode(buffer, sizeof(buffer), loaded));
+
+  // Default: on, AUTO_CYCLE, as the lamp always started
+  PersistedLight defaults = persistedDefault();
+  TEST_ASSERT_TRUE(defaults.targets.state);
+  TEST_ASSERT_EQUAL_INT(EFFECT_AUTO_CYCLE, defaults.effect);
+}
+
+// Records from before the 16-bit working color still restore, converted
+void test_version_1_record_migrates()
+{
+  uint8_t buffer[PERSISTED_RGB8_SIZE] = {PERSISTED_MAGIC, PERSISTED_VERSION_RGB8, 255, 128, 0, 180, 1, EFFECT_FIREPLACE};
+  buffer[8] = crc8(buffer, PERSISTED_RGB8_SIZE - 1);
+
+  PersistedLight loaded;
+  TEST_ASSERT_TRUE(persistedDecode(buffer, sizeof(buffer), loaded));
+  TEST_ASSERT_EQUAL_UINT16(65535, loaded.targets.r);
+  TEST_ASSERT_UINT32_WITHIN(100, 14146, loaded.targets.g); // sRGB 128 is 21.6% linear
+  TEST_ASSERT_EQUAL_UINT16(0, loaded.targets.b);
+  TEST_ASSERT_EQUAL_UINT8(180, loaded.targets.level);
+  TEST_ASSERT_TRUE(loaded.targets.state);
+  TEST_ASSERT_EQUAL_INT(EFFECT_FIREPLACE, loaded.effect);
+
+  buffer[8] ^= 1;
+  TEST_ASSERT_FALSE(persistedDecode(buffer, sizeof(buffer), loaded));
+}
+
+// Records from before the program was saved restore with the built-in one
+void test_version_2_record_migrates()
+{
+  PersistedLight saved = {{51400, 23130, 2570, 180, true}, EFFECT_PROGRAM, 3};
+  uint8_t buffer[PERSISTED_ENCODED_SIZE];
+  persistedEncode(saved, buffer);
+  buffer[1] = PERSISTED_VERSION_NO_PROGRAM;
+  buffer[11] = crc8(buffer, PERSISTED_NO_PROGRAM_SIZE - 1);
+
+  PersistedLight loaded;
+  TEST_ASSERT_TRUE(persistedDecode(buffer, PERSISTED_NO_PROGRAM_SIZE, loaded));
+  TEST_ASSERT_EQUAL_UINT16(51400, loaded.targets.r);
+  TEST_ASSERT_EQUAL_INT(EFFECT_PROGRAM, loaded.effect);
+  TEST_ASSERT_EQUAL_UINT8(0, loaded.program);
+}
+
+// The first frame after a restore already shows the saved light, with no
+// transition to wait for
+void test_restore_shows_state_on_first_frame()
+{
+  PersistedLight saved = {{240 * 257, 120 * 257, 30 * 257, 200, true}, EFFECT_NONE, 0};
+  LightState light = LightState();
+  EffectState effect = EffectState();
+  bootRestore(light, effect, saved, BOOT_MS);
+
+  FrameClock clock = {BOOT_MS, 0};
+  renderFrame(light, effect, clock);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_INTERVAL_IDLE, renderFrameInterval(light, effect, clock));
+
+  LightState settled = LightState();
+  settled.final_r = RenderScalar(240);
+  settled.final_g = RenderScalar(120);
+  settled.final_b = RenderScalar(30);
+  settled.final_level = RenderScalar(200);
+  settled.base_state = true;
+  settled.target_state = true;
+  PwmOutput expected = computeOutput(settled);
+  PwmOutput first = computeOutput(light);
+  TEST_ASSERT_EQUAL_UINT16(expected.r, first.r);
+  TEST_ASSERT_EQUAL_UINT16(expected.g, first.g);
+  TEST_ASSERT_EQUAL_UINT16(expected.b, first.b);
+}
+
+void test_restore_starts_saved_effect()
+{
+  PersistedLight saved = {{65535, 65535, 65535, 255, true}, EFFECT_PROGRAM, 2};
+  LightState light = LightState();
+  EffectState effect = EffectState();
+  bootRestore(light, effect, saved, BOOT_MS);
+  TEST_ASSERT_EQUAL_INT(EFFECT_PROGRAM, effect.type);
+  TEST_ASSERT_EQUAL_UINT32(BOOT_MS, effect.startTime);
+  TEST_ASSERT_EQUAL_UINT8(2, vmSelected.load());
+  vmSelected.store(0);
+}
+
+void test_blink_mode_keeps_selected_effect()
+{
+  LightState light = LightState();
+  EffectState effect = EffectState();
+  effect.type = EFFECT_COLOR_WANDER;
+  TEST_ASSERT_EQUAL_INT(EFFECT_COLOR_WANDER, selectedEffect(light, effect));
+
+  // Next effect: the number blinks with the effect paused
+  ControlEvent next = {CONTROL_NEXT_EFFECT};
+  applyControlEvent(light, effect, next, BOOT_MS);
+  TEST_ASSERT_EQUAL_INT(EFFECT_NONE, effect.type);
+  TEST_ASSERT_EQUAL_INT(EFFECT_COLOR_WANDER + 1, selectedEffect(light, effect));
+}
+
+void test_boot_phases_recorded_once()
+{
+  BootTimeline timeline = {0, 0, 0};
+  bootMark(timeline.firstPwmUs, 180000);
+  bootMark(timeline.firstPwmUs, 200000);
+  TEST_ASSERT_EQUAL_UINT32(180000, timeline.firstPwmUs);
+  TEST_ASSERT_EQUAL_UINT32(0, timeline.joinedUs);
+
+  bootMark(timeline.setupUs, 0); // At the very start still counts as reached
+  TEST_ASSERT_TRUE(timeline.setupUs != 0);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_record_round_trip);
+  RUN_TEST(test_bad_records_are_rejected);
+  RUN_TEST(test_version_1_record_migrates);
+  RUN_TEST(test_version_2_record_migrates);
+  RUN_TEST(test_restore_shows_state_on_first_frame);
+  RUN_TEST(test_restore_starts_saved_effect);
+  RUN_TEST(test_blink_mode_keeps_selected_effect);
+  RUN_TEST(test_boot_phases_recorded_once);
+  return UNITY_END();
+}
@@ -0,0 +1,177 @@
+// Working color conversions from the ZCL color attributes. Run with:
+// pio test -e native -f test_color_space
+
+#include <ColorSpace.h>
+#include <unity.h>
+
+// ZCL CurrentX/CurrentY encoding of a CIE chromaticity
+static uint16_t zclCoordinate(float value)
+{
+  return (uint16_t)(value * 65536.0f + 0.5f);
+}
+
+static WorkingColor fromXy(float x, float y)
+{
+  return colorFromXy(zclCoordinate(x), zclCoordinate(y));
+}
+
+void test_primaries_and_white_from_xy()
+{
+  // The sRGB primaries land on one channel each
+  WorkingColor red = fromXy(0.64f, 0.33f);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, red.r);
+  TEST_ASSERT_UINT32_WITHIN(200, 0, red.g);
+  TEST_ASSERT_UINT32_WITHIN(200, 0, red.b);
+
+  WorkingColor green = fromXy(0.30f, 0.60f);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, green.g);
+  TEST_ASSERT_UINT32_WITHIN(200, 0, green.r);
+  TEST_ASSERT_UINT32_WITHIN(200, 0, green.b);
+
+  WorkingColor blue = fromXy(0.15f, 0.06f);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, blue.b);
+  TEST_ASSERT_UINT32_WITHIN(200, 0, blue.r);
+  TEST_ASSERT_UINT32_WITHIN(200, 0, blue.g);
+
+  // D65 is the white point: all channels equal
+  WorkingColor white = fromXy(0.3127f, 0.3290f);
+  TEST_ASSERT_UINT32_WITHIN(300, WORKING_COLOR_MAX, white.r);
+  TEST_ASSERT_UINT32_WITHIN(300, WORKING_COLOR_MAX, white.g);
+  TEST_ASSERT_UINT32_WITHIN(300, WORKING_COLOR_MAX, white.b);
+
+  // Out of gamut is clipped, and a degenerate y does not divide by zero
+  WorkingColor spectral = fromXy(0.08f, 0.83f);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, spectral.g);
+  TEST_ASSERT_EQUAL_UINT16(0, spectral.r);
+  WorkingColor degenerate = colorFromXy(20000, 0);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, degenerate.r);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, degenerate.b);
+}
+
+void test_hue_and_saturation()
+{
+  WorkingColor red = colorFromHueSat(0, 254);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, red.r);
+  TEST_ASSERT_EQUAL_UINT16(0, red.g);
+  TEST_ASSERT_EQUAL_UINT16(0, red.b);
+
+  WorkingColor green = colorFromHueSat(65536 / 3, 254);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, green.g);
+  TEST_ASSERT_UINT32_WITHIN(2, 0, green.r);
+  TEST_ASSERT_UINT32_WITHIN(2, 0, green.b);
+
+  WorkingColor unsaturated = colorFromHueSat(12345, 0);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, unsaturated.r);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, unsaturated.g);
+  TEST_ASSERT_EQUAL_UINT16(WORKING_COLOR_MAX, unsaturated.b);
+
+  // Half saturation is half way in gamma space, a fifth in linear light
+  WorkingColor pastel = colorFromHueSat(0, 127);
+  TEST_ASSERT_UINT32_WITHIN(300, 14146, pastel.g);
+  TEST_ASSERT_EQUAL_UINT16(pastel.g, pastel.b);
+}
+
+// Neighbouring enhanced hues stay distinct where 8-bit RGB merges them
+void test_precision_beyond_8_bits()
+{
+  int distinct = 0;
+  WorkingColor previous = colorFromHueSat(1000, 254);
+  for (uint16_t hue = 1001; hue < 1256; hue++)
+  {
+    WorkingColor color = colorFromHueSat(hue, 254);
+    TEST_ASSERT_TRUE(color.g >= previous.g); // Red to yellow: green only rises
+    distinct += color.g != previous.g;
+    previous = color;
+  }
+  TEST_ASSERT_TRUE(distinct > 200);
+
+  uint8_t r, b;
+  uint8_t firstG, lastG;
+  colorToRgb8(colorFromHueSat(1000, 254), r, firstG, b);
+  colorToRgb8(colorFromHueSat(1255, 254), r, lastG, b);
+  TEST_ASSERT_TRUE(lastG - firstG < 10); // The same range is a handful of 8-bit steps
+}
+
+// Color temperature follows the Planckian locus through the whole range
+void test_color_temperature()
+{
+  struct
+  {
+    uint16_t mireds;
+    float x, y; // On the locus
+  } points[] = {
+      {154, 0.3135f, 0.3237f}, // 6500 K
+      {250, 0.3805f, 0.3768f}, // 4000 K
+      {350, 0.4476f, 0.4074f}, // 2856 K, illuminant A
+      {500, 0.5267f, 0.4133f}, // 2000 K
+  };
+  for (size_t i = 0; i < sizeof(points) / sizeof(points[0]); i++)
+  {
+    WorkingColor expected = fromXy(points[i].x, points[i].y);
+    WorkingColor color = colorFromMireds(points[i].mireds);
+    TEST_ASSERT_UINT32_WITHIN(700, expected.r, color.r);
+    TEST_ASSERT_UINT32_WITHIN(700, expected.g, color.g);
+    TEST_ASSERT_UINT32_WITHIN(700, expected.b, color.b);
+  }
+
+  // Warmer with every mired, red in front below 6500 K
+  WorkingColor previous = colorFromMireds(COLOR_TEMP_MIN_MIREDS);
+  for (uint16_t mireds = COLOR_TEMP_MIN_MIREDS + 1; mireds <= COLOR_TEMP_MAX_MIREDS; mireds++)
+  {
+    WorkingColor color = colorFromMireds(mireds);
+    TEST_ASSERT_TRUE(color.b < previous.b);
+    TEST_ASSERT_TRUE(color.g <= previous.g);
+    TEST_ASSERT_TRUE(mireds <= 161 || color.r == WORKING_COLOR_MAX);
+    previous = color;
+  }
+
+  // Outside the range clamps to its ends
+  WorkingColor coolest = colorFromMireds(COLOR_TEMP_MIN_MIREDS);
+  WorkingColor tooCool = colorFromMireds(0);
+  TEST_ASSERT_EQUAL_UINT16(coolest.b, tooCool.b);
+  WorkingColor warmest = colorFromMireds(COLOR_TEMP_MAX_MIREDS);
+  WorkingColor tooWarm = colorFromMireds(0xFEFF);
+  TEST_ASSERT_EQUAL_UINT16(warmest.b, tooWarm.b);
+}
+
+void test_rgb8_round_trip()
+{
+  for (int value = 0; value < 256; value += 5)
+  {
+    uint8_t r, g, b;
+    colorToRgb8(colorFromRgb8(255, value, 255 - value), r, g, b);
+    TEST_ASSERT_EQUAL_UINT8(255, r);
+    TEST_ASSERT_UINT32_WITHIN(1, value, g);
+    TEST_ASSERT_UINT32_WITHIN(1, 255 - value, b);
+  }
+
+  // Dim colors come back at full strength (dimness is the level's job)
+  uint8_t r, g, b;
+  colorToRgb8(colorFromRgb8(20, 10, 0), r, g, b);
+  TEST_ASSERT_EQUAL_UINT8(255, r);
+  TEST_ASSERT_EQUAL_UINT8(0, b);
+
+  WorkingColor black = colorFromRgb8(0, 0, 0);
+  TEST_ASSERT_EQUAL_UINT16(0, black.r);
+  TEST_ASSERT_EQUAL_UINT16(0, black.g);
+  TEST_ASSERT_EQUAL_UINT16(0, black.b);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_primaries_and_white_from_xy);
+  RUN_TEST(test_hue_and_saturation);
+  RUN_TEST(test_precision_beyond_8_bits);
+  RUN_TEST(test_color_temperature);
+  RUN_TEST(test_rgb8_round_trip);
+  return UNITY_END();
+}
@@ -0,0 +1,145 @@
+// Layered effect compositor. Run with: pio test -e native -f test_compositor
+
+#include <Compositor.h>
+#include <unity.h>
+
+const uint32_t COMPOSITOR_START_MS = 1000;
+
+static FrameContextT<RenderScalar> baseFrame(uint32_t now)
+{
+  FrameContextT<RenderScalar> frame = {now, 20, RenderScalar(200), RenderScalar(120), RenderScalar(40),
+                                       RenderScalar(180), {200 * 257, 120 * 257, 40 * 257}};
+  return frame;
+}
+
+// One effect on its own, the reference for a layer
+static EffectOutputT<RenderScalar> renderAlone(EffectState &state, uint32_t now)
+{
+  EffectOutputT<RenderScalar> out;
+  applyEffects(state, baseFrame(now), out.r, out.g, out.b, out.level);
+  return out;
+}
+
+void test_default_stack_breathes_the_fire()
+{
+  EffectState layered = EffectState();
+  effectStart(layered, EFFECT_LAYERED, COMPOSITOR_START_MS);
+  EffectState fire = EffectState();
+  effectStart(fire, EFFECT_FIREPLACE, COMPOSITOR_START_MS);
+  EffectState breath = EffectState();
+  effectStart(breath, EFFECT_BREATHING, COMPOSITOR_START_MS);
+
+  for (uint32_t t = 0; t < 20000; t += 20)
+  {
+    uint32_t now = COMPOSITOR_START_MS + t;
+    EffectOutputT<RenderScalar> stack = renderAlone(layered, now);
+    EffectOutputT<RenderScalar> flame = renderAlone(fire, now);
+    EffectOutputT<RenderScalar> breathing = renderAlone(breath, now);
+
+    // Fire colors, its level scaled by 60% of the breathing swing
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, scalarToFloat(flame.r), scalarToFloat(stack.r));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, scalarToFloat(flame.b), scalarToFloat(stack.b));
+    float ratio = scalarToFloat(breathing.level) / 180.0f;
+    float expected = scalarToFloat(flame.level) * (1.0f + (ratio - 1.0f) * 0.6f);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, expected, scalarToFloat(stack.level));
+  }
+  TEST_ASSERT_EQUAL_UINT8(2, layered.composite.layers.count);
+}
+
+void test_blend_modes()
+{
+  CompositorT<RenderScalar> compositor = CompositorT<RenderScalar>();
+  EffectOutputT<RenderScalar> out;
+  LayerSpec base = {EFFECT_NONE, BLEND_MULTIPLY, 1.0f};
+
+  // NONE renders the base: multiplying by it squares each channel / 255
+  TEST_ASSERT_TRUE(compositorPush(compositor, base));
+  compositorRender(compositor, baseFrame(COMPOSITOR_START_MS), 0, out);
+  TEST_ASSERT_FLOAT_WITHIN(0.2f, 200.0f * 200.0f / 255.0f, scalarToFloat(out.r));
+  TEST_ASSERT_FLOAT_WITHIN(0.2f, 40.0f * 40.0f / 255.0f, scalarToFloat(out.b));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 180.0f, scalarToFloat(out.level)); // Color only
+
+  // Replacing with the base at half opacity goes halfway back
+  LayerSpec replace = {EFFECT_NONE, BLEND_REPLACE, 0.5f};
+  TEST_ASSERT_TRUE(compositorPush(compositor, replace));
+  compositorRender(compositor, baseFrame(COMPOSITOR_START_MS), 0, out);
+  TEST_ASSERT_FLOAT_WITHIN(0.2f, (200.0f + 200.0f * 200.0f / 255.0f) / 2, scalarToFloat(out.r));
+
+  // Adding or modulating by an effect that leaves the base alone changes nothing
+  CompositorT<RenderScalar> neutral = CompositorT<RenderScalar>();
+  LayerSpec add = {EFFECT_NONE, BLEND_ADD, 1.0f};
+  LayerSpec modulate = {EFFECT_NONE, BLEND_MODULATE_LEVEL, 1.0f};
+  TEST_ASSERT_TRUE(compositorPush(neutral, add));
+  TEST_ASSERT_TRUE(compositorPush(neutral, modulate));
+  compositorRender(neutral, baseFrame(COMPOSITOR_START_MS), 0, out);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 120.0f, scalarToFloat(out.g));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 180.0f, scalarToFloat(out.level));
+}
+
+void test_push_limits()
+{
+  CompositorT<RenderScalar> compositor = CompositorT<RenderScalar>();
+  LayerSpec cycle = {EFFECT_AUTO_CYCLE, BLEND_REPLACE, 1.0f};
+  LayerSpec nested = {EFFECT_LAYERED, BLEND_REPLACE, 1.0f};
+  TEST_ASSERT_FALSE(compositorPush(compositor, cycle));
+  TEST_ASSERT_FALSE(compositorPush(compositor, nested));
+
+  LayerSpec wander = {EFFECT_COLOR_WANDER, BLEND_ADD, 1.0f};
+  for (uint8_t i = 0; i < MAX_COMPOSITOR_LAYERS; i++)
+  {
+    TEST_ASSERT_TRUE(compositorPush(compositor, wander));
+  }
+  TEST_ASSERT_FALSE(compositorPush(compositor, wander));
+}
+
+void test_frame_interval_is_the_fastest_layer()
+{
+  CompositorT<RenderScalar> compositor = CompositorT<RenderScalar>();
+  TEST_ASSERT_EQUAL_UINT32(EFFECT_FRAME_CONTINUOUS, compositorFrameInterval(compositor, 0));
+
+  LayerSpec wander = {EFFECT_COLOR_WANDER, BLEND_REPLACE, 1.0f};
+  LayerSpec breathing = {EFFECT_BREATHING, BLEND_MODULATE_LEVEL, 1.0f};
+  compositorPush(compositor, wander);
+  compositorPush(compositor, breathing);
+  EffectOutputT<RenderScalar> out;
+  compositorRender(compositor, baseFrame(COMPOSITOR_START_MS), 0, out);
+  TEST_ASSERT_EQUAL_UINT32(BREATHING_FRAME_MS, compositorFrameInterval(compositor, 0));
+}
+
+void test_layer_cost_is_recorded()
+{
+  EffectState layered = EffectState();
+  effectStart(layered, EFFECT_LAYERED, COMPOSITOR_START_MS);
+  for (uint32_t frame = 1; frame <= 50; frame++)
+  {
+    renderAlone(layered, COMPOSITOR_START_MS + frame * 20);
+  }
+
+  CompositorT<RenderScalar> &compositor = layered.composite.layers;
+  for (uint8_t i = 0; i < compositor.count; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(50, compositor.layers[i].cost.frames);
+    TEST_ASSERT_TRUE(compositor.layers[i].cost.cycles >= compositor.layers[i].cost.worstCycles);
+  }
+  compositorLogCost(compositor);
+  TEST_ASSERT_EQUAL_UINT32(0, compositor.layers[0].cost.frames);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_default_stack_breathes_the_fire);
+  RUN_TEST(test_blend_modes);
+  RUN_TEST(test_push_limits);
+  RUN_TEST(test_frame_interval_is_the_fastest_layer);
+  RUN_TEST(test_layer_cost_is_recorded);
+  return UNITY_END();
+}
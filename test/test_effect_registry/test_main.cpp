@@ -0,0 +1,194 @@
+// Effect registry and per-effect state. Run with:
+// pio test -e native -f test_effect_registry -v
+
+#include <Effects.h>
+#include <unity.h>
+
+#include <stdio.h>
+#include <string.h>
+
+const uint32_t REGISTRY_START_MS = 1000;
+
+void test_every_effect_is_registered()
+{
+  for (int type = 0; type < MAX_EFFECT_NUMBER; type++)
+  {
+    TEST_ASSERT_FALSE(strcmp("?", effectName((EffectType)type)) == 0);
+  }
+  TEST_ASSERT_EQUAL_STRING("SCENE_CHANGE", effectName(EFFECT_SCENE_CHANGE));
+  TEST_ASSERT_EQUAL_STRING("AUTO_CYCLE", effectName(EFFECT_AUTO_CYCLE));
+  TEST_ASSERT_EQUAL_STRING("?", effectName(MAX_EFFECT_NUMBER));
+}
+
+void test_state_sizes_are_explicit()
+{
+  // The slot data is exactly as large as the largest leaf effect needs
+  size_t largest = 0;
+  printf("\n%-20s %8s\n", "effect", "bytes");
+  for (int type = 0; type < MAX_EFFECT_NUMBER; type++)
+  {
+    size_t size = effectStateSize((EffectType)type);
+    printf("%-20s %8zu\n", effectName((EffectType)type), size);
+    if (type != EFFECT_AUTO_CYCLE && type != EFFECT_LAYERED)
+    {
+      largest = max(largest, size);
+    }
+  }
+  printf("%-20s %8zu\n", "EffectState", sizeof(EffectState));
+
+  TEST_ASSERT_EQUAL_UINT32(sizeof(EffectDataT<RenderScalar>), largest);
+  TEST_ASSERT_EQUAL_UINT32(0, effectStateSize(EFFECT_FIREPLACE)); // Oscillators only
+  TEST_ASSERT_EQUAL_UINT32(sizeof(AutoCycleStateT<RenderScalar>), effectStateSize(EFFECT_AUTO_CYCLE));
+  // The composites share theirs
+  TEST_ASSERT_EQUAL_UINT32(sizeof(CompositeDataT<RenderScalar>),
+                           max(effectStateSize(EFFECT_AUTO_CYCLE), effectStateSize(EFFECT_LAYERED)));
+}
+
+static void render(EffectState &state, uint32_t now)
+{
+  FrameContextT<RenderScalar> frame = {now, 20, RenderScalar(200), RenderScalar(120), RenderScalar(40),
+                                       RenderScalar(180), {200 * 257, 120 * 257, 40 * 257}};
+  RenderScalar r, g, b, level;
+  applyEffects(state, frame, r, g, b, level);
+}
+
+void test_switching_starts_from_clean_state()
+{
+  Serial.muted = true;
+  EffectState state = EffectState();
+  effectStart(state, EFFECT_SCENE_CHANGE, REGISTRY_START_MS);
+  render(state, REGISTRY_START_MS + 20);
+  TEST_ASSERT_TRUE(state.slot.data.sceneChange.transitionTime > 0);
+  TEST_ASSERT_EQUAL_INT(EFFECT_SCENE_CHANGE, state.slot.oscillators.owner);
+
+  // The scene's timers must not leak into the next effect as its schedule
+  effectStart(state, EFFECT_COLOR_STEPS, REGISTRY_START_MS + 5000);
+  render(state, REGISTRY_START_MS + 5000);
+  TEST_ASSERT_EQUAL_UINT32(COLOR_STEPS_INTERVAL_MS, state.slot.data.colorSteps.nextStep);
+  TEST_ASSERT_EQUAL_UINT32(COLOR_STEPS_INTERVAL_MS, effectFrameInterval(state, REGISTRY_START_MS + 5000));
+
+  effectStart(state, EFFECT_BREATHING, REGISTRY_START_MS + 9000);
+  render(state, REGISTRY_START_MS + 9000);
+  TEST_ASSERT_EQUAL_UINT8(1, state.slot.oscillators.count);
+  TEST_ASSERT_EQUAL_UINT32(BREATHING_FRAME_MS, effectFrameInterval(state, REGISTRY_START_MS + 9000));
+  Serial.muted = false;
+}
+
+void test_auto_cycle_restarts_its_sub_effects()
+{
+  Serial.muted = true;
+  EffectState state = EffectState();
+  state.seed = 7;
+  effectStart(state, EFFECT_AUTO_CYCLE, REGISTRY_START_MS);
+
+  // Every sub-effect gets the slot to itself, whatever ran there before
+  uint32_t now = REGISTRY_START_MS;
+  int switches = 0;
+  int current = -1;
+  while (switches < 6)
+  {
+    now += 20;
+    render(state, now);
+    TEST_ASSERT_EQUAL_INT(state.composite.autoCycle.subEffect, state.slot.oscillators.owner);
+    if (state.composite.autoCycle.subEffect != current)
+    {
+      current = state.composite.autoCycle.subEffect;
+      switches++;
+      // Started on this frame: oscillators from now, state freshly set up
+      TEST_ASSERT_EQUAL_UINT32(now - REGISTRY_START_MS, state.slot.oscillators.epoch);
+    }
+  }
+  Serial.muted = false;
+}
+
+// Oscillator-only effects render the same from a copy of their slot
+static bool deterministic(int type)
+{
+  return type != EFFECT_NONE && effectStateSize((EffectType)type) == 0;
+}
+
+static void renderOutput(EffectState &state, uint32_t now, float output[4])
+{
+  FrameContextT<RenderScalar> frame = {now, 20, RenderScalar(200), RenderScalar(120), RenderScalar(40),
+                                       RenderScalar(180), {200 * 257, 120 * 257, 40 * 257}};
+  RenderScalar r, g, b, level;
+  applyEffects(state, frame, r, g, b, level);
+  output[0] = scalarToFloat(r);
+  output[1] = scalarToFloat(g);
+  output[2] = scalarToFloat(b);
+  output[3] = scalarToFloat(level);
+}
+
+// Both sides of an AUTO_CYCLE crossfade keep animating: every blended frame
+// matches the outgoing and the incoming effect each rendered on their own
+void test_auto_cycle_crossfades_live_effects()
+{
+  Serial.muted = true;
+  EffectState state = EffectState();
+  state.seed = 11;
+  effectStart(state, EFFECT_AUTO_CYCLE, REGISTRY_START_MS);
+
+  uint32_t now = REGISTRY_START_MS;
+  int checked = 0;
+  float output[4];
+  while (checked < 3 && now < REGISTRY_START_MS + 10000000)
+  {
+    EffectState before = state;
+    now += 20;
+    renderOutput(state, now, output);
+    if (before.composite.autoCycle.inTransition || !state.composite.autoCycle.inTransition ||
+        !deterministic(state.composite.autoCycle.prevEffect) || !deterministic(state.composite.autoCycle.subEffect))
+    {
+      continue;
+    }
+
+    // The transition started this frame: run each side on its own from here
+    EffectState outgoing = before;
+    outgoing.type = (EffectType)state.composite.autoCycle.prevEffect;
+    EffectState incoming = state;
+    incoming.type = (EffectType)state.composite.autoCycle.subEffect;
+
+    float previousOutput[4], currentOutput[4];
+    while (true)
+    {
+      now += 20;
+      renderOutput(state, now, output);
+      if (!state.composite.autoCycle.inTransition)
+      {
+        break;
+      }
+      renderOutput(outgoing, now, previousOutput);
+      renderOutput(incoming, now, currentOutput);
+
+      float progress = (float)(now - state.startTime - state.composite.autoCycle.transitionStart) / AUTO_CYCLE_TRANSITION_TIME_MS;
+      float smooth = progress * progress * (3.0f - 2.0f * progress);
+      for (int channel = 0; channel < 4; channel++)
+      {
+        float expected = previousOutput[channel] * (1.0f - smooth) + currentOutput[channel] * smooth;
+        TEST_ASSERT_FLOAT_WITHIN(0.05f, expected, output[channel]);
+      }
+    }
+    checked++;
+  }
+  TEST_ASSERT_EQUAL_INT(3, checked);
+  Serial.muted = false;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_every_effect_is_registered);
+  RUN_TEST(test_state_sizes_are_explicit);
+  RUN_TEST(test_switching_starts_from_clean_state);
+  RUN_TEST(test_auto_cycle_restarts_its_sub_effects);
+  RUN_TEST(test_auto_cycle_crossfades_live_effects);
+  return UNITY_END();
+}
@@ -0,0 +1,339 @@
+// Effect program interpreter: loader checks, instruction semantics, bounded
+// cost and EFFECT_PROGRAM against the native effect it replicates. Run with:
+// pio test -e native -f test_effect_vm -v
+
+#include <Effects.h>
+#include <StateStore.h>
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+const uint32_t VM_START_MS = 1000;
+const uint32_t VM_FRAME_MS = 20;
+
+// Image builder, byte for byte what tools/pvm_asm.py writes
+struct ImageBuilder
+{
+  std::vector<Phase> oscillators;
+  std::vector<int32_t> constants;
+  std::vector<VmInstruction> code;
+  uint16_t frameMs = 0;
+
+  std::vector<uint8_t> build(const char *name = "test") const
+  {
+    std::vector<uint8_t> image = {'P', 'V', 'M', VM_VERSION, (uint8_t)oscillators.size(), (uint8_t)constants.size()};
+    putLe(image, code.size(), 2);
+    putLe(image, frameMs, 2);
+    putLe(image, 0, 2);
+    char padded[VM_NAME_LENGTH] = {};
+    memcpy(padded, name, min(strlen(name), (size_t)VM_NAME_LENGTH));
+    image.insert(image.end(), padded, padded + VM_NAME_LENGTH);
+    for (Phase step : oscillators)
+    {
+      putLe(image, step, 4);
+    }
+    for (int32_t raw : constants)
+    {
+      putLe(image, (uint32_t)raw, 4);
+    }
+    for (const VmInstruction &instruction : code)
+    {
+      image.insert(image.end(), {instruction.op, instruction.dst, instruction.a, instruction.b});
+    }
+    image.push_back(crc8(image.data(), image.size()));
+    return image;
+  }
+
+  static void putLe(std::vector<uint8_t> &image, uint32_t value, int bytes)
+  {
+    for (int i = 0; i < bytes; i++)
+    {
+      image.push_back((value >> (8 * i)) & 0xFF);
+    }
+  }
+};
+
+static bool load(const ImageBuilder &builder, VmProgram &program)
+{
+  std::vector<uint8_t> image = builder.build();
+  return vmLoad(image.data(), image.size(), program);
+}
+
+static int32_t raw(float value)
+{
+  return Fix16(value).raw;
+}
+
+void test_loader_rejects_bad_images()
+{
+  VmProgram program;
+  ImageBuilder valid;
+  valid.constants = {raw(1.0f)};
+  valid.code = {{VM_LDK, 6, 0, 0}, {VM_SKIPLT, 1, 6, 7}, {VM_ADD, 0, 0, 6}, {VM_HALT, 0, 0, 0}};
+  TEST_ASSERT_TRUE(load(valid, program));
+  TEST_ASSERT_EQUAL_STRING("test", program.name);
+
+  std::vector<uint8_t> image = valid.build();
+  image[VM_HEADER_SIZE] ^= 1; // Flipped bit: CRC mismatch
+  TEST_ASSERT_FALSE(vmLoad(image.data(), image.size(), program));
+  image = valid.build();
+  TEST_ASSERT_FALSE(vmLoad(image.data(), image.size() - 1, program)); // Cut short
+
+  ImageBuilder bad = valid;
+  bad.code[2] = {VM_OP_COUNT, 0, 0, 0}; // Unknown opcode
+  TEST_ASSERT_FALSE(load(bad, program));
+  bad = valid;
+  bad.code[2] = {VM_ADD, 0, 0, VM_REGISTERS}; // No such register
+  TEST_ASSERT_FALSE(load(bad, program));
+  bad = valid;
+  bad.code[0] = {VM_LDK, 6, 1, 0}; // No such constant
+  TEST_ASSERT_FALSE(load(bad, program));
+  bad = valid;
+  bad.code[0] = {VM_OSC, 6, 0, 0}; // No oscillators declared
+  TEST_ASSERT_FALSE(load(bad, program));
+  bad = valid;
+  bad.code[1] = {VM_SKIPLT, 3, 6, 7}; // Skips past the end
+  TEST_ASSERT_FALSE(load(bad, program));
+  bad = valid;
+  bad.code.assign(VM_MAX_CODE + 1, {VM_ADD, 0, 0, 0});
+  TEST_ASSERT_FALSE(load(bad, program));
+}
+
+void test_instructions()
+{
+  ImageBuilder builder;
+  builder.oscillators = {phaseStep(0.001f)};
+  builder.constants = {raw(0.25f), raw(10.0f), raw(-3.0f), raw(1.5707964f)};
+  builder.code = {
+      {VM_LDK, 6, 0, 0},    // r6 = 0.25
+      {VM_LDK, 7, 1, 0},    // r7 = 10
+      {VM_LDK, 8, 2, 0},    // r8 = -3
+      {VM_MOV, 9, 6, 0},    // r9 = 0.25
+      {VM_MIX, 9, 8, 7},    // r9 = -3 + 13 * 0.25 = 0.25
+      {VM_ABS, 10, 8, 0},   // r10 = 3
+      {VM_CLAMP, 8, 6, 7},  // r8 = 0.25
+      {VM_DIV, 11, 7, 10},  // r11 = 3.333
+      {VM_LDK, 0, 3, 0},    // r0 = PI/2
+      {VM_SIN, 0, 0, 0},    // r0 = 1
+      {VM_OSC, 1, 0, 0},    // r1 = sin(0) at the epoch
+      {VM_MUL, 2, 7, 10},   // r2 = 30
+      {VM_SUB, 3, 6, 7},    // r3 = -9.75
+      {VM_DIV, 12, 7, 1},   // Division by zero: 0
+      {VM_MIN, 13, 8, 10},  // 0.25
+      {VM_MAX, 14, 8, 10},  // 3
+      {VM_HALT, 0, 0, 0},
+      {VM_LDK, 0, 1, 0},    // Never reached
+  };
+  VmProgram program;
+  TEST_ASSERT_TRUE(load(builder, program));
+  OscillatorBank bank;
+  oscillatorBankReset(bank);
+  vmRegisterOscillators(program, bank);
+  oscillatorBankSeek(bank, 0);
+
+  Prng random = {0};
+  int32_t r[VM_REGISTERS] = {};
+  TEST_ASSERT_EQUAL_UINT32(17, vmRun(program, r, bank, random));
+  TEST_ASSERT_EQUAL_INT32(raw(0.25f), r[9]);
+  TEST_ASSERT_EQUAL_INT32(raw(3.0f), r[10]);
+  TEST_ASSERT_EQUAL_INT32(raw(0.25f), r[8]);
+  TEST_ASSERT_INT32_WITHIN(2, raw(10.0f / 3.0f), r[11]);
+  TEST_ASSERT_INT32_WITHIN(4, raw(1.0f), r[0]);
+  TEST_ASSERT_EQUAL_INT32(0, r[1]);
+  TEST_ASSERT_EQUAL_INT32(raw(30.0f), r[2]);
+  TEST_ASSERT_EQUAL_INT32(raw(-9.75f), r[3]);
+  TEST_ASSERT_EQUAL_INT32(0, r[12]);
+  TEST_ASSERT_EQUAL_INT32(raw(0.25f), r[13]);
+  TEST_ASSERT_EQUAL_INT32(raw(3.0f), r[14]);
+}
+
+void test_random_stays_in_range()
+{
+  ImageBuilder builder;
+  builder.constants = {raw(-2.0f), raw(5.0f)};
+  builder.code = {{VM_LDK, 6, 0, 0}, {VM_LDK, 7, 1, 0}, {VM_RND, 0, 6, 7}};
+  VmProgram program;
+  TEST_ASSERT_TRUE(load(builder, program));
+  OscillatorBank bank;
+  oscillatorBankReset(bank);
+
+  Prng random;
+  prngSeed(random, 4);
+  int32_t lowest = INT32_MAX, highest = INT32_MIN;
+  for (int i = 0; i < 10000; i++)
+  {
+    int32_t r[VM_REGISTERS] = {};
+    vmRun(program, r, bank, random);
+    lowest = min(lowest, r[0]);
+    highest = max(highest, r[0]);
+  }
+  TEST_ASSERT_TRUE(lowest >= raw(-2.0f) && lowest < raw(-1.9f));
+  TEST_ASSERT_TRUE(highest < raw(5.0f) && highest > raw(4.9f));
+}
+
+void test_cost_is_bounded_by_length()
+{
+  // Forward skips only: a frame runs each instruction at most once, and a
+  // taken skip runs fewer
+  ImageBuilder builder;
+  builder.constants = {raw(1.0f)};
+  builder.code.assign(VM_MAX_CODE, {VM_MUL, 6, 6, 6});
+  builder.code[0] = {VM_LDK, 7, 0, 0};
+  VmProgram program;
+  TEST_ASSERT_TRUE(load(builder, program));
+  OscillatorBank bank;
+  oscillatorBankReset(bank);
+  Prng random = {0};
+  int32_t r[VM_REGISTERS] = {};
+  TEST_ASSERT_EQUAL_UINT32(VM_MAX_CODE, vmRun(program, r, bank, random));
+
+  builder.code[1] = {VM_SKIPLT, 10, 6, 7}; // r6 (0) < r7 (1)
+  TEST_ASSERT_TRUE(load(builder, program));
+  memset(r, 0, sizeof(r));
+  TEST_ASSERT_EQUAL_UINT32(VM_MAX_CODE - 10, vmRun(program, r, bank, random));
+  builder.code[1] = {VM_JMP, VM_MAX_CODE - 2, 0, 0};
+  TEST_ASSERT_TRUE(load(builder, program));
+  TEST_ASSERT_EQUAL_UINT32(2, vmRun(program, r, bank, random));
+}
+
+template <typename Scalar>
+static void renderFrames(EffectType type, uint32_t frames, std::vector<EffectOutputT<Scalar>> &outputs)
+{
+  EffectStateT<Scalar> state = EffectStateT<Scalar>();
+  effectStart(state, type, VM_START_MS);
+  FrameContextT<Scalar> frame = {VM_START_MS, VM_FRAME_MS, Scalar(200), Scalar(120), Scalar(40), Scalar(180),
+                                 {200 * 257, 120 * 257, 40 * 257}};
+  for (uint32_t i = 0; i < frames; i++)
+  {
+    frame.now += VM_FRAME_MS;
+    EffectOutputT<Scalar> out;
+    applyEffects(state, frame, out.r, out.g, out.b, out.level);
+    outputs.push_back(out);
+  }
+}
+
+template <typename Scalar>
+static void checkBuiltinMatchesBreathing()
+{
+  // The built-in program is BREATHING written in bytecode
+  vmSelected.store(0);
+  std::vector<EffectOutputT<Scalar>> native, program;
+  renderFrames<Scalar>(EFFECT_BREATHING, 2000, native);
+  renderFrames<Scalar>(EFFECT_PROGRAM, 2000, program);
+  for (size_t i = 0; i < native.size(); i++)
+  {
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, scalarToFloat(native[i].r), scalarToFloat(program[i].r));
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, scalarToFloat(native[i].g), scalarToFloat(program[i].g));
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, scalarToFloat(native[i].b), scalarToFloat(program[i].b));
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, scalarToFloat(native[i].level), scalarToFloat(program[i].level));
+  }
+}
+
+void test_builtin_program_matches_breathing()
+{
+  checkBuiltinMatchesBreathing<float>();
+  checkBuiltinMatchesBreathing<Fix16>();
+  TEST_ASSERT_EQUAL_STRING("breathing", vmProgram(0).name);
+  TEST_ASSERT_EQUAL_UINT16(BREATHING_FRAME_MS, vmProgram(0).frameMs);
+}
+
+void test_program_switch_and_persistent_registers()
+{
+  // Counts frames in r12 and shows the count as red
+  ImageBuilder counter;
+  counter.constants = {raw(1.0f)};
+  counter.code = {{VM_LDK, 6, 0, 0}, {VM_ADD, 12, 12, 6}, {VM_MOV, 0, 12, 0}, {VM_MOV, 1, 7, 0}};
+  counter.frameMs = 100;
+  std::vector<uint8_t> image = counter.build("counter");
+  vmLibrary.count.store(0);
+  TEST_ASSERT_TRUE(vmLibraryAdd(vmLibrary, image.data(), image.size()));
+  TEST_ASSERT_EQUAL_UINT8(2, vmProgramCount());
+  vmSelected.store(0);
+  TEST_ASSERT_EQUAL_STRING("counter", vmSelectNext().name);
+
+  EffectState state = EffectState();
+  effectStart(state, EFFECT_PROGRAM, VM_START_MS);
+  FrameContextT<RenderScalar> frame = {VM_START_MS, VM_FRAME_MS, RenderScalar(200), RenderScalar(120),
+                                       RenderScalar(40), RenderScalar(180), {200 * 257, 120 * 257, 40 * 257}};
+  RenderScalar r, g, b, level;
+  for (int i = 1; i <= 3; i++)
+  {
+    frame.now += VM_FRAME_MS;
+    applyEffects(state, frame, r, g, b, level);
+    TEST_ASSERT_EQUAL_FLOAT((float)i, scalarToFloat(r)); // r12 survives the frame
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, scalarToFloat(g));     // Scratch r7 does not
+    TEST_ASSERT_EQUAL_FLOAT(180.0f, scalarToFloat(level));
+  }
+  TEST_ASSERT_EQUAL_UINT32(100, effectFrameInterval(state, frame.now));
+
+  // Wraps back to the built-in program, which starts clean
+  TEST_ASSERT_EQUAL_STRING("breathing", vmSelectNext().name);
+  frame.now += VM_FRAME_MS;
+  applyEffects(state, frame, r, g, b, level);
+  TEST_ASSERT_EQUAL_UINT32(BREATHING_FRAME_MS, effectFrameInterval(state, frame.now));
+  TEST_ASSERT_EQUAL_INT32(0, state.slot.data.program.registers[0]);
+
+  vmLibrary.count.store(0);
+  vmSelected.store(0);
+}
+
+template <typename Scalar>
+static double nsPerFrame(EffectType type, uint32_t frames)
+{
+  std::vector<EffectOutputT<Scalar>> outputs;
+  outputs.reserve(frames);
+  auto start = std::chrono::steady_clock::now();
+  renderFrames<Scalar>(type, frames, outputs);
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / frames;
+}
+
+void test_report_cost()
+{
+  // Per-frame cost of the interpreter next to the native effect, and of the
+  // longest possible program
+  const uint32_t frames = 200000;
+  ImageBuilder longest;
+  longest.constants = {raw(1.0001f)};
+  longest.code.assign(VM_MAX_CODE, {VM_MUL, 3, 3, 6});
+  longest.code[0] = {VM_LDK, 6, 0, 0};
+  std::vector<uint8_t> image = longest.build("longest");
+  vmLibrary.count.store(0);
+  vmLibraryAdd(vmLibrary, image.data(), image.size());
+
+  printf("\n%-24s %12s %12s\n", "effect", "float ns", "fix16 ns");
+  vmSelected.store(0);
+  printf("%-24s %12.1f %12.1f\n", "BREATHING (native)", nsPerFrame<float>(EFFECT_BREATHING, frames),
+         nsPerFrame<Fix16>(EFFECT_BREATHING, frames));
+  printf("%-24s %12.1f %12.1f\n", "PROGRAM breathing", nsPerFrame<float>(EFFECT_PROGRAM, frames),
+         nsPerFrame<Fix16>(EFFECT_PROGRAM, frames));
+  vmSelected.store(1);
+  printf("%-24s %12.1f %12.1f\n", "PROGRAM 64 instructions", nsPerFrame<float>(EFFECT_PROGRAM, frames),
+         nsPerFrame<Fix16>(EFFECT_PROGRAM, frames));
+
+  vmLibrary.count.store(0);
+  vmSelected.store(0);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_loader_rejects_bad_images);
+  RUN_TEST(test_instructions);
+  RUN_TEST(test_random_stays_in_range);
+  RUN_TEST(test_cost_is_bounded_by_length);
+  RUN_TEST(test_builtin_program_matches_breathing);
+  RUN_TEST(test_program_switch_and_persistent_registers);
+  RUN_TEST(test_report_cost);
+  return UNITY_END();
+}
@@ -0,0 +1,139 @@
+// Fixed-point (Q16.16) engine: arithmetic, sine table accuracy and PWM equivalence
+// with the float engine. Run with: pio test -e native -f test_fixed_point
+
+#include <Render.h>
+#include <unity.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+const unsigned long EQUIVALENCE_FRAMES = 30000; // 10 minutes at 50 FPS
+const int MAX_PWM_DIFFERENCE = 1;               // +-1 LSB of the 12-bit output
+
+void test_fix16_arithmetic()
+{
+  TEST_ASSERT_EQUAL_INT32(65536, Fix16(1).raw);
+  TEST_ASSERT_EQUAL_INT32(-32768, Fix16(-0.5f).raw);
+  TEST_ASSERT_EQUAL_INT32(255, (Fix16(127.5f) * Fix16(2)).toInt());
+  TEST_ASSERT_EQUAL_INT32(85, (Fix16(255) / Fix16(3)).toInt());
+  TEST_ASSERT_EQUAL_INT32(0, (Fix16(7) / Fix16(0)).raw);
+  TEST_ASSERT_EQUAL_INT32(-2, (Fix16(-1.5f)).toInt());
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.375f, scalarRatio<Fix16>(750, 2000).toFloat());
+  TEST_ASSERT_TRUE(Fix16(0.1f) < Fix16(0.2f));
+}
+
+void test_sine_table_accuracy()
+{
+  float worst = 0.0f;
+  for (uint32_t i = 0; i < 1000000; i++)
+  {
+    Phase phase = i * 4294u + (i >> 3); // Sweeps every quadrant with odd offsets
+    float expected = sinf((float)(int32_t)phase * (float)(1.0 / PHASE_UNITS_PER_RADIAN));
+    float error = fabsf(sineLookup<Fix16>(phase).toFloat() - expected);
+    if (error > worst)
+    {
+      worst = error;
+    }
+  }
+  TEST_ASSERT_FLOAT_WITHIN(4e-5f, 0.0f, worst);
+  TEST_ASSERT_EQUAL_INT32(65536, sineLookup<Fix16>(0x40000000).raw);
+  TEST_ASSERT_EQUAL_INT32(-65536, sineLookup<Fix16>(0xC0000000).raw);
+}
+
+template <typename Scalar>
+static void renderTrace(EffectType type, SpecialMode mode, std::vector<PwmOutput> &trace)
+{
+  LightStateT<Scalar> light = LightStateT<Scalar>();
+  EffectStateT<Scalar> effect = EffectStateT<Scalar>();
+  effect.type = type;
+
+  LightTargets targets = {200 * 257, 120 * 257, 40 * 257, 180, true, 1000};
+  applyTargets(light, targets);
+  light.specialMode = mode;
+  light.savedR = Scalar(90);
+  light.savedG = Scalar(30);
+  light.savedB = Scalar(160);
+  light.blinkCount = 200;
+
+  hostSetMillis(5000);
+  light.modeStartTime = millis();
+  effect.slot.seed = 4242;
+  FrameClock clock = {(uint32_t)millis(), 0};
+
+  trace.clear();
+  for (unsigned long frame = 0; frame < EQUIVALENCE_FRAMES; frame++)
+  {
+    hostAdvanceMillis(LED_UPDATE_RATE_MS);
+    frameClockAdvance(clock, millis());
+    renderFrame(light, effect, clock);
+    trace.push_back(computeOutput(light));
+
+    // Dim the base halfway through to exercise channels near black
+    if (frame == EQUIVALENCE_FRAMES / 2)
+    {
+      LightTargets dim = {6 * 257, 3 * 257, 257, 180, true, 1000};
+      applyTargets(light, dim);
+    }
+  }
+}
+
+static int channelDifference(uint16_t a, uint16_t b)
+{
+  return abs((int)a - (int)b);
+}
+
+static void checkEquivalence(EffectType type, SpecialMode mode)
+{
+  std::vector<PwmOutput> floatTrace, fixedTrace;
+  renderTrace<float>(type, mode, floatTrace);
+  renderTrace<Fix16>(type, mode, fixedTrace);
+
+  int worst = 0;
+  for (size_t i = 0; i < floatTrace.size(); i++)
+  {
+    worst = max(worst, channelDifference(floatTrace[i].r, fixedTrace[i].r));
+    worst = max(worst, channelDifference(floatTrace[i].g, fixedTrace[i].g));
+    worst = max(worst, channelDifference(floatTrace[i].b, fixedTrace[i].b));
+  }
+
+  char message[80];
+  snprintf(message, sizeof(message), "effect %d mode %d worst %d LSB", type, mode, worst);
+  TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(MAX_PWM_DIFFERENCE, worst, message);
+}
+
+void test_effects_match_float_engine()
+{
+  Serial.muted = true;
+  for (int type = 0; type < MAX_EFFECT_NUMBER; type++)
+  {
+    checkEquivalence((EffectType)type, MODE_NORMAL);
+  }
+  Serial.muted = false;
+}
+
+void test_blink_modes_match_float_engine()
+{
+  Serial.muted = true;
+  checkEquivalence(EFFECT_NONE, MODE_RESET_BLINKING);
+  checkEquivalence(EFFECT_NONE, MODE_EFFECT_BLINKING);
+  Serial.muted = false;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_fix16_arithmetic);
+  RUN_TEST(test_sine_table_accuracy);
+  RUN_TEST(test_effects_match_float_engine);
+  RUN_TEST(test_blink_modes_match_float_engine);
+  return UNITY_END();
+}
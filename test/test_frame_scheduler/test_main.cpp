@@ -0,0 +1,296 @@
+// Adaptive frame scheduling: the LED task only renders as often as the output
+// can change. Run with: pio test -e native -f test_frame_scheduler
+
+#include <Render.h>
+#include <unity.h>
+
+#include <stdio.h>
+#include <vector>
+
+const uint32_t SCHEDULE_START_MS = 1000;
+const uint32_t SCHEDULE_DURATION_MS = 120000; // Several scenes, steps and electrical events
+
+struct FrameOutput
+{
+  int32_t r, g, b, level;
+
+  bool operator!=(const FrameOutput &other) const
+  {
+    return r != other.r || g != other.g || b != other.b || level != other.level;
+  }
+};
+
+static LightState settledLight(bool on)
+{
+  LightState light = LightState();
+  light.target_r = 200 * 257; // Working color, so the base is on 0-255
+  light.target_g = 120 * 257;
+  light.target_b = 40 * 257;
+  light.target_level = 180;
+  light.target_state = on;
+  light.base_r = RenderScalar(200);
+  light.base_g = RenderScalar(120);
+  light.base_b = RenderScalar(40);
+  light.base_level = RenderScalar(180);
+  light.base_state = on;
+  return light;
+}
+
+static FrameOutput sample(EffectState &state, FrameContextT<RenderScalar> &frame)
+{
+  RenderScalar r, g, b, level;
+  applyEffects(state, frame, r, g, b, level);
+  FrameOutput output = {scalarToRaw(r), scalarToRaw(g), scalarToRaw(b), scalarToRaw(level)};
+  return output;
+}
+
+// Render an effect every millisecond as the reference, then again on the
+// cadence effectFrameInterval() asks for. Whenever the effect claims to hold,
+// the reference must not change before the next scheduled frame.
+static void checkScheduledEffect(EffectType type, uint32_t &scheduledFrames)
+{
+  FrameContextT<RenderScalar> frame = {SCHEDULE_START_MS, 1, RenderScalar(200), RenderScalar(120),
+                                       RenderScalar(40), RenderScalar(180), {200 * 257, 120 * 257, 40 * 257}};
+  EffectState reference = EffectState();
+  reference.type = type;
+  reference.slot.seed = 99;
+  std::vector<FrameOutput> trace;
+  for (uint32_t t = 0; t < SCHEDULE_DURATION_MS; t++)
+  {
+    frame.now = SCHEDULE_START_MS + t;
+    trace.push_back(sample(reference, frame));
+  }
+
+  EffectState scheduled = EffectState();
+  scheduled.type = type;
+  scheduled.slot.seed = 99; // Same draws as the reference
+  scheduledFrames = 0;
+  uint32_t t = 0;
+  while (t < SCHEDULE_DURATION_MS)
+  {
+    frame.now = SCHEDULE_START_MS + t;
+    FrameOutput output = sample(scheduled, frame);
+    scheduledFrames++;
+
+    char message[80];
+    snprintf(message, sizeof(message), "effect %d at %u ms", type, (unsigned)t);
+    TEST_ASSERT_FALSE_MESSAGE(output != trace[t], message);
+
+    uint32_t interval = effectFrameInterval(scheduled, frame.now);
+    if (interval == EFFECT_FRAME_CONTINUOUS)
+    {
+      t += LED_UPDATE_RATE_MS;
+      continue;
+    }
+    uint32_t next = interval == EFFECT_FRAME_STATIC ? SCHEDULE_DURATION_MS : min(t + interval, SCHEDULE_DURATION_MS);
+    TEST_ASSERT_TRUE_MESSAGE(interval > 0, message);
+    for (uint32_t held = t + 1; held < next; held++)
+    {
+      TEST_ASSERT_FALSE_MESSAGE(trace[held] != output, message);
+    }
+    t = next;
+  }
+}
+
+void test_event_effects_wake_on_schedule()
+{
+  Serial.muted = true;
+  const EffectType types[] = {EFFECT_NONE, EFFECT_SCENE_CHANGE, EFFECT_COLOR_STEPS, EFFECT_BROKEN_ELECTRICITY};
+  for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+  {
+    uint32_t frames;
+    checkScheduledEffect(types[i], frames);
+    // Far fewer frames than rendering every LED_UPDATE_RATE_MS
+    TEST_ASSERT_LESS_THAN_UINT32(SCHEDULE_DURATION_MS / LED_UPDATE_RATE_MS / 2, frames);
+  }
+  Serial.muted = false;
+}
+
+void test_slow_effects_run_below_full_rate()
+{
+  LightState light = settledLight(true);
+  FrameClock clock = {SCHEDULE_START_MS, LED_UPDATE_RATE_MS};
+  EffectState effect = EffectState();
+  effect.startTime = SCHEDULE_START_MS;
+
+  effect.type = EFFECT_BREATHING;
+  TEST_ASSERT_EQUAL_UINT32(BREATHING_FRAME_MS, renderFrameInterval(light, effect, clock));
+  effect.type = EFFECT_COLOR_WANDER;
+  TEST_ASSERT_EQUAL_UINT32(COLOR_WANDER_FRAME_MS, renderFrameInterval(light, effect, clock));
+  effect.type = EFFECT_FIREPLACE;
+  TEST_ASSERT_EQUAL_UINT32(LED_UPDATE_RATE_MS, renderFrameInterval(light, effect, clock));
+}
+
+// Fine duty rounded to OUTPUT_DITHER_BITS of fraction, in 2^-bits PWM steps
+static uint32_t ditherTarget(uint32_t fine)
+{
+  const int drop = OUTPUT_LUT_FRACTION_BITS - OUTPUT_DITHER_BITS;
+  return (fine + ((1 << drop) >> 1)) >> drop;
+}
+
+// Dim breathing is dithered: its frames keep their own cadence, and the
+// dither steps between them repeat the pattern within DITHER_MAX_PATTERN_MS
+// and average to each frame's fine duty. Bright and held output is not.
+void test_dither_steps_between_frames()
+{
+  if (OUTPUT_DITHER_BITS == 0)
+  {
+    TEST_IGNORE_MESSAGE("dithering is compiled out, run pio test -e native-dither");
+  }
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(DITHER_MAX_PATTERN_MS, DITHER_STEP_MS << OUTPUT_DITHER_BITS);
+
+  LightState light = settledLight(true);
+  light.target_level = 40;
+  light.base_level = RenderScalar(40);
+  EffectState effect = EffectState();
+  TargetMailbox mailbox = {{0}, {0}, {0}, {0}};
+  ControlQueue queue = {{0}, {0}, {}};
+  LedTaskState task;
+  ledTaskStart(task, SCHEDULE_START_MS - BREATHING_FRAME_MS);
+  effectStart(effect, EFFECT_BREATHING, SCHEDULE_START_MS);
+
+  const uint32_t stepsPerFrame = BREATHING_FRAME_MS / DITHER_STEP_MS;
+  uint32_t now = SCHEDULE_START_MS;
+  uint32_t frameAt = 0, frames = 0, dithered = 0, alternating = 0;
+  uint32_t steps = 0, sums[3] = {0, 0, 0};
+  uint16_t low = 0xFFFF, high = 0;
+  PwmOutput fine = {0, 0, 0}, previous = {0, 0, 0};
+  while (now < SCHEDULE_START_MS + 10000)
+  {
+    uint32_t clockBefore = task.clock.now;
+    LedFrame led = ledTaskFrame(task, light, effect, mailbox, queue, now, true);
+    TEST_ASSERT_FALSE(led.fade);
+    if (task.clock.now != clockBefore)
+    {
+      // A frame: the previous one's steps averaged to its fine duty
+      if (steps > 0)
+      {
+        TEST_ASSERT_EQUAL_UINT32(stepsPerFrame, steps);
+        const uint16_t fines[3] = {fine.r, fine.g, fine.b};
+        for (int channel = 0; channel < 3; channel++)
+        {
+          int32_t error =
+              (int32_t)(sums[channel] << OUTPUT_DITHER_BITS) - (int32_t)(steps * ditherTarget(fines[channel]));
+          TEST_ASSERT_INT32_WITHIN((1 << OUTPUT_DITHER_BITS) - 1, 0, error);
+        }
+        dithered++;
+        alternating += low != high;
+      }
+      if (frames++ > 0)
+      {
+        TEST_ASSERT_EQUAL_UINT32(BREATHING_FRAME_MS, now - frameAt);
+      }
+      frameAt = now;
+      TEST_ASSERT_FALSE(led.hold);
+      steps = 0;
+      sums[0] = sums[1] = sums[2] = 0;
+      low = 0xFFFF;
+      high = 0;
+      fine = task.fine;
+    }
+    else
+    {
+      // A dither step: only written when the duty moved
+      bool same = led.pwm.r == previous.r && led.pwm.g == previous.g && led.pwm.b == previous.b;
+      TEST_ASSERT_EQUAL_INT(same, led.hold);
+    }
+
+    if (task.dithering)
+    {
+      TEST_ASSERT_EQUAL_UINT32(DITHER_STEP_MS, led.wait);
+      TEST_ASSERT_INT32_WITHIN(1, ditherTarget(fine.r) >> OUTPUT_DITHER_BITS, led.pwm.r);
+      steps++;
+      sums[0] += led.pwm.r;
+      sums[1] += led.pwm.g;
+      sums[2] += led.pwm.b;
+      low = min(low, led.pwm.r);
+      high = max(high, led.pwm.r);
+    }
+    else
+    {
+      TEST_ASSERT_EQUAL_UINT32(BREATHING_FRAME_MS, led.wait);
+    }
+    previous = led.pwm;
+    now += led.wait;
+  }
+  TEST_ASSERT_EQUAL_UINT32(10000 / BREATHING_FRAME_MS, frames);
+  TEST_ASSERT_TRUE(dithered > frames / 2);
+  TEST_ASSERT_TRUE(alternating > 0);
+
+  // Held output is rounded and idles; bright output is rounded
+  effectStart(effect, EFFECT_NONE, now);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_INTERVAL_IDLE, ledTaskFrame(task, light, effect, mailbox, queue, now, true).wait);
+  TEST_ASSERT_FALSE(task.dithering);
+  const PwmOutput bright = {DITHER_MAX_DUTY << OUTPUT_LUT_FRACTION_BITS | 8, 8, 8};
+  TEST_ASSERT_FALSE(ditherApplies(BREATHING_FRAME_MS, bright));
+  const PwmOutput dim = {8, 8, 8};
+  TEST_ASSERT_TRUE(ditherApplies(BREATHING_FRAME_MS, dim));
+}
+
+void test_static_output_goes_idle()
+{
+  FrameClock clock = {SCHEDULE_START_MS, LED_UPDATE_RATE_MS};
+  EffectState effect = EffectState();
+  effect.type = EFFECT_FIREPLACE;
+  effect.startTime = SCHEDULE_START_MS;
+
+  // Off: nothing to render whatever the effect
+  LightState light = settledLight(false);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_INTERVAL_IDLE, renderFrameInterval(light, effect, clock));
+
+  // On without an effect
+  light = settledLight(true);
+  effect.type = EFFECT_NONE;
+  TEST_ASSERT_EQUAL_UINT32(FRAME_INTERVAL_IDLE, renderFrameInterval(light, effect, clock));
+
+  // Blinking runs at full rate
+  light.specialMode = MODE_EFFECT_BLINKING;
+  TEST_ASSERT_EQUAL_UINT32(LED_UPDATE_RATE_MS, renderFrameInterval(light, effect, clock));
+}
+
+void test_transition_runs_at_full_rate_until_settled()
+{
+  LightState light = settledLight(true);
+  EffectState effect = EffectState();
+  effect.type = EFFECT_NONE;
+  FrameClock clock = {SCHEDULE_START_MS, 0};
+
+  LightTargets targets = {10 * 257, 200 * 257, 90 * 257, 255, true};
+  applyTargets(light, targets);
+
+  uint32_t frames = 0;
+  uint32_t interval = LED_UPDATE_RATE_MS;
+  while (interval != FRAME_INTERVAL_IDLE && frames < 1000)
+  {
+    TEST_ASSERT_EQUAL_UINT32(LED_UPDATE_RATE_MS, interval);
+    frameClockAdvance(clock, clock.now + interval);
+    renderFrame(light, effect, clock);
+    interval = renderFrameInterval(light, effect, clock);
+    frames++;
+  }
+
+  // Settles within a few seconds and lands exactly on the target
+  TEST_ASSERT_LESS_THAN_UINT32(200, frames);
+  TEST_ASSERT_TRUE(light.base_r == RenderScalar(10));
+  TEST_ASSERT_TRUE(light.base_level == RenderScalar(255));
+  TEST_ASSERT_TRUE(light.final_g == RenderScalar(200));
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_event_effects_wake_on_schedule);
+  RUN_TEST(test_slow_effects_run_below_full_rate);
+  RUN_TEST(test_dither_steps_between_frames);
+  RUN_TEST(test_static_output_goes_idle);
+  RUN_TEST(test_transition_runs_at_full_rate_until_settled);
+  return UNITY_END();
+}
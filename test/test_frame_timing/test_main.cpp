@@ -0,0 +1,153 @@
+// Frame-rate independence: effects are functions of the frame clock, so a jittery
+// frame cadence must land on the same output as a steady one at every shared
+// timestamp. Run with: pio test -e native -f test_frame_timing
+
+#include <Render.h>
+#include <unity.h>
+
+#include <map>
+#include <stdio.h>
+
+const uint32_t TIMING_START_MS = 1000;
+const uint32_t TIMING_DURATION_MS = 120000; // Long enough for several scenes and events
+const uint32_t TIMING_GRID_MS = 10;         // Both cadences are multiples of this
+const uint32_t TIMING_MAX_STEP = 10;        // Jittery frames are 1-10 grid steps apart
+
+struct FrameOutput
+{
+  int32_t r, g, b, level;
+};
+
+typedef std::map<uint32_t, FrameOutput> OutputTrace;
+
+// Run one effect over a pre-converged base; a zero jitterSeed renders every grid step
+template <typename Scalar>
+static void effectTrace(EffectType type, uint32_t jitterSeed, OutputTrace &trace)
+{
+  EffectStateT<Scalar> state = EffectStateT<Scalar>();
+  state.type = type;
+  FrameContextT<Scalar> frame = {TIMING_START_MS, 0, Scalar(200), Scalar(120), Scalar(40), Scalar(180), {200 * 257, 120 * 257, 40 * 257}};
+
+  // The effects draw from their slot's stream; the cadence gets its own generator
+  state.slot.seed = 777;
+  uint32_t jitter = jitterSeed;
+
+  trace.clear();
+  while (frame.now < TIMING_START_MS + TIMING_DURATION_MS)
+  {
+    Scalar r, g, b, level;
+    applyEffects(state, frame, r, g, b, level);
+    FrameOutput output = {scalarToRaw(r), scalarToRaw(g), scalarToRaw(b), scalarToRaw(level)};
+    trace[frame.now] = output;
+
+    uint32_t steps = 1;
+    if (jitter != 0)
+    {
+      jitter ^= jitter << 13;
+      jitter ^= jitter >> 17;
+      jitter ^= jitter << 5;
+      steps = 1 + jitter % TIMING_MAX_STEP;
+    }
+    frame.dt = steps * TIMING_GRID_MS;
+    frame.now += frame.dt;
+  }
+}
+
+template <typename Scalar>
+static void checkFrameRateIndependence(EffectType type)
+{
+  OutputTrace steady, jittery;
+  effectTrace<Scalar>(type, 0, steady);
+  effectTrace<Scalar>(type, 0x9E3779B9, jittery);
+
+  for (OutputTrace::const_iterator it = jittery.begin(); it != jittery.end(); ++it)
+  {
+    const FrameOutput &expected = steady[it->first];
+    const FrameOutput &actual = it->second;
+    if (expected.r != actual.r || expected.g != actual.g || expected.b != actual.b ||
+        expected.level != actual.level)
+    {
+      char message[80];
+      snprintf(message, sizeof(message), "effect %d diverges at %u ms", type, (unsigned)it->first);
+      TEST_FAIL_MESSAGE(message);
+    }
+  }
+}
+
+// AUTO_CYCLE still captures its crossfade source on the frame that notices the
+// switch, so it is frame-quantized by design and left out here
+void test_effects_ignore_frame_cadence()
+{
+  Serial.muted = true;
+  for (int type = 0; type < MAX_EFFECT_NUMBER; type++)
+  {
+    if (type == EFFECT_AUTO_CYCLE)
+    {
+      continue;
+    }
+    checkFrameRateIndependence<float>((EffectType)type);
+    checkFrameRateIndependence<Fix16>((EffectType)type);
+  }
+  Serial.muted = false;
+}
+
+// Base interpolation covers the same distance per unit of time at any frame rate
+template <typename Scalar>
+static float baseAfter(uint32_t frameMs, uint32_t durationMs)
+{
+  LightStateT<Scalar> light = LightStateT<Scalar>();
+  EffectStateT<Scalar> effect = EffectStateT<Scalar>();
+  light.base_state = true;
+  LightTargets targets = {0, 0, 0, 255, true, 1000};
+  applyTargets(light, targets);
+
+  FrameClock clock = {TIMING_START_MS, 0};
+  for (uint32_t now = TIMING_START_MS + frameMs; now <= TIMING_START_MS + durationMs; now += frameMs)
+  {
+    frameClockAdvance(clock, now);
+    renderFrame(light, effect, clock);
+  }
+  return scalarToFloat(light.base_level);
+}
+
+void test_base_interpolation_ignores_frame_cadence()
+{
+  // 400 ms into a 1 s transition: smoothstep(0.4) of the way there
+  float expected = 255.0f * 0.4f * 0.4f * (3.0f - 2.0f * 0.4f);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, expected, baseAfter<float>(LED_UPDATE_RATE_MS, 400));
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, expected, baseAfter<float>(5, 400));
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, expected, baseAfter<float>(50, 400));
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, expected, baseAfter<Fix16>(8, 400));
+}
+
+void test_frame_clock_caps_gaps()
+{
+  FrameClock clock = {TIMING_START_MS, 0};
+  frameClockAdvance(clock, TIMING_START_MS + 20);
+  TEST_ASSERT_EQUAL_UINT32(20, clock.dt);
+  frameClockAdvance(clock, TIMING_START_MS + 20 + 5000);
+  TEST_ASSERT_EQUAL_UINT32(MAX_FRAME_DT_MS, clock.dt);
+  TEST_ASSERT_EQUAL_UINT32(TIMING_START_MS + 5020, clock.now);
+
+  // millis() wrapping around is just another short frame
+  clock.now = 0xFFFFFFF0u;
+  frameClockAdvance(clock, 0x00000004u);
+  TEST_ASSERT_EQUAL_UINT32(20, clock.dt);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_effects_ignore_frame_cadence);
+  RUN_TEST(test_base_interpolation_ignores_frame_cadence);
+  RUN_TEST(test_frame_clock_caps_gaps);
+  return UNITY_END();
+}
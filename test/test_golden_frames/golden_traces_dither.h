@@ -0,0 +1,1258 @@
+// Golden traces for test_golden_frames, recorded with -DGOLDEN_UPDATE. Do not edit.
+
+static_assert(OUTPUT_DITHER_BITS == 2, "recorded with PELARBOJ_DITHER_BITS=2");
+
+const GoldenTrace GOLDEN_TRACES[2][16] = {
+    {
+        {"NONE", 41, {27790, 11599, 5287}, 439.92f, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 664}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {1703, 852, 681}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0xa11df5e6, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xe23c87ec,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x538c2775, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xbeb5a100, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5}},
+        {"COLOR_WANDER", 33492, {27455, 11601, 5252}, 57.93f, {
+             {0, 0, 0}, {1637, 618, 118}, {1683, 588, 1}, {1703, 508, 74}, {1703, 495, 112}, {1655, 568, 0},
+             {1650, 620, 85}, {1703, 575, 103}, {1703, 498, 0}, {1691, 503, 95}, {1636, 582, 94}, {1694, 620, 0},
+             {1703, 560, 104}, {1703, 491, 83}, {1648, 514, 0}, {1652, 593, 115}, {30, 91, 658}, {36, 64, 634},
+             {5, 42, 658}, {0, 57, 657}, {15, 87, 636}, {40, 88, 658}, {21, 59, 653}, {0, 42, 639},
+             {0, 62, 658}, {33, 90, 649}, {34, 85, 642}, {1, 53, 658}, {0, 43, 645}, {20, 68, 646},
+             {60, 103, 679}, {1703, 884, 241}, {1638, 804, 264}, {1677, 793, 348}, {1703, 868, 233}, {1703, 918, 275},
+             {1660, 871, 344}, {1646, 795, 227}, {1703, 802, 286}, {1703, 882, 338}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1833, 997, 345}, {3975, 1688, 251}, {4095, 1552, 494},
+             {4095, 1650, 481}, {4053, 1838, 252}, {3935, 1840, 516}, {4088, 1653, 456}, {4095, 1552, 258}, {4095, 1684, 535},
+             {3955, 1857, 430}, {3996, 1816, 268}, {4095, 1622, 550}, {4095, 1559, 403}, {4026, 1720, 282}, {3941, 1868, 562}}, {
+             {0, 0, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0},
+             {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0},
+             {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {0, 41, 115}, {0, 41, 632}, {0, 41, 632},
+             {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632},
+             {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632},
+             {60, 103, 217}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217},
+             {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1833, 997, 251}, {3934, 1551, 251}, {3934, 1551, 251},
+             {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251},
+             {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}}, {
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129},
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129},
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1652, 593, 692}, {40, 93, 658}, {40, 93, 658},
+             {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658},
+             {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658},
+             {1703, 918, 714}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351},
+             {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572},
+             {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572},
+             {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}}, {
+             0x5f0d55f1, 0x9c2aa7be, 0x0be5c023, 0xb059898a, 0xb19b7caf, 0xfb58198d, 0x89f80d9a, 0x6ed588da,
+             0x55a07885, 0xff865bcb, 0xbbb4ae8a, 0xaa7317d0, 0xd9e9e731, 0x6ddf31b2, 0x774ac69b, 0xc9d8baf6,
+             0x2816aeb3, 0xaf65880d, 0xfc612813, 0xfdcdd439, 0xc8ac25ce, 0x110397a5, 0xbdff42b2, 0x363fd070,
+             0xac493294, 0xb55e908c, 0xeb152e42, 0xe07d33ed, 0x83ffc8f7, 0x13645b01, 0x881a2e0b, 0x398e3b63,
+             0x05a7870d, 0x6dc9cbfa, 0x32192fe6, 0x34a6121c, 0xaeff98cc, 0x7be08856, 0x0d53fd29, 0xe8950f92,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x42b47887, 0x474637b3, 0x887060fb,
+             0x228c097e, 0x12e3555c, 0x4b095be9, 0xa358d392, 0x48f1457f, 0xcd2a61a8, 0xd9604463, 0xa22e4f72,
+             0x93f3c6a9, 0xee2f5d3d, 0x99e6e576, 0x78a2d9b6}},
+        {"LEVEL_PULSE", 256636, {25556, 10653, 5386}, 57.34f, {
+             {0, 0, 0}, {530, 172, 19}, {1244, 405, 46}, {3669, 1193, 135}, {2865, 932, 105}, {768, 250, 28},
+             {687, 223, 25}, {2607, 848, 96}, {3814, 1240, 140}, {1427, 464, 52}, {521, 170, 19}, {1491, 485, 55},
+             {3852, 1253, 141}, {2522, 820, 93}, {664, 216, 24}, {799, 260, 30}, {23, 112, 1091}, {28, 135, 1318},
+             {10, 48, 474}, {5, 23, 232}, {15, 70, 684}, {30, 147, 1434}, {18, 84, 825}, {6, 26, 253},
+             {8, 39, 386}, {25, 123, 1201}, {26, 125, 1228}, {9, 41, 402}, {5, 25, 247}, {17, 81, 795},
+             {37, 151, 1441}, {1856, 928, 309}, {544, 272, 91}, {1134, 567, 189}, {3549, 1774, 591}, {3035, 1517, 506},
+             {834, 417, 139}, {642, 321, 107}, {2432, 1216, 405}, {3887, 1943, 648}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {785, 386, 125}, {1678, 701, 169}, {4095, 1711, 412},
+             {4095, 1711, 412}, {3087, 1290, 310}, {1162, 486, 117}, {3903, 1631, 392}, {4095, 1711, 412}, {4095, 1711, 412},
+             {1400, 585, 141}, {1997, 834, 201}, {4095, 1711, 412}, {4095, 1711, 412}, {2541, 1062, 255}, {1227, 513, 123}}, {
+             {0, 0, 0}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19},
+             {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19},
+             {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {4, 23, 30}, {4, 23, 227}, {4, 23, 227},
+             {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227},
+             {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227},
+             {37, 151, 87}, {521, 261, 87}, {521, 261, 87}, {521, 261, 87}, {521, 261, 87}, {521, 261, 87},
+             {521, 261, 87}, {521, 261, 87}, {521, 261, 87}, {521, 261, 87}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {785, 386, 116}, {1152, 481, 116}, {1152, 481, 116},
+             {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116},
+             {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}}, {
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146},
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146},
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {799, 260, 1440}, {31, 147, 1440}, {31, 147, 1440},
+             {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440},
+             {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440},
+             {3971, 1986, 1517}, {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662},
+             {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0xec502ab3, 0xcf2f5272, 0xca64232a, 0xc0a54d18, 0x2d58b9cc, 0x03b83f7b, 0x4a488130, 0x2c123f8a,
+             0xb2c5b6ee, 0x86748e16, 0x8c3a9e3b, 0xcbfeecc3, 0x61009efb, 0x3cf0421f, 0x149f5669, 0x1fd83cd0,
+             0xa7b081a8, 0x04918ce0, 0x7c4e8862, 0x152408a2, 0x0723599e, 0xe475906d, 0xdc71e7fd, 0xa41695a3,
+             0xf69fa104, 0x108ad2f5, 0x394d7a03, 0xf30b0077, 0x28044e7e, 0xc8addbe1, 0x9b989e66, 0x30ae0301,
+             0x9cf39e83, 0xa0c71a4d, 0x3dd1d325, 0xb917f181, 0x7bf5bc76, 0xe123439c, 0x6831c8aa, 0xc50e8938,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x4cff94ac, 0x780a007e, 0x8c6ccee4,
+             0xa4a2c95d, 0x560bc60a, 0x25a4e945, 0x84bf718d, 0x839f1af0, 0x97adcc56, 0x39d5b177, 0xeff94d4a,
+             0xa4f312a5, 0x964c30d1, 0x250bfc3b, 0xe066df6a}},
+        {"COMBO", 310002, {26840, 11167, 5016}, 52.50f, {
+             {0, 0, 0}, {2718, 1026, 197}, {3731, 1304, 3}, {3895, 1161, 169}, {3094, 899, 203}, {1894, 651, 0},
+             {1033, 389, 53}, {625, 211, 38}, {524, 153, 0}, {708, 211, 40}, {1229, 437, 70}, {2266, 829, 0},
+             {3398, 1118, 208}, {3967, 1145, 194}, {3445, 1075, 0}, {2417, 868, 165}, {25, 78, 560}, {18, 32, 314},
+             {1, 15, 233}, {0, 22, 251}, {9, 52, 377}, {41, 91, 678}, {34, 95, 1064}, {0, 87, 1346},
+             {0, 133, 1406}, {56, 154, 1104}, {37, 93, 706}, {0, 34, 417}, {0, 17, 256}, {6, 24, 225},
+             {20, 44, 309}, {1325, 688, 188}, {2254, 1107, 363}, {3399, 1608, 705}, {3971, 2024, 544}, {3510, 1893, 567},
+             {2357, 1237, 489}, {1333, 644, 184}, {759, 357, 128}, {531, 275, 106}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3971, 2159, 747}, {3975, 1688, 251}, {4095, 1552, 494},
+             {2312, 932, 272}, {1323, 600, 82}, {1128, 528, 148}, {1719, 695, 192}, {3258, 1235, 205}, {4095, 1684, 535},
+             {3955, 1857, 430}, {3996, 1816, 268}, {4095, 1622, 550}, {4095, 1559, 403}, {3101, 1324, 217}, {1611, 764, 230}}, {
+             {0, 0, 0}, {2718, 837, 0}, {3651, 1089, 0}, {3044, 889, 0}, {1891, 571, 0}, {1034, 320, 0},
+             {625, 187, 0}, {501, 149, 0}, {509, 150, 0}, {708, 211, 0}, {1229, 391, 0}, {2234, 676, 0},
+             {3347, 983, 0}, {3434, 1024, 0}, {2421, 730, 0}, {0, 37, 165}, {0, 21, 314}, {0, 14, 228},
+             {0, 14, 219}, {0, 16, 246}, {0, 26, 377}, {0, 44, 678}, {0, 68, 1051}, {0, 87, 1346},
+             {0, 72, 1105}, {0, 48, 705}, {0, 28, 416}, {0, 16, 256}, {0, 14, 219}, {0, 14, 225},
+             {20, 44, 101}, {1325, 630, 173}, {2254, 1090, 334}, {3348, 1608, 455}, {3433, 1649, 455}, {2348, 1175, 334},
+             {1334, 645, 184}, {759, 353, 101}, {518, 247, 70}, {501, 240, 66}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3934, 1551, 251}, {3934, 1551, 251}, {2313, 892, 162},
+             {1304, 519, 82}, {1107, 436, 71}, {1128, 449, 75}, {1696, 663, 111}, {3258, 1235, 205}, {3934, 1551, 251},
+             {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3087, 1226, 197}, {1612, 661, 111}, {1148, 449, 75}}, {
+             {2761, 1025, 212}, {3769, 1370, 280}, {3971, 1447, 301}, {3895, 1403, 294}, {3094, 1101, 212}, {1920, 697, 135},
+             {1033, 389, 78}, {625, 217, 43}, {707, 248, 48}, {1239, 436, 94}, {2272, 829, 160}, {3397, 1225, 238},
+             {3967, 1442, 301}, {3971, 1447, 301}, {3532, 1280, 261}, {2417, 868, 964}, {31, 78, 560}, {20, 44, 318},
+             {15, 35, 252}, {23, 52, 377}, {41, 95, 678}, {61, 149, 1069}, {82, 194, 1362}, {87, 204, 1439},
+             {84, 198, 1406}, {63, 158, 1104}, {43, 95, 711}, {25, 56, 417}, {16, 36, 256}, {19, 43, 308},
+             {1325, 704, 327}, {2273, 1227, 434}, {3439, 1814, 708}, {3971, 2134, 815}, {3971, 2141, 815}, {3510, 1893, 708},
+             {2391, 1237, 489}, {1333, 702, 255}, {759, 397, 151}, {594, 321, 118}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 2159, 747}, {4095, 1872, 572}, {4095, 1872, 572},
+             {2312, 1025, 277}, {1332, 607, 178}, {1720, 766, 233}, {3257, 1413, 409}, {4095, 1872, 572}, {4095, 1872, 572},
+             {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {3123, 1407, 408}, {1619, 764, 232}}, {
+             0x7304139f, 0x58c16e0b, 0x6828085a, 0x9151ca5f, 0xa496f3e3, 0x5ba6e4e5, 0xec7ea6d3, 0xbc3a5e05,
+             0x27382e5f, 0x0ced2ad2, 0x5cdfe783, 0xb538af43, 0x93dabba3, 0x11b64d5e, 0x3cf3d94f, 0xf0e0b6bd,
+             0x508f4dbd, 0xcbd35bac, 0xc7ed6ba5, 0x5356789e, 0xb81dade5, 0x99b2469f, 0x2c42c79e, 0xeb924866,
+             0x8b6c4aaa, 0x950b4e40, 0x776b2a89, 0xe7b27d0c, 0x39a63cd8, 0x546a8f2d, 0xffcbf5fd, 0xc8916678,
+             0x4bee5316, 0x9386bb44, 0xd4ca1bcd, 0xf45ba3ca, 0x422db244, 0x0077c12f, 0x27a7f69e, 0x615d53aa,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x0667554a, 0xd00799d1, 0x71915d1f,
+             0xfbc92a6c, 0x85212ef1, 0xe3a20e9a, 0x163c821e, 0x6f8632e9, 0x9ea47a58, 0xd0e55a18, 0x34d711ed,
+             0x9d4424fe, 0x000f1064, 0x9a52fad7, 0xa69efb41}},
+        {"SCENE_CHANGE", 207934, {24266, 10856, 5216}, 42.61f, {
+             {0, 0, 0}, {2016, 1007, 434}, {2839, 912, 294}, {2320, 697, 106}, {1285, 418, 27}, {1048, 427, 22},
+             {2617, 688, 81}, {1877, 564, 249}, {845, 245, 84}, {3073, 1590, 29}, {3107, 1315, 0}, {1048, 427, 59},
+             {2128, 647, 120}, {999, 301, 0}, {1870, 792, 135}, {2349, 626, 493}, {60, 209, 1065}, {42, 17, 211},
+             {0, 0, 1056}, {0, 114, 399}, {0, 61, 213}, {0, 0, 256}, {23, 46, 464}, {104, 56, 658},
+             {0, 363, 1135}, {0, 57, 239}, {74, 105, 480}, {231, 156, 1243}, {28, 16, 227}, {0, 141, 598},
+             {48, 8, 259}, {953, 585, 255}, {1546, 1016, 494}, {2209, 1122, 334}, {2238, 1195, 860}, {841, 631, 184},
+             {1793, 1003, 210}, {1726, 755, 565}, {1791, 963, 507}, {1461, 885, 496}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {951, 341, 80}, {3308, 1711, 1134}, {3196, 1306, 123},
+             {2806, 1349, 711}, {3340, 908, 1198}, {3404, 2225, 958}, {2261, 1161, 456}, {4095, 1149, 1182}, {3655, 1484, 611},
+             {4095, 2225, 122}, {4095, 2113, 0}, {2726, 852, 691}, {4095, 941, 861}, {3677, 1406, 171}, {3565, 1390, 74}}, {
+             {0, 0, 0}, {1341, 335, 0}, {784, 321, 0}, {1134, 278, 0}, {874, 201, 0}, {951, 175, 0},
+             {904, 376, 0}, {831, 201, 0}, {845, 227, 0}, {872, 145, 0}, {938, 266, 0}, {1048, 338, 0},
+             {999, 261, 0}, {999, 232, 0}, {845, 255, 65}, {0, 0, 48}, {0, 0, 211}, {0, 0, 211},
+             {0, 0, 307}, {0, 0, 204}, {0, 0, 213}, {0, 0, 256}, {0, 0, 181}, {0, 0, 242},
+             {0, 0, 239}, {0, 39, 239}, {0, 0, 256}, {0, 16, 227}, {0, 0, 227}, {0, 0, 258},
+             {48, 8, 126}, {831, 276, 2}, {802, 436, 145}, {1015, 312, 7}, {841, 503, 78}, {841, 539, 58},
+             {1015, 546, 70}, {960, 356, 0}, {975, 676, 0}, {684, 341, 80}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {951, 341, 0}, {2350, 588, 61}, {2617, 884, 0},
+             {2196, 908, 0}, {2207, 908, 0}, {2261, 994, 0}, {2261, 959, 0}, {2679, 636, 0}, {2453, 1173, 0},
+             {2119, 828, 0}, {2350, 852, 0}, {2437, 588, 0}, {2785, 941, 0}, {2699, 706, 0}, {2516, 687, 0}}, {
+             {2016, 1007, 434}, {2839, 1007, 434}, {3039, 912, 294}, {2466, 697, 361}, {2747, 1517, 316}, {2656, 688, 248},
+             {2617, 1056, 350}, {2806, 1221, 263}, {3073, 1590, 205}, {3107, 1590, 221}, {3107, 1315, 206}, {2774, 1480, 570},
+             {2466, 1121, 374}, {2711, 1349, 302}, {2349, 792, 493}, {2349, 626, 1399}, {106, 209, 1065}, {98, 335, 1152},
+             {159, 259, 1082}, {130, 138, 634}, {49, 144, 935}, {85, 97, 947}, {104, 88, 828}, {170, 363, 1262},
+             {106, 363, 1135}, {139, 198, 1482}, {231, 174, 1243}, {231, 267, 1243}, {124, 141, 875}, {176, 285, 1261},
+             {1500, 845, 381}, {2384, 1699, 494}, {2779, 1760, 792}, {2326, 1228, 907}, {2711, 1534, 860}, {2035, 1059, 280},
+             {2248, 1421, 723}, {2317, 1746, 723}, {2776, 1843, 837}, {2437, 1304, 616}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1972, 1134}, {4095, 1835, 1134}, {4095, 2402, 1006},
+             {4095, 1711, 1198}, {4095, 2354, 1198}, {4079, 2225, 958}, {4095, 2129, 1182}, {4095, 2386, 1182}, {4095, 2225, 1006},
+             {4095, 2386, 958}, {4095, 2434, 1086}, {4095, 1455, 861}, {4095, 2183, 861}, {4095, 2402, 586}, {4095, 2441, 568}}, {
+             0xaa1978a7, 0x4a68b020, 0xf70fe513, 0xa571b976, 0x554ca055, 0x9ec08a20, 0x15997105, 0xea128377,
+             0x958aae8d, 0xb554722a, 0x8689f357, 0xa2e689d5, 0x0e065be8, 0xe9fdf628, 0xb55c24e4, 0x309b4d5f,
+             0xf82a3bbd, 0xea168bd5, 0x0ef6dd7a, 0x0d0342da, 0x485ea122, 0xf353f958, 0x3d9b3333, 0xded80fb6,
+             0xc3194cab, 0x349fe4d6, 0x23b617ab, 0xbaaa74b8, 0x51b8907e, 0xcb2d50ff, 0xd7e20fce, 0x169ac8f4,
+             0xb9eebed7, 0xef87dbec, 0xdf088f55, 0x8137e7ce, 0x834e2c9c, 0x821e03ed, 0x1cf2af4b, 0x326c3257,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xd12456d5, 0x2e9aa859, 0x2866ce46,
+             0xa5ee1920, 0x4277c185, 0x756d8e72, 0xefd52ef7, 0x89fd9f8c, 0x9487a59d, 0x9184eb0f, 0x78e62a2f,
+             0xff4234fb, 0xb4e78037, 0xd79cf3c1, 0xae49a6c8}},
+        {"FIREPLACE", 563557, {17632, 7148, 2753}, 46.28f, {
+             {0, 0, 0}, {1277, 413, 38}, {1125, 355, 33}, {814, 243, 24}, {734, 215, 22}, {944, 289, 28},
+             {1263, 407, 37}, {1267, 409, 37}, {1018, 315, 30}, {936, 286, 27}, {1173, 373, 34}, {1492, 496, 44},
+             {1422, 469, 42}, {1050, 327, 31}, {856, 257, 25}, {985, 303, 29}, {12, 50, 393}, {11, 48, 383},
+             {9, 36, 299}, {8, 30, 256}, {9, 37, 306}, {12, 51, 402}, {12, 54, 419}, {10, 41, 341},
+             {9, 34, 290}, {10, 40, 333}, {13, 55, 426}, {12, 57, 440}, {10, 44, 352}, {8, 34, 287},
+             {10, 39, 317}, {1271, 631, 169}, {1335, 669, 178}, {1042, 499, 139}, {809, 370, 108}, {881, 409, 117},
+             {1167, 570, 156}, {1277, 634, 170}, {1039, 497, 139}, {830, 382, 111}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1103, 515, 141}, {3009, 1249, 242}, {3294, 1389, 265},
+             {2575, 1040, 207}, {1818, 693, 146}, {1784, 678, 143}, {2403, 960, 193}, {2883, 1188, 232}, {2512, 1011, 202},
+             {1979, 765, 159}, {2111, 825, 170}, {2981, 1235, 240}, {3690, 1589, 297}, {3242, 1364, 261}, {2402, 959, 193}}, {
+             {0, 0, 0}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22},
+             {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22},
+             {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {7, 28, 29}, {7, 28, 246}, {7, 28, 246},
+             {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246},
+             {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246},
+             {9, 38, 98}, {734, 330, 98}, {734, 330, 98}, {734, 330, 98}, {734, 330, 98}, {734, 330, 98},
+             {734, 330, 98}, {734, 330, 98}, {734, 330, 98}, {734, 330, 98}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1103, 515, 134}, {1669, 628, 134}, {1669, 628, 134},
+             {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134},
+             {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}}, {
+             {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45},
+             {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45},
+             {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1352, 437, 483}, {14, 64, 483}, {14, 64, 483},
+             {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483},
+             {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483},
+             {1548, 798, 419}, {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206},
+             {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3701, 1594, 298}, {3701, 1594, 298}, {3701, 1594, 298},
+             {3701, 1594, 298}, {3701, 1594, 298}, {3701, 1594, 298}, {3701, 1594, 298}, {3701, 1594, 298}, {3701, 1594, 298},
+             {3701, 1594, 298}, {3701, 1594, 298}, {3701, 1594, 298}, {3701, 1594, 298}, {3701, 1594, 298}, {3701, 1594, 298}}, {
+             0x71b64246, 0x431ab647, 0x0f41b623, 0x99162b6e, 0xad124e54, 0x88b60e1f, 0xb8e9721f, 0x7fd33745,
+             0xc2923211, 0x07c1c4fc, 0xc472594a, 0x0d4a893a, 0x87d2a647, 0xa7651bb0, 0xb7621bb9, 0x781b9499,
+             0x2ee15ca6, 0x8103cf9b, 0x1ecd5c43, 0x55f7244e, 0x39ac4a8d, 0x1107a776, 0xaff9f937, 0x8256762e,
+             0x6d17101f, 0xa48ce5cd, 0x447c2014, 0x38ad90e7, 0x6a46e986, 0x37f243ea, 0x335846a1, 0xc5607b67,
+             0x1d19e898, 0xd2ee2223, 0xc1dc504b, 0xa1117f8a, 0xf42f32e1, 0x456073fa, 0x2cfcfd5c, 0x134ea01c,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x2d5b0996, 0xa849dd4e, 0xaa58f795,
+             0x317fec59, 0x2f28de82, 0xfb1f3158, 0x2d38de9e, 0x3a392f9f, 0xd9e09e67, 0x59d1efd0, 0x298e490e,
+             0x7cdd9506, 0xd408e426, 0xae0b7c05, 0xb837968d}},
+        {"RAINBOW", 82920, {27160, 12072, 6157}, 64.35f, {
+             {0, 0, 0}, {1703, 537, 119}, {1653, 646, 85}, {1670, 537, 194}, {1594, 646, 105}, {1627, 537, 194},
+             {1594, 646, 108}, {1664, 537, 194}, {1645, 646, 85}, {1703, 537, 128}, {1703, 579, 85}, {1703, 626, 85},
+             {1703, 537, 171}, {1611, 646, 85}, {1642, 537, 194}, {1702, 537, 95}, {24, 114, 616}, {65, 72, 632},
+             {23, 114, 642}, {52, 72, 658}, {23, 83, 658}, {23, 94, 658}, {62, 72, 658}, {23, 114, 634},
+             {65, 72, 627}, {26, 114, 616}, {65, 72, 621}, {23, 114, 623}, {65, 72, 646}, {23, 112, 658},
+             {69, 102, 617}, {1703, 892, 288}, {1703, 811, 347}, {1613, 920, 288}, {1661, 811, 397}, {1594, 920, 329},
+             {1640, 811, 397}, {1594, 920, 309}, {1700, 811, 397}, {1667, 920, 288}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1817, 885, 429}, {3833, 1902, 533}, {3970, 1640, 706},
+             {3874, 1902, 444}, {4095, 1640, 618}, {4095, 1848, 444}, {4095, 1779, 444}, {4095, 1640, 555}, {3924, 1902, 444},
+             {4004, 1640, 706}, {3833, 1902, 521}, {3927, 1640, 706}, {3833, 1902, 499}, {4044, 1640, 706}, {3979, 1902, 444}}, {
+             {0, 0, 0}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85},
+             {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85},
+             {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {23, 72, 95}, {23, 72, 616}, {23, 72, 616},
+             {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616},
+             {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616},
+             {69, 102, 288}, {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288},
+             {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1817, 885, 429}, {3833, 1640, 444}, {3833, 1640, 444},
+             {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444},
+             {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}}, {
+             {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194},
+             {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194},
+             {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1702, 537, 658}, {65, 114, 658}, {65, 114, 658},
+             {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658},
+             {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658},
+             {1703, 920, 640}, {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397},
+             {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706},
+             {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706},
+             {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}}, {
+             0xe8cca09d, 0x75640432, 0x5785387b, 0x2c6bacfa, 0xf7d305c0, 0x5dcb8c46, 0x9c90579f, 0xb83fe5d9,
+             0xd4ab48ae, 0xec460e54, 0x6400254d, 0xb56d8e3b, 0xd5c80424, 0x3328b667, 0x79ae9a66, 0x536ed17e,
+             0x59c8d337, 0x8c9bb994, 0xa4ff2f37, 0xef1328cb, 0xf492f998, 0xdc3c8534, 0xac5830b6, 0x1054871d,
+             0x3389606f, 0x4d371b1e, 0xbad169ff, 0x23ff53f1, 0xbddb6d09, 0xfa21171c, 0x8b69e599, 0x09fe22a0,
+             0x3e0b8160, 0x56d3ac1a, 0x1f9556f7, 0x8994c176, 0xa889729e, 0x1be8bcb6, 0xa9f6cdfc, 0xe3996fcf,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x52e728ce, 0xd954e05f, 0x85ed4159,
+             0xcbda4f03, 0xcf942a96, 0x366f7978, 0xebecbdf0, 0x1481b40d, 0xd683f637, 0x6fdc991f, 0xac4cf9c3,
+             0x6ed9c335, 0x53d78cb3, 0xd4656451, 0x429cd8f8}},
+        {"COLOR_STEPS", 4030, {27051, 11537, 5256}, 60.66f, {
+             {0, 0, 0}, {1703, 483, 48}, {1703, 562, 86}, {1703, 728, 0}, {1608, 753, 126}, {1703, 742, 172},
+             {1531, 746, 0}, {1536, 578, 0}, {1599, 457, 0}, {1703, 673, 155}, {1703, 658, 0}, {1703, 678, 60},
+             {1703, 712, 166}, {1703, 382, 243}, {1647, 424, 184}, {1616, 682, 79}, {0, 87, 658}, {57, 22, 658},
+             {36, 93, 658}, {78, 126, 648}, {27, 93, 613}, {81, 99, 658}, {12, 92, 658}, {31, 34, 658},
+             {53, 127, 634}, {10, 123, 658}, {15, 16, 658}, {16, 81, 658}, {0, 17, 658}, {2, 27, 658},
+             {3, 93, 679}, {1595, 701, 102}, {1703, 865, 171}, {1635, 955, 119}, {1703, 921, 183}, {1703, 739, 251},
+             {1703, 654, 432}, {1609, 966, 144}, {1635, 801, 323}, {1679, 740, 377}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 777, 217}, {4095, 2110, 591}, {4095, 1530, 676},
+             {4095, 1914, 67}, {4054, 1883, 0}, {3913, 1796, 785}, {3961, 1695, 661}, {4095, 1950, 281}, {4057, 1602, 703},
+             {3821, 2169, 299}, {3724, 1911, 729}, {3747, 1695, 95}, {3673, 1804, 699}, {4095, 1792, 798}, {4095, 1862, 186}}, {
+             {0, 0, 0}, {1505, 354, 0}, {1508, 360, 0}, {1510, 363, 0}, {1517, 357, 0}, {1507, 367, 0},
+             {1505, 355, 0}, {1513, 366, 0}, {1507, 354, 0}, {1505, 360, 0}, {1503, 366, 0}, {1509, 362, 0},
+             {1503, 366, 0}, {1513, 358, 0}, {1507, 353, 0}, {0, 0, 68}, {0, 0, 583}, {0, 0, 582},
+             {0, 0, 581}, {0, 0, 583}, {0, 0, 580}, {0, 0, 583}, {0, 0, 581}, {0, 0, 583},
+             {0, 0, 581}, {0, 0, 584}, {0, 0, 582}, {0, 0, 588}, {0, 0, 586}, {0, 0, 581},
+             {3, 93, 84}, {1508, 651, 87}, {1506, 661, 87}, {1506, 658, 84}, {1505, 656, 87}, {1541, 655, 87},
+             {1513, 654, 101}, {1504, 656, 92}, {1513, 657, 88}, {1520, 653, 98}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 777, 0}, {3616, 1254, 0}, {3623, 1244, 0},
+             {3633, 1243, 0}, {3626, 1244, 0}, {3636, 1230, 0}, {3653, 1249, 0}, {3615, 1230, 0}, {3636, 1236, 0},
+             {3620, 1242, 0}, {3716, 1234, 0}, {3617, 1245, 0}, {3645, 1233, 0}, {3647, 1258, 0}, {3635, 1230, 0}}, {
+             {1703, 745, 257}, {1703, 752, 260}, {1703, 751, 260}, {1703, 742, 262}, {1703, 753, 256}, {1703, 753, 234},
+             {1703, 748, 258}, {1703, 753, 260}, {1703, 748, 258}, {1703, 746, 261}, {1703, 743, 252}, {1703, 753, 261},
+             {1703, 754, 262}, {1703, 753, 243}, {1703, 749, 263}, {1616, 682, 726}, {89, 141, 658}, {90, 145, 658},
+             {90, 143, 658}, {90, 144, 658}, {83, 140, 658}, {91, 142, 658}, {91, 144, 658}, {91, 144, 658},
+             {90, 144, 658}, {83, 138, 658}, {90, 142, 658}, {88, 144, 658}, {91, 144, 658}, {91, 131, 658},
+             {1703, 1050, 1703}, {1703, 1044, 484}, {1703, 1030, 471}, {1703, 1049, 483}, {1703, 1040, 484}, {1703, 1044, 480},
+             {1703, 1045, 484}, {1703, 1041, 477}, {1703, 1046, 481}, {1703, 1048, 475}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 2174, 888}, {4095, 2183, 893}, {4095, 2187, 864},
+             {4095, 2182, 892}, {4095, 2160, 886}, {4095, 2192, 878}, {4095, 2185, 887}, {4095, 2190, 866}, {4095, 2158, 889},
+             {4095, 2191, 871}, {4095, 2191, 886}, {4095, 2175, 888}, {4095, 2190, 885}, {4095, 2192, 892}, {4095, 2192, 874}}, {
+             0x15030071, 0xb98756cc, 0x3757c604, 0xd03f977f, 0x04d84c62, 0x0474c252, 0x1ecaefc8, 0x9abd11d0,
+             0x7222085e, 0x29bb451b, 0xb042259c, 0xd1e6ea38, 0x99561013, 0x63903daf, 0x2811a54d, 0x76ec59f0,
+             0x70b1e31c, 0xa5d977ea, 0x3f16523e, 0xd7a2d983, 0xc4a4f31d, 0x16e91972, 0x05dd3d6f, 0x87bcde57,
+             0x2ef0d762, 0xb8a548dd, 0xfdeb174e, 0x9b1a4c15, 0x1ed01185, 0x50b7a927, 0x6be6ca3d, 0xfc2ff538,
+             0x0eb0a6d4, 0xbd14b5df, 0x87eebcea, 0x0a654c9c, 0xd158f043, 0x030c3e7f, 0xa764b951, 0x3b79e4ef,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x7699bd4f, 0x9fd76760, 0x2fb5e44a,
+             0x1a8467f2, 0x9a0730b9, 0x00e130cb, 0xad851d03, 0x4a2da735, 0x7fb4a0e6, 0xa6f3bc0e, 0x226a3881,
+             0x9017c5d5, 0x85209bc7, 0x70233a69, 0xf1e1deb9}},
+        {"BROKEN_ELECTRICITY", 6531, {27433, 11474, 5248}, 39.41f, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {0, 0, 0}, {127, 41, 4}, {350, 114, 13}, {130, 42, 4}, {279, 90, 10}, {94, 30, 3},
+             {0, 0, 0}, {228, 74, 8}, {215, 70, 8}, {195, 63, 7}, {208, 67, 7}, {0, 0, 0},
+             {127, 41, 4}, {531, 173, 19}, {208, 67, 7}, {0, 0, 0}, {1, 6, 63}, {1, 5, 52},
+             {2, 10, 98}, {1, 8, 82}, {1, 4, 44}, {1, 5, 52}, {1, 8, 85}, {1, 6, 65},
+             {1, 8, 78}, {1, 8, 85}, {2, 10, 106}, {1, 7, 73}, {4, 21, 207}, {2, 11, 112},
+             {14, 67, 23}, {382, 191, 63}, {94, 47, 15}, {142, 71, 23}, {113, 56, 18}, {126, 63, 21},
+             {363, 181, 60}, {114, 57, 19}, {0, 0, 0}, {154, 77, 25}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {620, 259, 62}, {445, 186, 44}, {203, 85, 20},
+             {646, 270, 65}, {780, 326, 78}, {0, 0, 0}, {0, 0, 0}, {797, 333, 80}, {0, 0, 0},
+             {207, 86, 20}, {332, 138, 33}, {423, 177, 42}, {213, 89, 21}, {215, 89, 21}, {780, 326, 78}}, {
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {4095, 2131, 241}, {4095, 2131, 241},
+             {4095, 2131, 241}, {4095, 2131, 241}, {1703, 554, 63}, {1703, 554, 63}, {4095, 2131, 241}, {4095, 2131, 241},
+             {4095, 2131, 241}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 1996}, {68, 327, 1996}, {14, 67, 658},
+             {14, 67, 658}, {68, 327, 1996}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {68, 327, 1996}, {14, 67, 658}, {14, 67, 658}, {68, 327, 1996},
+             {4095, 3276, 1092}, {4095, 3276, 1092}, {1703, 852, 284}, {4095, 3276, 1092}, {1703, 852, 284}, {1703, 852, 284},
+             {4095, 3276, 1092}, {4095, 3276, 1092}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 2738, 658}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 2738, 658}, {4095, 2738, 658}, {4095, 2738, 658}, {4095, 2738, 658}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0x9a88fecf, 0xa9d5998e, 0x967ba1c1, 0x801e38b2, 0x56bb4e1a, 0x786cd4e7, 0xfd0be483, 0x211037a4,
+             0x5fc3eaf7, 0xe8e747d3, 0x7d3b12c4, 0x40be7673, 0x395cef80, 0xa7cc81dc, 0xda19785f, 0x4e4a24cd,
+             0xe52955c8, 0x536ccd8e, 0xe4c2f77f, 0x6a6d2bbf, 0x7f12ac4a, 0x0d0b13ae, 0x57952227, 0x07c4c348,
+             0x1b9e3d7f, 0x5c5cd9ce, 0xff9d3dfb, 0xd160df31, 0x7e05843c, 0x7824c947, 0x13e29b07, 0x5fa696d2,
+             0x8e0b984f, 0xabf0c72c, 0xd1bb8075, 0x7174ec0a, 0xe237c465, 0xd38433b0, 0x08cbcb23, 0x3e617e48,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xd11fe0a5, 0x374ca0be, 0x7c4ed055,
+             0x669f1acf, 0x495e2498, 0x7ba00ff4, 0xa8bc09cf, 0xc4e8f79a, 0x391e6a28, 0xe6e472d7, 0xdbcb0577,
+             0x4bbbe3c1, 0xc9b2711a, 0x0021428d, 0x8b6fbf90}},
+        {"BREATHING", 899080, {11266, 4750, 2170}, 35.05f, {
+             {0, 0, 0}, {73, 23, 3}, {321, 104, 13}, {1532, 506, 46}, {1096, 360, 35}, {144, 46, 6},
+             {118, 38, 5}, {961, 315, 32}, {1614, 534, 47}, {398, 129, 15}, {70, 23, 3}, {426, 138, 16},
+             {1635, 541, 48}, {917, 301, 31}, {111, 36, 5}, {155, 50, 7}, {13, 48, 454}, {18, 63, 582},
+             {2, 14, 140}, {0, 4, 45}, {5, 25, 239}, {22, 71, 649}, {7, 33, 311}, {0, 5, 52},
+             {1, 10, 103}, {16, 55, 515}, {16, 57, 530}, {1, 11, 109}, {0, 5, 50}, {7, 31, 296},
+             {25, 73, 652}, {592, 296, 98}, {77, 39, 13}, {277, 139, 47}, {1466, 740, 234}, {1186, 597, 192},
+             {166, 84, 29}, {105, 53, 18}, {872, 438, 143}, {1655, 837, 263}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {136, 67, 22}, {256, 106, 27}, {2447, 1030, 235},
+             {3740, 1583, 349}, {737, 308, 76}, {123, 51, 13}, {1069, 447, 108}, {4010, 1699, 372}, {1908, 801, 187},
+             {180, 75, 19}, {352, 146, 37}, {2890, 1219, 275}, {3408, 1441, 320}, {535, 223, 56}, {138, 57, 15}}, {
+             {0, 0, 0}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3},
+             {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3},
+             {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {0, 4, 6}, {0, 4, 43}, {0, 4, 43},
+             {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43},
+             {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43},
+             {25, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12},
+             {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13},
+             {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13},
+             {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}}, {
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49},
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49},
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {155, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {1703, 862, 673}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270},
+             {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379},
+             {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379},
+             {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}}, {
+             0x24199313, 0x276ce2a9, 0xc17afb35, 0xda5e430e, 0x6847b317, 0xd3232ace, 0xef1f06ea, 0x3b514415,
+             0x780515a5, 0xef641b17, 0xdbf4abb7, 0xe2d996cb, 0x70909691, 0x803b73ac, 0x4ded519f, 0x299bb69d,
+             0x06a5b923, 0x4285c387, 0x20f41735, 0x6a08cb03, 0xf432e48b, 0x2bf9aeeb, 0x7de27f00, 0x302b6f02,
+             0x43600b90, 0x2e1ca206, 0x5c49370c, 0x58d00b14, 0xaab2bdfa, 0x4201fdf9, 0x56599b73, 0x87d6b7b9,
+             0xe2a65bce, 0xfebb4d90, 0xcad15415, 0x12c03e69, 0x66a393c0, 0x67c33888, 0x9cedce9c, 0x5d9016af,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xc01905c8, 0x944cb9ad, 0x479cd881,
+             0xce4295e7, 0x60aabaa7, 0x2b75bca8, 0xb91ab16b, 0xff0d3a52, 0x6a636f4e, 0x2cca5fa1, 0xfae95d6c,
+             0x18bc5850, 0x168ea4e4, 0x4dd1db64, 0xbf11503f}},
+        {"AUTO_CYCLE", 154251, {24769, 10537, 5301}, 33.54f, {
+             {0, 0, 0}, {2016, 1007, 434}, {2839, 912, 294}, {2320, 697, 106}, {1285, 418, 27}, {1700, 387, 105},
+             {1703, 733, 188}, {1703, 360, 0}, {1613, 553, 42}, {577, 188, 21}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 488, 95}, {1703, 525, 94}, {1683, 604, 0}, {0, 89, 658}, {43, 72, 658},
+             {23, 114, 650}, {65, 72, 638}, {23, 114, 618}, {65, 72, 623}, {23, 114, 628}, {65, 72, 653},
+             {172, 0, 1018}, {39, 74, 286}, {55, 0, 265}, {17, 102, 616}, {65, 0, 658}, {0, 255, 1259},
+             {0, 43, 315}, {704, 447, 133}, {1536, 591, 0}, {1703, 727, 340}, {1440, 727, 231}, {1217, 613, 196},
+             {175, 87, 30}, {1639, 866, 260}, {1674, 918, 244}, {1703, 873, 351}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 928, 308}, {4095, 1606, 294}, {4095, 1566, 567},
+             {2225, 982, 202}, {4095, 1765, 444}, {4095, 1861, 444}, {4095, 1640, 629}, {3865, 1902, 444}, {4095, 1724, 13},
+             {4036, 1768, 149}, {4027, 2072, 407}, {3934, 1869, 571}, {4095, 1711, 412}, {4095, 1711, 412}, {3962, 1656, 398}}, {
+             {0, 0, 0}, {1341, 335, 0}, {784, 321, 0}, {1134, 278, 0}, {874, 280, 0}, {1505, 356, 0},
+             {1504, 357, 0}, {1507, 360, 0}, {521, 170, 0}, {521, 170, 19}, {99, 32, 3}, {107, 34, 4},
+             {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {0, 41, 0}, {0, 41, 616}, {23, 72, 616},
+             {23, 72, 616}, {23, 72, 616}, {0, 4, 43}, {23, 72, 616}, {23, 72, 616}, {0, 0, 210},
+             {0, 0, 233}, {0, 0, 265}, {0, 0, 265}, {0, 0, 581}, {0, 0, 587}, {0, 27, 239},
+             {0, 43, 0}, {704, 447, 0}, {1232, 591, 0}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12},
+             {70, 35, 12}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1152, 481, 116}, {3934, 1551, 251}, {2225, 901, 166},
+             {1364, 522, 84}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3645, 1266, 73}, {3631, 1233, 0},
+             {3624, 1243, 0}, {3622, 1238, 0}, {3934, 1551, 251}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}}, {
+             {2016, 1007, 434}, {2839, 1007, 434}, {3039, 912, 294}, {2466, 697, 361}, {2747, 1517, 316}, {1703, 754, 261},
+             {1703, 741, 248}, {1703, 750, 262}, {3971, 1291, 261}, {3971, 1291, 146}, {4095, 2131, 241}, {1703, 554, 63},
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1683, 605, 658}, {65, 114, 658}, {65, 114, 658},
+             {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {224, 288, 1206},
+             {172, 255, 1100}, {56, 265, 1189}, {67, 177, 1164}, {88, 144, 658}, {155, 255, 1440}, {260, 352, 1260},
+             {2774, 1676, 669}, {2378, 1336, 631}, {1703, 1015, 474}, {1703, 1046, 481}, {1703, 862, 270}, {1703, 862, 270},
+             {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572},
+             {4095, 1902, 505}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 2186, 861}, {4095, 2186, 886},
+             {4095, 2101, 844}, {4095, 2175, 865}, {4095, 1872, 572}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0xaa1978a7, 0x4a68b020, 0xf70fe513, 0xa571b976, 0x18aa4ca8, 0x6d1479ec, 0xf801056f, 0x9f41ab66,
+             0x8ebf9216, 0x43c00a56, 0x3507c8c5, 0x5b041ecd, 0x6b9bffbf, 0xfb1164bb, 0xe8a78052, 0x18ccd0dd,
+             0xa5779c2b, 0x4a88cab3, 0x046ba639, 0x46b4362c, 0x54744bc0, 0x13cf3d15, 0x7bfc407f, 0x53777222,
+             0x5ac2f70a, 0x9c7af2d8, 0x092db810, 0xc182e57b, 0x9ac30d1e, 0x094f6827, 0x33057bfd, 0x7c3ba788,
+             0x1cad1cc8, 0xe21783c8, 0x547661ac, 0x851c41b4, 0xa935a2d7, 0xa3272911, 0x3bd0df6b, 0xb08b5b0f,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x89cf3491, 0xffd7cc54, 0x0b063efa,
+             0x9ed26b1f, 0xd1f14bcf, 0x114b2301, 0x4bdb2127, 0x7bc2e323, 0x50dd4aba, 0x64d75b76, 0x438ebdae,
+             0x2084726c, 0x13ac4f7e, 0xe883be90, 0x53e288e0}},
+        {"LAYERED", 885946, {9992, 4053, 1615}, 48.22f, {
+             {0, 0, 0}, {304, 98, 9}, {481, 152, 14}, {768, 229, 23}, {579, 170, 17}, {298, 91, 9},
+             {356, 115, 11}, {918, 296, 27}, {987, 306, 29}, {446, 137, 13}, {280, 89, 8}, {710, 236, 21},
+             {1388, 458, 41}, {747, 233, 22}, {250, 75, 7}, {317, 98, 9}, {9, 40, 320}, {10, 45, 359},
+             {4, 16, 140}, {2, 9, 80}, {5, 21, 181}, {12, 50, 401}, {8, 35, 277}, {3, 13, 105},
+             {3, 14, 120}, {9, 35, 292}, {11, 49, 378}, {5, 22, 175}, {3, 13, 107}, {5, 23, 190},
+             {10, 39, 317}, {716, 356, 96}, {321, 161, 43}, {421, 202, 56}, {744, 341, 99}, {721, 335, 96},
+             {378, 185, 50}, {344, 171, 46}, {720, 344, 96}, {817, 376, 109}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {325, 151, 41}, {807, 335, 65}, {2454, 1035, 197},
+             {2442, 987, 196}, {773, 295, 62}, {402, 153, 32}, {1186, 474, 95}, {2848, 1173, 229}, {1649, 663, 133},
+             {494, 191, 40}, {660, 258, 53}, {2439, 1011, 196}, {3312, 1426, 266}, {1154, 485, 93}, {538, 215, 43}}, {
+             {0, 0, 0}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {200, 59, 6},
+             {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5},
+             {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {2, 9, 9}, {2, 9, 78}, {2, 9, 78},
+             {2, 9, 78}, {2, 9, 78}, {2, 9, 78}, {2, 9, 78}, {2, 9, 78}, {2, 9, 78},
+             {2, 9, 78}, {2, 9, 78}, {2, 9, 78}, {2, 9, 79}, {2, 9, 78}, {2, 9, 78},
+             {9, 38, 26}, {195, 88, 26}, {195, 88, 26}, {195, 88, 26}, {195, 88, 26}, {195, 88, 26},
+             {195, 88, 26}, {195, 88, 26}, {195, 88, 26}, {195, 88, 26}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {325, 147, 31}, {389, 147, 31}, {389, 147, 31},
+             {389, 147, 31}, {389, 147, 31}, {400, 152, 32}, {389, 147, 31}, {389, 147, 31}, {389, 147, 31},
+             {389, 146, 31}, {389, 147, 31}, {389, 147, 31}, {389, 147, 31}, {389, 147, 31}, {389, 146, 31}}, {
+             {1495, 499, 44}, {1495, 499, 44}, {1495, 499, 44}, {1495, 499, 44}, {1495, 498, 44}, {1495, 499, 44},
+             {1495, 498, 44}, {1495, 499, 44}, {1495, 499, 44}, {1495, 498, 44}, {1495, 499, 44}, {1495, 498, 44},
+             {1495, 499, 44}, {1495, 499, 44}, {1495, 498, 44}, {384, 124, 468}, {14, 60, 457}, {14, 62, 468},
+             {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468},
+             {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468},
+             {1495, 767, 418}, {1495, 767, 199}, {1495, 766, 199}, {1495, 767, 199}, {1495, 766, 199}, {1495, 767, 199},
+             {1495, 767, 199}, {1495, 766, 199}, {1460, 745, 195}, {1495, 767, 199}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3567, 1528, 287}, {3568, 1529, 287}, {3567, 1529, 287},
+             {3567, 1529, 287}, {3568, 1529, 287}, {3567, 1528, 287}, {3568, 1529, 287}, {3567, 1529, 287}, {3567, 1529, 287},
+             {3567, 1529, 287}, {3567, 1528, 287}, {3568, 1529, 287}, {3567, 1528, 287}, {3567, 1529, 287}, {3567, 1529, 287}}, {
+             0xd2d6bd53, 0xa20c9854, 0xbc807570, 0x63940383, 0x693eb2d7, 0x98063b78, 0x386ba371, 0x4d200398,
+             0xa30de822, 0x32048b8c, 0xe8b8c163, 0xea6950c4, 0x0caf58ec, 0x3088412e, 0x3895c36e, 0xdfbf481a,
+             0x821bd243, 0x0e53979b, 0x73ef2395, 0xf2a4afa8, 0x2c552a3e, 0x76c0d1a4, 0xee926f7b, 0xceceb755,
+             0x053dab50, 0xdb865153, 0x3b75f94b, 0x44af2579, 0x0262f447, 0x950263e2, 0x51e40095, 0xaf11359e,
+             0x4360abf1, 0x998680b2, 0x03d92e6d, 0x1e0ab5ea, 0xdeace484, 0x468efbf3, 0x958a8268, 0xd92cfd56,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x37fbc80c, 0x48b9e579, 0x114ddc08,
+             0x5d6e0918, 0x05bd443a, 0xf6564853, 0xd49bcfe0, 0xebbd0ecf, 0x0516a567, 0x983e32df, 0x3bbea601,
+             0x58e4b126, 0x6a68c552, 0xf20a2fae, 0x9c79e199}},
+        {"PROGRAM", 899127, {11267, 4750, 2170}, 32.37f, {
+             {0, 0, 0}, {73, 23, 3}, {322, 104, 13}, {1532, 506, 46}, {1096, 360, 35}, {145, 46, 6},
+             {119, 38, 5}, {961, 315, 32}, {1614, 534, 47}, {399, 129, 15}, {71, 23, 3}, {427, 138, 16},
+             {1635, 541, 48}, {918, 301, 31}, {112, 36, 5}, {155, 50, 7}, {13, 48, 454}, {18, 63, 582},
+             {3, 14, 141}, {1, 4, 45}, {5, 25, 240}, {22, 71, 649}, {8, 33, 312}, {1, 5, 52},
+             {2, 10, 103}, {16, 55, 515}, {16, 57, 530}, {2, 11, 110}, {1, 5, 50}, {7, 31, 296},
+             {25, 73, 652}, {592, 296, 98}, {77, 39, 14}, {278, 139, 47}, {1466, 740, 235}, {1186, 597, 192},
+             {167, 84, 29}, {105, 53, 18}, {872, 438, 143}, {1655, 837, 263}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {136, 67, 23}, {256, 107, 28}, {2447, 1030, 235},
+             {3740, 1583, 349}, {737, 308, 76}, {124, 52, 14}, {1069, 447, 108}, {4010, 1699, 372}, {1908, 801, 187},
+             {180, 75, 20}, {352, 147, 37}, {2890, 1219, 275}, {3408, 1441, 320}, {535, 223, 56}, {138, 58, 15}}, {
+             {0, 0, 0}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3},
+             {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3},
+             {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {0, 4, 6}, {0, 4, 43}, {0, 4, 43},
+             {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43},
+             {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43},
+             {25, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12},
+             {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13},
+             {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13},
+             {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}}, {
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49},
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49},
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {155, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {1703, 862, 673}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270},
+             {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379},
+             {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379},
+             {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}}, {
+             0xe386e169, 0x0e74b6f9, 0xab868be5, 0x2de0822c, 0x072939b1, 0xe444bc88, 0x5ddb829d, 0x9488bc30,
+             0xf1faddbb, 0xfa1c2370, 0xb6925d9b, 0xb8b0c8cb, 0xfc3ce6cf, 0x255373da, 0xaeb96081, 0xd547e84b,
+             0x6196a6e0, 0xfde450e0, 0x76065fe2, 0xc52eb9c9, 0x076c7f53, 0x167bee41, 0x5d609a7d, 0x7cf85fb6,
+             0x9189ab8d, 0xe8f3a682, 0x3a12759e, 0xbce06cc6, 0x5128b6d0, 0xbb88b814, 0xfd2a0856, 0xd09c1647,
+             0xc920263c, 0xded14d47, 0x876c3a36, 0xe463db7f, 0x1f070fe4, 0x3f86841a, 0x71ea9a05, 0x1fd99f6f,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x1718cd3c, 0xec059f82, 0x411e8bde,
+             0x22c8dc5d, 0xa6214635, 0x50a02768, 0x861c42f9, 0xfd96ae25, 0x9c4bd326, 0xe32473b4, 0x936974be,
+             0xc45f272f, 0x81b2715e, 0xbd8de206, 0x035b03b5}},
+        {"KEYFRAMES", 558, {27790, 11599, 5287}, 41.48f, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1697, 552, 65}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {33, 77, 663}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 65}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {33, 77, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1697, 552, 664}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {1703, 852, 681}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0x0c15ca65, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xb4a4ea49,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xfceb61e6, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x7c75efa5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5}},
+        {"RESET_BLINK", 42915, {27899, 10860, 5203}, 34.72f, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1394, 0, 0},
+             {1374, 0, 0}, {1355, 0, 0}, {1335, 0, 0}, {1316, 0, 0}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {256, 0, 0},
+             {256, 0, 0}, {255, 0, 0}, {255, 0, 0}, {255, 0, 0}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {4090, 0, 0},
+             {4092, 0, 0}, {4093, 0, 0}, {4094, 0, 0}, {4095, 0, 0}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 664}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {1703, 852, 681}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0xa11df5e6, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xd1b94c29, 0x52c45435, 0x2dce072e,
+             0x60dd2571, 0x11d1fb62, 0x0f191ad3, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xe23c87ec,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x538c2775, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xbeb5a100, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5}},
+        {"EFFECT_BLINK", 238376, {27444, 11835, 6057}, 36.38f, {
+             {0, 0, 0}, {1637, 618, 118}, {1683, 588, 1}, {1703, 508, 74}, {1703, 495, 112}, {1353, 462, 0},
+             {678, 220, 25}, {2575, 837, 95}, {3829, 1245, 141}, {1451, 472, 53}, {521, 170, 19}, {1467, 477, 54},
+             {3838, 1248, 141}, {2553, 830, 94}, {672, 219, 25}, {780, 254, 29}, {23, 110, 1081}, {28, 136, 1326},
+             {10, 49, 481}, {5, 23, 232}, {30, 143, 1394}, {0, 106, 1050}, {64, 192, 1351}, {77, 174, 1386},
+             {7, 87, 1141}, {0, 50, 728}, {11, 47, 424}, {16, 37, 266}, {7, 26, 222}, {0, 21, 297},
+             {3, 37, 509}, {2277, 1175, 307}, {3398, 1831, 561}, {3882, 2003, 795}, {3433, 1651, 468}, {1394, 662, 239},
+             {770, 527, 249}, {2617, 1421, 251}, {2465, 1308, 639}, {2407, 817, 807}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1153, 824, 289}, {2806, 766, 491}, {3429, 976, 439},
+             {3597, 957, 0}, {3237, 1797, 549}, {3448, 1382, 118}, {3212, 1960, 0}, {3429, 801, 452}, {4095, 1968, 171},
+             {3421, 2338, 476}, {2201, 1400, 612}, {4095, 2129, 347}, {2491, 707, 144}, {3891, 1275, 238}, {3902, 1021, 58}}, {
+             {0, 0, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {249, 85, 0},
+             {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19},
+             {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {4, 23, 29}, {4, 23, 227}, {4, 23, 227},
+             {4, 23, 227}, {4, 23, 227}, {0, 26, 256}, {0, 69, 1050}, {0, 88, 1330}, {0, 75, 1141},
+             {0, 47, 728}, {0, 27, 422}, {0, 17, 266}, {0, 14, 218}, {0, 14, 219}, {0, 19, 297},
+             {3, 37, 177}, {2272, 1107, 294}, {3376, 1599, 459}, {3434, 1653, 469}, {2486, 1157, 329}, {256, 121, 36},
+             {770, 501, 14}, {840, 401, 115}, {935, 394, 244}, {951, 337, 0}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1153, 608, 182}, {2310, 766, 0}, {2431, 579, 0},
+             {2373, 755, 0}, {2769, 742, 0}, {2248, 947, 0}, {2437, 732, 0}, {2691, 682, 171}, {2466, 857, 0},
+             {2201, 1020, 0}, {2035, 1075, 0}, {2407, 638, 110}, {2491, 707, 26}, {2916, 958, 0}, {2341, 957, 0}}, {
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {3971, 1354, 146},
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146},
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {780, 254, 1440}, {31, 147, 1440}, {31, 147, 1440},
+             {31, 147, 1440}, {31, 147, 1440}, {87, 418, 4088}, {83, 192, 1369}, {87, 204, 1440}, {85, 197, 1411},
+             {67, 156, 1141}, {42, 102, 728}, {24, 60, 426}, {16, 38, 267}, {18, 42, 297}, {30, 68, 507},
+             {2277, 1172, 545}, {3397, 1831, 653}, {3955, 2137, 816}, {3971, 2141, 814}, {3502, 1877, 701}, {4088, 1942, 699},
+             {3073, 1421, 657}, {2617, 1421, 639}, {3031, 1568, 893}, {2407, 1206, 807}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1756, 717}, {4095, 2241, 1182}, {3597, 2418, 593},
+             {4095, 2225, 845}, {4095, 2514, 851}, {4095, 2241, 1006}, {4095, 2177, 1006}, {4095, 2370, 1080}, {4095, 2482, 1118},
+             {4095, 2338, 893}, {4095, 2129, 1006}, {4095, 2129, 1118}, {4095, 2514, 1063}, {4095, 2418, 909}, {4095, 2000, 689}}, {
+             0x5f0d55f1, 0x9c2aa7be, 0x0be5c023, 0xb059898a, 0xb19b7caf, 0x53eb5985, 0xf929a0f9, 0x0282a901,
+             0x545b4967, 0x97309868, 0x0bcd8796, 0xc996e052, 0x757cdbbc, 0xbd266c9d, 0x9ba1b915, 0xf17bfa33,
+             0xef9fd002, 0x4ebf9bce, 0x6f262c14, 0x75d4a667, 0xefc55ec1, 0x79fa93ca, 0x60fc1cec, 0xa6824c1e,
+             0x3db7d9aa, 0x06ff6a07, 0x26339a48, 0x0d646bf7, 0xc9ed734c, 0x823c0b13, 0x97666bce, 0x44d703e1,
+             0xce0f3440, 0xdef19511, 0x2fb7687d, 0x9f00336c, 0x7b922009, 0x75ebed50, 0x8bbd50f9, 0x406cb534,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xb697d059, 0x33cd2284, 0x3ae5be9b,
+             0x94ed91e0, 0xbc832021, 0x1073a532, 0xb6e4347b, 0x52b7c840, 0x4464c399, 0x83218ba2, 0x662a96fd,
+             0xe85f883e, 0xb30b4a08, 0xdfaeb68a, 0x92d4b01d}},
+    },
+    {
+        {"NONE", 41, {27790, 11599, 5287}, 203.35f, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 664}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {1703, 852, 681}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0xda99a8f5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xe23c87ec,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x538c2775, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xbeb5a100, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5}},
+        {"COLOR_WANDER", 33492, {27455, 11601, 5252}, 41.84f, {
+             {0, 0, 0}, {1637, 618, 118}, {1683, 588, 1}, {1703, 508, 74}, {1703, 495, 112}, {1655, 568, 0},
+             {1650, 620, 85}, {1703, 575, 103}, {1703, 498, 0}, {1691, 503, 95}, {1636, 582, 94}, {1694, 620, 0},
+             {1703, 560, 104}, {1703, 491, 83}, {1648, 514, 0}, {1652, 593, 115}, {30, 91, 658}, {36, 64, 634},
+             {5, 42, 658}, {0, 57, 657}, {15, 87, 636}, {40, 88, 658}, {21, 59, 653}, {0, 42, 639},
+             {0, 62, 658}, {33, 90, 649}, {34, 85, 642}, {1, 53, 658}, {0, 43, 645}, {20, 68, 646},
+             {60, 103, 679}, {1703, 884, 241}, {1638, 804, 264}, {1677, 793, 348}, {1703, 868, 233}, {1703, 918, 275},
+             {1660, 871, 344}, {1646, 795, 227}, {1703, 802, 286}, {1703, 882, 338}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1833, 997, 345}, {3975, 1688, 251}, {4095, 1552, 494},
+             {4095, 1650, 481}, {4053, 1838, 252}, {3935, 1840, 516}, {4088, 1653, 456}, {4095, 1552, 258}, {4095, 1684, 535},
+             {3955, 1857, 430}, {3996, 1816, 268}, {4095, 1622, 550}, {4095, 1559, 403}, {4026, 1720, 282}, {3941, 1868, 562}}, {
+             {0, 0, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0},
+             {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0},
+             {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {0, 41, 115}, {0, 41, 632}, {0, 41, 632},
+             {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632},
+             {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632}, {0, 41, 632},
+             {60, 103, 217}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217},
+             {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1833, 997, 251}, {3934, 1551, 251}, {3934, 1551, 251},
+             {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251},
+             {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}}, {
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129},
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129},
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1652, 593, 692}, {40, 93, 658}, {40, 93, 658},
+             {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658},
+             {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658}, {40, 93, 658},
+             {1703, 918, 714}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351},
+             {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572},
+             {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572},
+             {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}}, {
+             0xcbda783d, 0x9c2aa7be, 0x0be5c023, 0xb059898a, 0xb19b7caf, 0xfb58198d, 0x89f80d9a, 0x6ed588da,
+             0x55a07885, 0xff865bcb, 0xbbb4ae8a, 0xaa7317d0, 0xd9e9e731, 0x6ddf31b2, 0x774ac69b, 0xc94aa5b4,
+             0x2816aeb3, 0xaf65880d, 0xfc612813, 0xfdcdd439, 0xc8ac25ce, 0x110397a5, 0xbdff42b2, 0x363fd070,
+             0xac493294, 0xb55e908c, 0xeb152e42, 0xe07d33ed, 0x83ffc8f7, 0x13645b01, 0x63764499, 0x398e3b63,
+             0x05a7870d, 0x6dc9cbfa, 0x32192fe6, 0x34a6121c, 0xaeff98cc, 0x7be08856, 0x0d53fd29, 0xe8950f92,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x42b47887, 0x474637b3, 0x887060fb,
+             0x228c097e, 0x12e3555c, 0x4b095be9, 0xa358d392, 0x48f1457f, 0xcd2a61a8, 0xd9604463, 0xa22e4f72,
+             0x93f3c6a9, 0xee2f5d3d, 0x99e6e576, 0x78a2d9b6}},
+        {"LEVEL_PULSE", 256645, {25556, 10653, 5386}, 37.83f, {
+             {0, 0, 0}, {530, 172, 19}, {1244, 405, 46}, {3669, 1193, 135}, {2865, 932, 105}, {768, 250, 28},
+             {687, 223, 25}, {2607, 848, 96}, {3814, 1240, 140}, {1427, 464, 52}, {521, 170, 19}, {1491, 485, 55},
+             {3852, 1253, 141}, {2522, 820, 93}, {664, 216, 24}, {799, 260, 30}, {23, 112, 1091}, {28, 135, 1318},
+             {10, 48, 474}, {5, 23, 232}, {15, 70, 684}, {30, 147, 1434}, {18, 84, 825}, {5, 26, 253},
+             {8, 39, 386}, {25, 123, 1201}, {26, 125, 1228}, {8, 41, 402}, {5, 25, 247}, {17, 81, 795},
+             {37, 151, 1441}, {1856, 928, 309}, {544, 272, 91}, {1134, 567, 189}, {3549, 1774, 591}, {3035, 1517, 506},
+             {834, 417, 139}, {642, 321, 107}, {2432, 1216, 405}, {3887, 1943, 648}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {785, 386, 125}, {1678, 701, 169}, {4095, 1711, 412},
+             {4095, 1711, 412}, {3087, 1290, 310}, {1163, 486, 117}, {3903, 1631, 392}, {4095, 1711, 412}, {4095, 1711, 412},
+             {1400, 585, 141}, {1997, 834, 201}, {4095, 1711, 412}, {4095, 1711, 412}, {2541, 1062, 255}, {1227, 513, 123}}, {
+             {0, 0, 0}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19},
+             {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19},
+             {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {4, 23, 30}, {4, 23, 227}, {4, 23, 227},
+             {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227},
+             {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227}, {4, 23, 227},
+             {37, 151, 87}, {521, 261, 87}, {521, 261, 87}, {521, 261, 87}, {521, 261, 87}, {521, 261, 87},
+             {521, 261, 87}, {521, 261, 87}, {521, 261, 87}, {521, 261, 87}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {785, 386, 116}, {1152, 481, 116}, {1152, 481, 116},
+             {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116},
+             {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}}, {
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146},
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146},
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {799, 260, 1440}, {31, 147, 1440}, {31, 147, 1440},
+             {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440},
+             {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440}, {31, 147, 1440},
+             {3971, 1986, 1517}, {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662},
+             {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662}, {3971, 1986, 662}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0x61d6af92, 0x7507e2af, 0x739dfe81, 0x69717fb4, 0x31448155, 0xece3275d, 0xc8270d31, 0x09c6f217,
+             0x819e7e40, 0x87e90c22, 0xb5522fde, 0x9ec3a6b7, 0x55e81988, 0x223762b7, 0x2c5e2565, 0xdc049fbb,
+             0xd4996d40, 0x82f90084, 0x460ad63a, 0x6dd3cc97, 0xdab5d3dd, 0x54f4123d, 0xf3c02949, 0x67627993,
+             0x50ce2272, 0x0688c1ad, 0xc233466c, 0x3cdb8ab6, 0x0bbcb84f, 0xe64a0062, 0xde488e3e, 0xc9ed0236,
+             0xb355867a, 0x019aa8a1, 0xaf60be50, 0x414d695a, 0xfd97f6e8, 0x4effa08d, 0x0e4e66b7, 0xf4947c2b,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xd56507bd, 0xdd9ff9ff, 0x8b154d58,
+             0xc67c86fd, 0x7561ffa1, 0x17f7d95d, 0x813e7f65, 0x6280c347, 0x65bbce06, 0x3348780b, 0xc618236e,
+             0xd21d2609, 0x686f1f80, 0x258e52fa, 0xc7f20eb1}},
+        {"COMBO", 310002, {26840, 11167, 5016}, 36.29f, {
+             {0, 0, 0}, {2718, 1026, 197}, {3731, 1304, 3}, {3895, 1161, 169}, {3094, 899, 203}, {1894, 650, 0},
+             {1033, 389, 53}, {625, 211, 38}, {524, 153, 0}, {708, 211, 40}, {1229, 437, 70}, {2266, 829, 0},
+             {3398, 1118, 208}, {3967, 1145, 194}, {3444, 1075, 0}, {2417, 868, 165}, {25, 78, 560}, {18, 32, 314},
+             {1, 15, 233}, {0, 22, 251}, {9, 52, 377}, {41, 91, 678}, {34, 95, 1065}, {0, 87, 1346},
+             {0, 133, 1406}, {56, 154, 1104}, {37, 93, 706}, {0, 34, 417}, {0, 17, 256}, {6, 24, 225},
+             {20, 44, 309}, {1325, 688, 188}, {2254, 1107, 363}, {3399, 1608, 705}, {3971, 2024, 544}, {3510, 1893, 567},
+             {2357, 1237, 489}, {1333, 644, 184}, {759, 357, 128}, {531, 275, 106}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3971, 2159, 747}, {3975, 1688, 251}, {4095, 1552, 494},
+             {2312, 932, 272}, {1323, 600, 82}, {1128, 528, 148}, {1719, 695, 192}, {3258, 1235, 205}, {4095, 1684, 535},
+             {3955, 1857, 430}, {3996, 1816, 268}, {4095, 1622, 550}, {4095, 1559, 403}, {3101, 1324, 217}, {1611, 764, 230}}, {
+             {0, 0, 0}, {2718, 837, 0}, {3651, 1089, 0}, {3044, 889, 0}, {1891, 571, 0}, {1034, 320, 0},
+             {625, 187, 0}, {501, 149, 0}, {509, 150, 0}, {708, 211, 0}, {1229, 391, 0}, {2234, 676, 0},
+             {3347, 983, 0}, {3434, 1024, 0}, {2421, 730, 0}, {0, 37, 165}, {0, 21, 314}, {0, 14, 228},
+             {0, 14, 219}, {0, 16, 246}, {0, 26, 377}, {0, 44, 678}, {0, 68, 1051}, {0, 87, 1346},
+             {0, 72, 1105}, {0, 48, 705}, {0, 28, 416}, {0, 16, 256}, {0, 14, 219}, {0, 14, 225},
+             {20, 44, 101}, {1325, 630, 173}, {2254, 1090, 334}, {3348, 1608, 455}, {3433, 1649, 455}, {2348, 1175, 334},
+             {1334, 645, 184}, {759, 353, 101}, {518, 247, 70}, {501, 240, 66}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3934, 1551, 251}, {3934, 1551, 251}, {2313, 892, 162},
+             {1304, 519, 82}, {1107, 436, 71}, {1128, 449, 75}, {1696, 663, 111}, {3258, 1235, 205}, {3934, 1551, 251},
+             {3934, 1551, 251}, {3934, 1551, 251}, {3934, 1551, 251}, {3087, 1226, 197}, {1613, 661, 111}, {1148, 449, 75}}, {
+             {2760, 1025, 212}, {3769, 1370, 280}, {3971, 1447, 301}, {3895, 1403, 294}, {3094, 1101, 212}, {1920, 697, 135},
+             {1033, 389, 78}, {625, 217, 43}, {707, 248, 48}, {1239, 436, 94}, {2272, 829, 160}, {3397, 1225, 238},
+             {3967, 1442, 301}, {3971, 1447, 301}, {3532, 1280, 261}, {2417, 868, 964}, {31, 78, 560}, {20, 44, 318},
+             {15, 35, 252}, {23, 52, 377}, {41, 95, 678}, {61, 149, 1069}, {82, 194, 1362}, {87, 204, 1439},
+             {84, 198, 1406}, {63, 158, 1104}, {43, 95, 711}, {25, 56, 417}, {16, 36, 256}, {19, 43, 308},
+             {1325, 704, 327}, {2273, 1227, 434}, {3439, 1814, 708}, {3971, 2134, 815}, {3971, 2141, 815}, {3510, 1893, 708},
+             {2391, 1237, 489}, {1333, 702, 255}, {759, 397, 151}, {594, 321, 118}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 2159, 747}, {4095, 1872, 572}, {4095, 1872, 572},
+             {2312, 1025, 277}, {1332, 607, 178}, {1720, 766, 233}, {3257, 1413, 409}, {4095, 1872, 572}, {4095, 1872, 572},
+             {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572}, {3123, 1408, 408}, {1619, 764, 232}}, {
+             0x5e0d49fa, 0xda344786, 0x43f0680e, 0xb66c7f0f, 0x3675ca99, 0x6c7743f9, 0xf4c96028, 0x9e89397d,
+             0x47c8de93, 0x157dfe19, 0x81306c4e, 0x8f0368f6, 0x6ed84ee7, 0x2fa1d6bc, 0x63cc5f34, 0x8b3a92b9,
+             0xdc53f647, 0xf42a62f8, 0x9677003b, 0xaef29a98, 0x80200c0f, 0x759acced, 0xf3cae2af, 0xb79d4361,
+             0x8a62bf9a, 0xe9cd966e, 0x08c9c517, 0x947e8ba7, 0xbdef458c, 0x27137fe2, 0xc7c08e26, 0xfc17a60a,
+             0xe25dd1b8, 0x9ea8ddb6, 0x1ef7497e, 0xee4969aa, 0x14f19ecc, 0xc9d9edff, 0x164a23ff, 0x7f1b9b14,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x0667554a, 0xd00799d1, 0x7efa1dcc,
+             0x87b2ae6d, 0x395d62a3, 0x0aca93ac, 0x7541f6db, 0x025eeeb4, 0x9ea47a58, 0xd0e55a18, 0x34d711ed,
+             0x9d4424fe, 0x6fd3ca60, 0xaeb08e65, 0x0c45dc4b}},
+        {"SCENE_CHANGE", 207916, {24266, 10856, 5216}, 33.32f, {
+             {0, 0, 0}, {2016, 1007, 434}, {2839, 912, 294}, {2320, 697, 106}, {1285, 418, 27}, {1048, 427, 22},
+             {2617, 688, 81}, {1877, 564, 249}, {845, 245, 84}, {3073, 1590, 29}, {3107, 1315, 0}, {1048, 427, 59},
+             {2128, 647, 120}, {999, 301, 0}, {1870, 792, 135}, {2349, 626, 493}, {60, 209, 1065}, {42, 18, 211},
+             {0, 0, 1056}, {0, 114, 398}, {0, 61, 214}, {0, 0, 256}, {23, 45, 465}, {104, 56, 658},
+             {0, 363, 1135}, {0, 58, 239}, {74, 106, 480}, {231, 156, 1243}, {29, 16, 227}, {0, 141, 598},
+             {48, 8, 259}, {953, 585, 255}, {1546, 1016, 494}, {2209, 1122, 334}, {2238, 1195, 860}, {841, 631, 184},
+             {1793, 1003, 210}, {1726, 755, 565}, {1791, 963, 507}, {1461, 885, 496}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {951, 341, 80}, {3308, 1711, 1134}, {3196, 1306, 123},
+             {2806, 1349, 711}, {3340, 908, 1198}, {3404, 2225, 958}, {2261, 1161, 456}, {4095, 1149, 1182}, {3655, 1484, 611},
+             {4095, 2225, 122}, {4095, 2113, 0}, {2726, 852, 691}, {4095, 941, 861}, {3677, 1406, 171}, {3565, 1390, 74}}, {
+             {0, 0, 0}, {1341, 335, 0}, {784, 321, 0}, {1134, 278, 0}, {874, 201, 0}, {951, 175, 0},
+             {904, 376, 0}, {831, 201, 0}, {845, 227, 0}, {872, 145, 0}, {938, 266, 0}, {1048, 338, 0},
+             {999, 261, 0}, {999, 232, 0}, {845, 255, 65}, {0, 0, 48}, {0, 0, 211}, {0, 0, 211},
+             {0, 0, 307}, {0, 0, 204}, {0, 0, 213}, {0, 0, 256}, {0, 0, 181}, {0, 0, 242},
+             {0, 0, 239}, {0, 39, 239}, {0, 0, 256}, {0, 16, 227}, {0, 0, 227}, {0, 0, 258},
+             {48, 8, 126}, {831, 276, 2}, {802, 436, 145}, {1015, 312, 7}, {841, 503, 78}, {841, 539, 58},
+             {1015, 546, 70}, {960, 356, 0}, {975, 676, 0}, {684, 341, 80}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {951, 341, 0}, {2350, 588, 61}, {2617, 884, 0},
+             {2196, 908, 0}, {2207, 908, 0}, {2261, 994, 0}, {2261, 959, 0}, {2679, 636, 0}, {2453, 1173, 0},
+             {2119, 828, 0}, {2350, 852, 0}, {2437, 588, 0}, {2785, 941, 0}, {2699, 706, 0}, {2516, 687, 0}}, {
+             {2016, 1007, 434}, {2839, 1007, 434}, {3039, 912, 294}, {2466, 697, 361}, {2747, 1517, 316}, {2656, 688, 248},
+             {2617, 1056, 350}, {2806, 1221, 263}, {3073, 1590, 205}, {3107, 1590, 221}, {3107, 1315, 206}, {2774, 1480, 570},
+             {2466, 1121, 374}, {2711, 1349, 302}, {2349, 792, 493}, {2349, 626, 1399}, {106, 209, 1065}, {98, 335, 1152},
+             {159, 259, 1082}, {130, 138, 634}, {49, 144, 935}, {85, 97, 947}, {104, 88, 828}, {170, 363, 1262},
+             {106, 363, 1135}, {139, 198, 1482}, {231, 174, 1243}, {231, 267, 1243}, {124, 141, 875}, {176, 285, 1261},
+             {1500, 845, 381}, {2384, 1699, 494}, {2779, 1760, 792}, {2326, 1228, 907}, {2711, 1534, 860}, {2035, 1059, 280},
+             {2248, 1421, 723}, {2317, 1746, 723}, {2776, 1843, 837}, {2437, 1304, 616}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1972, 1134}, {4095, 1835, 1134}, {4095, 2402, 1006},
+             {4095, 1711, 1198}, {4095, 2354, 1198}, {4079, 2225, 958}, {4095, 2129, 1182}, {4095, 2386, 1182}, {4095, 2225, 1006},
+             {4095, 2386, 958}, {4095, 2434, 1086}, {4095, 1455, 861}, {4095, 2183, 861}, {4095, 2402, 586}, {4095, 2441, 568}}, {
+             0xd63bcf3d, 0xc0c81584, 0xc62d8ab8, 0x534082a2, 0x45e78ed4, 0x57ebb623, 0x9235a4c5, 0x659b5e83,
+             0xcc6b1da6, 0x226c2d11, 0x356506f9, 0xcb295f8e, 0x126a94fd, 0xb8e00256, 0xcaa455d2, 0x62878c5b,
+             0x82dd005f, 0x075d9429, 0xd1458992, 0xf21e7d67, 0xb0783136, 0xcb56b3ae, 0x2d5fa234, 0xc4daddeb,
+             0xa1a0585a, 0x28edf035, 0x67c5f9e4, 0x6f1eab2d, 0x16b23d8c, 0xee704fa5, 0x09a0c5cb, 0x600a9369,
+             0x5ac876d2, 0xb6f68bab, 0xee7f4783, 0x28ec4a94, 0xebdc785c, 0x98e149fb, 0x6fead17d, 0x59db4dd7,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x87cd99fb, 0x57c206db, 0xe529a392,
+             0x0370d638, 0xecb0d17a, 0x9e369a91, 0x5629596d, 0x3dd648b6, 0xcfd5bbea, 0xb361a9c8, 0xd597ccbb,
+             0xc8186b25, 0xa2a738b5, 0x4e4693dc, 0xd1ac11f0}},
+        {"FIREPLACE", 563548, {17632, 7148, 2753}, 45.92f, {
+             {0, 0, 0}, {1277, 413, 38}, {1125, 355, 33}, {814, 243, 24}, {734, 215, 22}, {944, 289, 28},
+             {1263, 407, 37}, {1267, 409, 37}, {1018, 315, 30}, {936, 286, 27}, {1173, 373, 34}, {1492, 496, 44},
+             {1422, 469, 42}, {1051, 328, 31}, {856, 257, 25}, {985, 303, 29}, {12, 50, 393}, {11, 48, 383},
+             {8, 36, 299}, {8, 30, 256}, {9, 36, 306}, {11, 51, 402}, {12, 53, 420}, {10, 41, 341},
+             {8, 35, 290}, {9, 41, 333}, {13, 55, 426}, {13, 57, 441}, {10, 43, 352}, {8, 34, 287},
+             {10, 39, 317}, {1271, 631, 169}, {1335, 669, 178}, {1042, 499, 139}, {809, 370, 108}, {881, 409, 117},
+             {1167, 570, 156}, {1277, 634, 170}, {1039, 497, 139}, {830, 382, 111}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1103, 515, 141}, {3009, 1249, 242}, {3294, 1389, 265},
+             {2575, 1040, 207}, {1818, 693, 146}, {1784, 678, 143}, {2403, 960, 193}, {2883, 1188, 232}, {2512, 1011, 202},
+             {1979, 765, 159}, {2111, 825, 170}, {2981, 1235, 240}, {3690, 1589, 297}, {3242, 1364, 261}, {2402, 959, 193}}, {
+             {0, 0, 0}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22},
+             {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {734, 215, 22},
+             {734, 215, 22}, {734, 215, 22}, {734, 215, 22}, {7, 28, 29}, {7, 28, 246}, {7, 28, 246},
+             {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246},
+             {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246}, {7, 28, 246},
+             {9, 38, 98}, {734, 330, 98}, {734, 330, 98}, {734, 330, 98}, {734, 330, 98}, {734, 330, 98},
+             {734, 330, 98}, {734, 330, 98}, {734, 330, 98}, {734, 330, 98}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1103, 515, 134}, {1669, 628, 134}, {1669, 628, 134},
+             {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134},
+             {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}, {1669, 628, 134}}, {
+             {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45},
+             {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45},
+             {1548, 519, 45}, {1548, 519, 45}, {1548, 519, 45}, {1352, 437, 483}, {14, 64, 483}, {14, 64, 483},
+             {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483},
+             {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483}, {14, 64, 483},
+             {1548, 798, 419}, {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206},
+             {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206}, {1548, 798, 206}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3701, 1595, 298}, {3701, 1595, 298}, {3701, 1594, 298},
+             {3701, 1595, 298}, {3701, 1595, 298}, {3701, 1595, 298}, {3701, 1594, 298}, {3701, 1595, 298}, {3701, 1595, 298},
+             {3701, 1595, 298}, {3701, 1595, 298}, {3701, 1594, 298}, {3701, 1595, 298}, {3701, 1594, 298}, {3701, 1594, 298}}, {
+             0x3bb72c9f, 0xb907d31f, 0xeb1912fb, 0x5f3a2af9, 0x311068f3, 0xd2fc281a, 0x29f74996, 0xcc9e4f40,
+             0x117a5e35, 0xc89857fd, 0x22993ee0, 0xb4179417, 0x91f96a73, 0x1ebfb322, 0x6b4de5c7, 0xf8c9582c,
+             0x934d2b97, 0x14cade10, 0x94e4e233, 0x2cc1fd96, 0x954b30ef, 0x4437ef14, 0x989d8acc, 0xd06a9038,
+             0x8443e2f4, 0x2d932b2b, 0x8dc6e41b, 0xf5eb4711, 0x081a9e6b, 0xb2673de8, 0x0f324a6b, 0x030b8b1c,
+             0x4ca2e0eb, 0xb9170b7c, 0x2da465db, 0xe6414090, 0x2a7bb010, 0x3ce65aa7, 0x4cc84c7b, 0x1eb36fcc,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x335adb62, 0x612a9a00, 0x90fc1876,
+             0x077a9d22, 0xef9ee496, 0x797b9c4c, 0x67351e8f, 0x4f904985, 0x5b786c26, 0xa466aa04, 0xee93002c,
+             0xb2af294d, 0xa2f03eee, 0xc83951ed, 0x5e7ecdf1}},
+        {"RAINBOW", 82920, {27160, 12072, 6157}, 54.18f, {
+             {0, 0, 0}, {1703, 537, 119}, {1653, 646, 85}, {1670, 537, 194}, {1594, 646, 105}, {1627, 537, 194},
+             {1594, 646, 108}, {1664, 537, 194}, {1645, 646, 85}, {1703, 537, 128}, {1703, 579, 85}, {1703, 626, 85},
+             {1703, 537, 171}, {1611, 646, 85}, {1642, 537, 194}, {1702, 537, 95}, {24, 114, 616}, {65, 72, 632},
+             {23, 114, 642}, {52, 72, 658}, {23, 83, 658}, {23, 94, 658}, {62, 72, 658}, {23, 114, 634},
+             {65, 72, 627}, {26, 114, 616}, {65, 72, 621}, {23, 114, 623}, {65, 72, 646}, {23, 112, 658},
+             {69, 102, 617}, {1703, 892, 288}, {1703, 811, 347}, {1613, 920, 288}, {1661, 811, 397}, {1594, 920, 329},
+             {1640, 811, 397}, {1594, 920, 309}, {1700, 811, 397}, {1667, 920, 288}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1817, 885, 429}, {3833, 1902, 533}, {3970, 1640, 706},
+             {3874, 1902, 444}, {4095, 1640, 618}, {4095, 1848, 444}, {4095, 1779, 444}, {4095, 1640, 555}, {3924, 1902, 444},
+             {4004, 1640, 706}, {3833, 1902, 521}, {3927, 1640, 706}, {3833, 1902, 499}, {4044, 1640, 706}, {3979, 1902, 444}}, {
+             {0, 0, 0}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85},
+             {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85},
+             {1594, 537, 85}, {1594, 537, 85}, {1594, 537, 85}, {23, 72, 95}, {23, 72, 616}, {23, 72, 616},
+             {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616},
+             {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616}, {23, 72, 616},
+             {69, 102, 288}, {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288},
+             {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288}, {1594, 811, 288}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1817, 885, 429}, {3833, 1640, 444}, {3833, 1640, 444},
+             {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444},
+             {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}}, {
+             {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194},
+             {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194},
+             {1703, 646, 194}, {1703, 646, 194}, {1703, 646, 194}, {1702, 537, 658}, {65, 114, 658}, {65, 114, 658},
+             {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658},
+             {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658},
+             {1703, 920, 640}, {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397},
+             {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397}, {1703, 920, 397}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706},
+             {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706},
+             {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}}, {
+             0x5bb0ebb8, 0x866c55ae, 0xd6be6ffe, 0xac62a46b, 0xd3f8563c, 0x4b71129f, 0x9752595e, 0x3f25e5b4,
+             0x05a75ba7, 0xf3d7e88d, 0xd1b228c8, 0xb56d8e3b, 0xe3ae87b9, 0x68170c53, 0x92a68f1f, 0xca888c33,
+             0x59c8d337, 0x8c9bb994, 0xa4ff2f37, 0xef1328cb, 0xf492f998, 0xdc3c8534, 0xac5830b6, 0x1054871d,
+             0x3389606f, 0x4d371b1e, 0xbad169ff, 0x23ff53f1, 0xbddb6d09, 0xfa21171c, 0x13defd94, 0xe6155ed0,
+             0x3e0b8160, 0x57635772, 0x3a6c910b, 0xd2394302, 0xa889729e, 0x747e18b2, 0xe7d5f448, 0xf2deb14b,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xd2ce427c, 0x67ff7c66, 0x1af13276,
+             0x0f76c4d8, 0xad097a7d, 0x7beb9309, 0x13f66b51, 0xece9a21a, 0x13eef1cf, 0x0b5d00e0, 0xdddf06d2,
+             0xc784f617, 0x63f459b3, 0xd783c13a, 0xa273d301}},
+        {"COLOR_STEPS", 4030, {27051, 11537, 5256}, 40.00f, {
+             {0, 0, 0}, {1703, 483, 48}, {1703, 562, 86}, {1703, 728, 0}, {1608, 753, 126}, {1703, 742, 172},
+             {1531, 746, 0}, {1536, 578, 0}, {1599, 457, 0}, {1703, 673, 155}, {1703, 658, 0}, {1703, 678, 60},
+             {1703, 712, 166}, {1703, 382, 243}, {1647, 424, 184}, {1616, 682, 79}, {0, 87, 658}, {57, 22, 658},
+             {36, 93, 658}, {78, 126, 648}, {27, 93, 613}, {81, 99, 658}, {12, 92, 658}, {31, 34, 658},
+             {53, 127, 634}, {10, 123, 658}, {15, 16, 658}, {16, 81, 658}, {0, 17, 658}, {2, 27, 658},
+             {3, 93, 679}, {1595, 701, 102}, {1703, 865, 171}, {1635, 955, 119}, {1703, 921, 183}, {1703, 739, 251},
+             {1703, 654, 432}, {1609, 966, 144}, {1635, 801, 323}, {1679, 740, 377}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 777, 217}, {4095, 2110, 591}, {4095, 1530, 676},
+             {4095, 1914, 67}, {4054, 1883, 0}, {3913, 1796, 785}, {3961, 1695, 661}, {4095, 1950, 281}, {4057, 1602, 703},
+             {3821, 2169, 299}, {3724, 1911, 729}, {3747, 1696, 95}, {3673, 1804, 699}, {4095, 1792, 798}, {4095, 1862, 186}}, {
+             {0, 0, 0}, {1505, 354, 0}, {1508, 360, 0}, {1510, 363, 0}, {1517, 357, 0}, {1507, 367, 0},
+             {1505, 355, 0}, {1513, 366, 0}, {1507, 354, 0}, {1505, 360, 0}, {1503, 366, 0}, {1509, 362, 0},
+             {1503, 366, 0}, {1513, 358, 0}, {1507, 353, 0}, {0, 0, 68}, {0, 0, 583}, {0, 0, 582},
+             {0, 0, 581}, {0, 0, 583}, {0, 0, 580}, {0, 0, 583}, {0, 0, 581}, {0, 0, 583},
+             {0, 0, 581}, {0, 0, 584}, {0, 0, 582}, {0, 0, 588}, {0, 0, 586}, {0, 0, 581},
+             {3, 93, 84}, {1508, 651, 87}, {1506, 661, 87}, {1506, 658, 84}, {1505, 656, 87}, {1541, 655, 87},
+             {1513, 654, 101}, {1504, 656, 92}, {1513, 657, 88}, {1520, 653, 98}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 777, 0}, {3616, 1254, 0}, {3623, 1244, 0},
+             {3633, 1243, 0}, {3626, 1244, 0}, {3636, 1230, 0}, {3653, 1249, 0}, {3615, 1230, 0}, {3636, 1236, 0},
+             {3620, 1242, 0}, {3716, 1234, 0}, {3617, 1245, 0}, {3645, 1233, 0}, {3647, 1258, 0}, {3635, 1230, 0}}, {
+             {1703, 745, 257}, {1703, 752, 260}, {1703, 751, 260}, {1703, 742, 262}, {1703, 753, 256}, {1703, 753, 234},
+             {1703, 748, 258}, {1703, 753, 260}, {1703, 748, 258}, {1703, 746, 261}, {1703, 743, 252}, {1703, 753, 261},
+             {1703, 754, 262}, {1703, 753, 243}, {1703, 749, 263}, {1616, 682, 726}, {89, 141, 658}, {90, 145, 658},
+             {90, 143, 658}, {90, 144, 658}, {83, 140, 658}, {91, 142, 658}, {91, 144, 658}, {91, 144, 658},
+             {90, 144, 658}, {83, 138, 658}, {90, 142, 658}, {88, 144, 658}, {91, 144, 658}, {91, 131, 658},
+             {1703, 1050, 1703}, {1703, 1044, 484}, {1703, 1030, 471}, {1703, 1049, 483}, {1703, 1040, 484}, {1703, 1044, 480},
+             {1703, 1045, 484}, {1703, 1041, 477}, {1703, 1046, 481}, {1703, 1048, 475}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 2174, 888}, {4095, 2183, 893}, {4095, 2187, 864},
+             {4095, 2182, 892}, {4095, 2160, 886}, {4095, 2192, 878}, {4095, 2185, 887}, {4095, 2190, 866}, {4095, 2158, 889},
+             {4095, 2191, 871}, {4095, 2191, 886}, {4095, 2175, 888}, {4095, 2190, 885}, {4095, 2192, 892}, {4095, 2192, 874}}, {
+             0x15030071, 0xb98756cc, 0x3d7a87d5, 0xd03f977f, 0x04d84c62, 0x0474c252, 0xdbe13b8d, 0x9abd11d0,
+             0x7222085e, 0x29bb451b, 0x762157b1, 0xd1e6ea38, 0x99561013, 0x63903daf, 0x2811a54d, 0xc7af705b,
+             0x43a4d9db, 0xa5d977ea, 0x3f16523e, 0xd7a2d983, 0xc4a4f31d, 0x16e91972, 0x05dd3d6f, 0x87bcde57,
+             0x2ef0d762, 0xb8a548dd, 0xfdeb174e, 0x9b1a4c15, 0x1ed01185, 0x50b7a927, 0x3936ff7f, 0xfc2ff538,
+             0x0eb0a6d4, 0xbd14b5df, 0x87eebcea, 0x0a654c9c, 0xd158f043, 0x030c3e7f, 0xa764b951, 0x3b79e4ef,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xcd365334, 0x50e09701, 0x2fb5e44a,
+             0x42393599, 0x9a0730b9, 0x00e130cb, 0xad851d03, 0xd84338e6, 0xc688d5a1, 0xb67d35c3, 0xf7d12d5b,
+             0xba8456f2, 0xf0266470, 0x70233a69, 0xf1e1deb9}},
+        {"BROKEN_ELECTRICITY", 6531, {27433, 11474, 5248}, 36.36f, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {0, 0, 0}, {127, 41, 4}, {350, 114, 13}, {130, 42, 4}, {279, 90, 10}, {94, 30, 3},
+             {0, 0, 0}, {228, 74, 8}, {215, 70, 8}, {195, 63, 7}, {208, 67, 7}, {0, 0, 0},
+             {127, 41, 4}, {531, 173, 19}, {208, 67, 7}, {0, 0, 0}, {1, 6, 63}, {1, 5, 52},
+             {2, 10, 98}, {1, 8, 82}, {1, 4, 44}, {1, 5, 52}, {1, 8, 85}, {1, 6, 65},
+             {1, 8, 78}, {1, 8, 85}, {2, 10, 106}, {1, 7, 73}, {4, 21, 207}, {2, 11, 112},
+             {14, 67, 23}, {382, 191, 63}, {94, 47, 15}, {142, 71, 23}, {113, 56, 18}, {126, 63, 21},
+             {363, 181, 60}, {114, 57, 19}, {0, 0, 0}, {154, 77, 25}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {620, 259, 62}, {445, 186, 44}, {203, 85, 20},
+             {646, 270, 65}, {780, 326, 78}, {0, 0, 0}, {0, 0, 0}, {797, 333, 80}, {0, 0, 0},
+             {207, 86, 20}, {332, 138, 33}, {423, 177, 42}, {213, 89, 21}, {215, 89, 21}, {780, 326, 78}}, {
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {4095, 2131, 241}, {4095, 2131, 241},
+             {4095, 2131, 241}, {4095, 2131, 241}, {1703, 554, 63}, {1703, 554, 63}, {4095, 2131, 241}, {4095, 2131, 241},
+             {4095, 2131, 241}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 1996}, {68, 327, 1996}, {14, 67, 658},
+             {14, 67, 658}, {68, 327, 1996}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {68, 327, 1996}, {14, 67, 658}, {14, 67, 658}, {68, 327, 1996},
+             {4095, 3276, 1092}, {4095, 3276, 1092}, {1703, 852, 284}, {4095, 3276, 1092}, {1703, 852, 284}, {1703, 852, 284},
+             {4095, 3276, 1092}, {4095, 3276, 1092}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 2738, 658}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 2738, 658}, {4095, 2738, 658}, {4095, 2738, 658}, {4095, 2738, 658}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0x9a88fecf, 0xa9d5998e, 0x967ba1c1, 0x801e38b2, 0x56bb4e1a, 0x786cd4e7, 0xfd0be483, 0x211037a4,
+             0x5fc3eaf7, 0xe8e747d3, 0xae86c3f1, 0x40be7673, 0x395cef80, 0xa7cc81dc, 0xda19785f, 0x4e4a24cd,
+             0xe52955c8, 0x536ccd8e, 0xe4c2f77f, 0x6a6d2bbf, 0x7f12ac4a, 0x0d0b13ae, 0x57952227, 0x07c4c348,
+             0x1b9e3d7f, 0x5c5cd9ce, 0xff9d3dfb, 0xd160df31, 0x7e05843c, 0x7824c947, 0x13e29b07, 0x5fa696d2,
+             0x48b0a2dc, 0x795308bd, 0xd1bb8075, 0xb49403b5, 0x5129f8e5, 0x5ef53199, 0xfcf21288, 0x5d5027f3,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xdaa4992c, 0x4ee7265b, 0xdba110d7,
+             0x669f1acf, 0x495e2498, 0x9ad05ae3, 0xa8bc09cf, 0xc4e8f79a, 0x46d29319, 0x6d1bb026, 0xc00f72b8,
+             0x27b3dec6, 0x32e660cf, 0xc68e501e, 0x8b6fbf90}},
+        {"BREATHING", 899184, {11267, 4750, 2170}, 31.76f, {
+             {0, 0, 0}, {73, 23, 3}, {322, 104, 13}, {1532, 506, 46}, {1096, 360, 35}, {145, 46, 6},
+             {119, 38, 5}, {961, 315, 32}, {1614, 534, 47}, {399, 129, 15}, {71, 23, 3}, {427, 138, 16},
+             {1635, 541, 48}, {918, 301, 31}, {112, 36, 5}, {155, 50, 7}, {13, 48, 454}, {18, 63, 582},
+             {3, 14, 141}, {1, 4, 45}, {5, 25, 240}, {22, 71, 649}, {8, 33, 312}, {1, 5, 52},
+             {2, 10, 103}, {16, 55, 515}, {16, 57, 530}, {2, 11, 110}, {1, 5, 50}, {7, 31, 296},
+             {25, 73, 652}, {592, 296, 98}, {77, 39, 14}, {278, 139, 47}, {1466, 740, 235}, {1186, 597, 192},
+             {167, 84, 29}, {105, 53, 18}, {872, 438, 143}, {1655, 837, 263}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {136, 67, 23}, {256, 106, 28}, {2447, 1030, 235},
+             {3740, 1583, 349}, {737, 308, 76}, {123, 51, 14}, {1069, 447, 108}, {4010, 1699, 372}, {1908, 801, 187},
+             {180, 75, 20}, {352, 146, 37}, {2890, 1219, 275}, {3409, 1441, 320}, {535, 223, 56}, {138, 57, 15}}, {
+             {0, 0, 0}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3},
+             {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3},
+             {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {0, 4, 6}, {0, 4, 43}, {0, 4, 43},
+             {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43},
+             {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43},
+             {25, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12},
+             {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13},
+             {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13},
+             {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}}, {
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49},
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49},
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {155, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {1703, 862, 673}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270},
+             {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379},
+             {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379},
+             {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}}, {
+             0x1525fd8a, 0x3afccb7f, 0x91884786, 0xae7a25e3, 0x85fdf16f, 0xaeef17f5, 0xeb443519, 0xf1ab2a64,
+             0x46ca038a, 0x400cb8b0, 0x534e9d9e, 0xa0bfd756, 0xd9ca69da, 0x34842f42, 0xdeb2f3f3, 0x45aaf3f3,
+             0x1722ef61, 0x4345e4f5, 0x163259c8, 0xf3684381, 0xb462d843, 0x5e65a301, 0xf2f6fcd4, 0x8938cbed,
+             0x8dd7ffbb, 0xccc35e39, 0x87290ef3, 0xf972ab16, 0x50f6496d, 0x58d2900d, 0x1a1fc621, 0xc8a6e96c,
+             0x4fb923c1, 0x4075f1ab, 0x97a6786a, 0xa48cfc2b, 0xc78e4efd, 0xdbbae4a5, 0x51bff7ce, 0xaff21538,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x5a89bea8, 0xe9bab04e, 0xc45c3719,
+             0xdfd0189c, 0x96afd57c, 0x2c0518b5, 0xd0f0b7ff, 0xd402f6dd, 0x6c7eb957, 0x74575355, 0xb3de60cf,
+             0x7f2a9aa6, 0x1a5c7bd2, 0x7593f29d, 0x859d9780}},
+        {"AUTO_CYCLE", 154176, {24769, 10537, 5301}, 34.79f, {
+             {0, 0, 0}, {2016, 1007, 434}, {2839, 912, 294}, {2320, 697, 106}, {1285, 418, 27}, {1700, 387, 105},
+             {1703, 733, 188}, {1703, 360, 0}, {1613, 553, 42}, {577, 188, 21}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 488, 95}, {1703, 525, 94}, {1683, 604, 0}, {0, 89, 658}, {43, 72, 658},
+             {23, 114, 650}, {65, 72, 638}, {23, 114, 618}, {65, 72, 623}, {23, 114, 628}, {65, 72, 653},
+             {172, 0, 1018}, {39, 74, 286}, {56, 0, 265}, {17, 102, 616}, {65, 0, 658}, {0, 255, 1259},
+             {0, 43, 315}, {704, 447, 133}, {1536, 591, 0}, {1703, 727, 340}, {1440, 727, 231}, {1217, 613, 196},
+             {175, 88, 30}, {1639, 866, 260}, {1674, 918, 244}, {1703, 873, 351}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 928, 308}, {4095, 1606, 294}, {4095, 1566, 567},
+             {2225, 982, 202}, {4095, 1765, 444}, {4095, 1861, 444}, {4095, 1640, 629}, {3865, 1902, 444}, {4095, 1724, 13},
+             {4036, 1768, 149}, {4027, 2072, 407}, {3934, 1869, 571}, {4095, 1711, 412}, {4095, 1711, 412}, {3962, 1656, 398}}, {
+             {0, 0, 0}, {1341, 335, 0}, {784, 321, 0}, {1134, 278, 0}, {874, 280, 0}, {1505, 356, 0},
+             {1504, 357, 0}, {1507, 360, 0}, {521, 170, 0}, {521, 170, 19}, {99, 32, 3}, {107, 34, 4},
+             {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {0, 41, 0}, {0, 41, 616}, {23, 72, 616},
+             {23, 72, 616}, {23, 72, 616}, {0, 4, 43}, {23, 72, 616}, {23, 72, 616}, {0, 0, 210},
+             {0, 0, 233}, {0, 0, 265}, {0, 0, 265}, {0, 0, 581}, {0, 0, 587}, {0, 27, 239},
+             {0, 43, 0}, {704, 447, 0}, {1232, 591, 0}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12},
+             {70, 35, 12}, {1636, 785, 217}, {1636, 785, 217}, {1636, 785, 217}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1152, 481, 116}, {3934, 1551, 251}, {2225, 901, 166},
+             {1364, 522, 84}, {3833, 1640, 444}, {3833, 1640, 444}, {3833, 1640, 444}, {3645, 1266, 73}, {3631, 1233, 0},
+             {3624, 1243, 0}, {3622, 1238, 0}, {3934, 1551, 251}, {1152, 481, 116}, {1152, 481, 116}, {1152, 481, 116}}, {
+             {2016, 1007, 434}, {2839, 1007, 434}, {3039, 912, 294}, {2466, 697, 361}, {2747, 1517, 316}, {1703, 754, 261},
+             {1703, 741, 248}, {1703, 750, 262}, {3971, 1291, 261}, {3971, 1291, 146}, {4095, 2131, 241}, {1703, 554, 63},
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1683, 605, 658}, {65, 114, 658}, {65, 114, 658},
+             {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {65, 114, 658}, {224, 288, 1206},
+             {172, 255, 1100}, {56, 265, 1189}, {67, 177, 1164}, {88, 144, 658}, {155, 255, 1440}, {260, 352, 1260},
+             {2774, 1676, 669}, {2378, 1336, 631}, {1703, 1015, 474}, {1703, 1046, 481}, {1703, 862, 270}, {1703, 862, 270},
+             {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {1703, 918, 351}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1872, 572}, {4095, 1872, 572}, {4095, 1872, 572},
+             {4095, 1902, 505}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 1902, 706}, {4095, 2186, 861}, {4095, 2186, 886},
+             {4095, 2101, 844}, {4095, 2175, 865}, {4095, 1872, 572}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0xd63bcf3d, 0xc0c81584, 0xc62d8ab8, 0x534082a2, 0x27f3c907, 0x80b331bd, 0xf801056f, 0x9f41ab66,
+             0xc62f498c, 0x5af3ef54, 0x3507c8c5, 0x5b488950, 0x6b9bffbf, 0xfb1164bb, 0xe8a78052, 0xb65e6e3b,
+             0xa5779c2b, 0x4a88cab3, 0x046ba639, 0x46b4362c, 0x819a4b61, 0x13cf3d15, 0x7bfc407f, 0xdaf8da79,
+             0x796df29e, 0x5765414e, 0x19d336b8, 0xc182e57b, 0xdf435fb4, 0xdb950a09, 0xcdaa67eb, 0xb015ad39,
+             0xfc1102e3, 0x01c4642a, 0x97fdcc06, 0x5277e07b, 0xc54ff800, 0xa3272911, 0x3bd0df6b, 0xb08b5b0f,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xfbb9ee6e, 0xffd7cc54, 0xa07255be,
+             0xe1dd7080, 0xf50abb42, 0xfffd99b4, 0x93039928, 0xfcba9031, 0x50dd4aba, 0x64d75b76, 0x4d367248,
+             0x2084726c, 0x3a9caf27, 0x528cf70a, 0x60252df3}},
+        {"LAYERED", 885919, {9992, 4053, 1615}, 50.26f, {
+             {0, 0, 0}, {304, 98, 9}, {481, 152, 14}, {768, 229, 23}, {579, 170, 17}, {298, 91, 9},
+             {357, 115, 11}, {918, 296, 27}, {987, 306, 29}, {447, 136, 13}, {280, 89, 8}, {710, 236, 21},
+             {1388, 458, 41}, {747, 233, 22}, {250, 75, 7}, {317, 97, 9}, {9, 40, 319}, {10, 45, 359},
+             {4, 16, 139}, {2, 9, 80}, {5, 22, 182}, {12, 51, 401}, {8, 35, 278}, {3, 13, 105},
+             {4, 14, 120}, {8, 36, 292}, {11, 48, 378}, {5, 22, 176}, {3, 13, 106}, {5, 23, 189},
+             {10, 38, 317}, {716, 356, 95}, {321, 161, 42}, {421, 201, 56}, {744, 341, 99}, {721, 335, 96},
+             {378, 185, 51}, {344, 171, 46}, {720, 344, 96}, {817, 376, 109}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {325, 152, 42}, {807, 335, 65}, {2454, 1035, 197},
+             {2442, 987, 196}, {773, 295, 62}, {402, 152, 32}, {1186, 474, 95}, {2848, 1173, 229}, {1649, 663, 133},
+             {494, 191, 40}, {660, 258, 53}, {2439, 1011, 196}, {3312, 1426, 266}, {1154, 485, 93}, {538, 215, 43}}, {
+             {0, 0, 0}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {200, 59, 6},
+             {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {195, 57, 5},
+             {195, 57, 5}, {195, 57, 5}, {195, 57, 5}, {2, 9, 9}, {2, 9, 78}, {2, 9, 78},
+             {2, 9, 78}, {2, 9, 78}, {2, 9, 78}, {2, 9, 78}, {2, 9, 78}, {2, 9, 78},
+             {2, 9, 78}, {2, 9, 78}, {2, 9, 78}, {2, 9, 79}, {2, 9, 78}, {2, 9, 78},
+             {9, 38, 26}, {195, 88, 26}, {195, 88, 26}, {195, 88, 26}, {195, 88, 26}, {195, 88, 26},
+             {195, 88, 26}, {195, 88, 26}, {195, 88, 26}, {195, 88, 26}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {325, 147, 31}, {389, 147, 31}, {389, 147, 31},
+             {389, 146, 31}, {389, 147, 31}, {400, 152, 32}, {389, 147, 31}, {389, 147, 31}, {389, 147, 31},
+             {389, 146, 31}, {389, 147, 31}, {389, 146, 31}, {389, 147, 31}, {389, 147, 31}, {389, 146, 31}}, {
+             {1495, 499, 44}, {1495, 499, 44}, {1495, 499, 44}, {1495, 499, 44}, {1495, 498, 44}, {1495, 499, 44},
+             {1495, 498, 44}, {1495, 499, 44}, {1495, 499, 44}, {1495, 498, 44}, {1495, 499, 44}, {1495, 498, 44},
+             {1495, 499, 44}, {1495, 499, 44}, {1495, 498, 44}, {384, 124, 468}, {14, 60, 457}, {14, 62, 468},
+             {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468},
+             {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468}, {14, 62, 468},
+             {1495, 767, 418}, {1495, 767, 199}, {1495, 766, 199}, {1495, 767, 199}, {1495, 766, 199}, {1495, 767, 199},
+             {1495, 767, 199}, {1495, 766, 199}, {1460, 745, 195}, {1495, 767, 199}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3567, 1528, 287}, {3568, 1529, 287}, {3567, 1529, 287},
+             {3568, 1529, 287}, {3567, 1529, 287}, {3567, 1528, 287}, {3568, 1529, 287}, {3567, 1529, 287}, {3567, 1529, 287},
+             {3567, 1529, 287}, {3567, 1528, 287}, {3568, 1529, 287}, {3567, 1528, 287}, {3568, 1529, 287}, {3567, 1529, 287}}, {
+             0xcef6f976, 0x36c53cd4, 0x0e187d0c, 0x4b73c15e, 0x5a1261cd, 0xc388c1a9, 0x03de8be1, 0xb2667212,
+             0xe6ecfad1, 0x9efbbfaa, 0x4461b62b, 0x14a8bfe2, 0xfbc6122f, 0xcce1738d, 0xa4596040, 0xb417acf1,
+             0xa07811f8, 0x99df1a50, 0xaab0f644, 0xc024754e, 0xe10df553, 0x36ed92cf, 0xbca2baaf, 0x7cce5408,
+             0x2825d849, 0x655f3c8a, 0x2ef83eaa, 0x487a0f85, 0x4dc55e39, 0x53ac058a, 0xb982cbca, 0x0e6d1bf7,
+             0x6fd328d6, 0xa1582410, 0x95be4ba6, 0x56ad702b, 0xa6234779, 0x7085a757, 0x4d6cc3df, 0xfaaa2ea9,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x9e7b6aff, 0x7db0128b, 0xfad5e5cd,
+             0x2f56adf5, 0xb2d24ce9, 0x45fcfabb, 0x72525c61, 0xea9346ab, 0xb758c466, 0x73969c76, 0xd9842286,
+             0x312f54a3, 0x292b7c5d, 0xe85d31b4, 0xd337a386}},
+        {"PROGRAM", 899127, {11267, 4750, 2170}, 35.90f, {
+             {0, 0, 0}, {73, 23, 3}, {322, 104, 13}, {1532, 506, 46}, {1096, 360, 35}, {145, 46, 6},
+             {119, 38, 5}, {961, 315, 32}, {1614, 534, 47}, {399, 129, 15}, {71, 23, 3}, {427, 138, 16},
+             {1635, 541, 48}, {918, 301, 31}, {112, 36, 5}, {155, 50, 7}, {13, 48, 454}, {18, 63, 582},
+             {2, 14, 141}, {0, 4, 45}, {5, 25, 240}, {22, 71, 649}, {7, 33, 312}, {0, 5, 52},
+             {1, 10, 103}, {16, 55, 515}, {16, 57, 530}, {1, 11, 110}, {0, 5, 50}, {7, 31, 296},
+             {25, 73, 652}, {592, 296, 98}, {77, 39, 14}, {277, 139, 47}, {1466, 740, 235}, {1186, 597, 192},
+             {166, 84, 29}, {105, 53, 18}, {872, 438, 143}, {1655, 837, 263}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {136, 67, 23}, {255, 107, 28}, {2447, 1030, 235},
+             {3740, 1583, 349}, {737, 308, 76}, {123, 52, 14}, {1069, 447, 108}, {4010, 1699, 372}, {1908, 801, 187},
+             {180, 75, 20}, {351, 147, 37}, {2890, 1219, 275}, {3408, 1441, 320}, {535, 223, 56}, {138, 58, 15}}, {
+             {0, 0, 0}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3},
+             {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {70, 22, 3},
+             {70, 22, 3}, {70, 22, 3}, {70, 22, 3}, {0, 4, 6}, {0, 4, 43}, {0, 4, 43},
+             {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43},
+             {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43}, {0, 4, 43},
+             {25, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12},
+             {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {70, 35, 12}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13},
+             {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13},
+             {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}, {121, 50, 13}}, {
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49},
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49},
+             {1703, 564, 49}, {1703, 564, 49}, {1703, 564, 49}, {155, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653}, {22, 71, 653},
+             {1703, 862, 673}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270},
+             {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {1703, 862, 270}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379},
+             {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379},
+             {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}, {4095, 1735, 379}}, {
+             0xe386e169, 0x0e74b6f9, 0xab868be5, 0x2de0822c, 0x072939b1, 0xe444bc88, 0x5ddb829d, 0x9488bc30,
+             0xf1faddbb, 0xfa1c2370, 0xb6925d9b, 0xb8b0c8cb, 0xfc3ce6cf, 0x255373da, 0xaeb96081, 0xbddda422,
+             0xf608e1f4, 0xadb61e1c, 0xde6e5cb6, 0x4600fe3d, 0xf9d488cf, 0xd559e399, 0x077ea0b5, 0x450b9872,
+             0x608a08b9, 0xeb9f69b2, 0xe3ca8e32, 0x627fcdc6, 0xb3667658, 0x0a2c99f8, 0xb32bdc95, 0x5accc7c7,
+             0xbdafe618, 0xf3507c13, 0x4da4d19a, 0xfd6d5eab, 0x2a8a0250, 0x6c0291d6, 0xc664d945, 0xe0bed057,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x39e60d92, 0xefec0ab2, 0xf3426f76,
+             0xbd93efd9, 0xaaa14479, 0x5ad13838, 0xa6b1ec0d, 0x26916885, 0xd469620a, 0x2ce95454, 0x88bfc06e,
+             0x73e5332b, 0x56620f2e, 0x05a527ae, 0x4b49c529}},
+        {"KEYFRAMES", 558, {27790, 11599, 5287}, 57.56f, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1697, 552, 65}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {33, 77, 663}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 65}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {33, 77, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1697, 552, 664}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {1703, 852, 681}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0x10b83d70, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xc31d471a,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x65629950, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xa043d816, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5}},
+        {"RESET_BLINK", 42951, {27899, 10860, 5203}, 38.51f, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1394, 0, 0},
+             {1374, 0, 0}, {1355, 0, 0}, {1335, 0, 0}, {1316, 0, 0}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {0, 0, 0}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {256, 0, 0},
+             {256, 0, 0}, {255, 0, 0}, {255, 0, 0}, {255, 0, 0}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {14, 67, 63}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1890, 929, 302}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {4090, 0, 0},
+             {4092, 0, 0}, {4093, 0, 0}, {4094, 0, 0}, {4095, 0, 0}, {1703, 554, 63}, {1703, 554, 63},
+             {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 63}, {1703, 554, 664}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658}, {14, 67, 658},
+             {1703, 852, 681}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284},
+             {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {1703, 852, 284}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412},
+             {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}, {4095, 1711, 412}}, {
+             0xda99a8f5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x7b5f9596, 0xc6a6a5d0, 0x3aa0564b,
+             0x95c9125a, 0x526c00a4, 0x0f191ad3, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xe23c87ec,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x538c2775, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0xbeb5a100, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5,
+             0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5}},
+        {"EFFECT_BLINK", 238442, {27444, 11835, 6057}, 46.26f, {
+             {0, 0, 0}, {1637, 618, 118}, {1683, 588, 1}, {1703, 508, 74}, {1703, 495, 112}, {1353, 462, 0},
+             {678, 220, 25}, {2575, 837, 95}, {3829, 1245, 141}, {1451, 472, 53}, {521, 170, 19}, {1467, 477, 54},
+             {3838, 1248, 141}, {2553, 830, 94}, {672, 219, 25}, {780, 254, 29}, {23, 110, 1081}, {28, 136, 1326},
+             {10, 49, 482}, {5, 24, 232}, {30, 143, 1394}, {0, 106, 1050}, {64, 192, 1351}, {77, 174, 1386},
+             {7, 87, 1141}, {0, 50, 728}, {10, 47, 423}, {16, 37, 266}, {6, 26, 222}, {0, 21, 297},
+             {3, 37, 509}, {2277, 1175, 307}, {3398, 1831, 561}, {3882, 2003, 795}, {3432, 1651, 468}, {1394, 662, 239},
+             {770, 527, 249}, {2617, 1421, 251}, {2465, 1308, 639}, {2407, 817, 807}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1153, 824, 289}, {2806, 766, 491}, {3429, 976, 439},
+             {3597, 957, 0}, {3237, 1797, 549}, {3448, 1382, 118}, {3212, 1960, 0}, {3429, 801, 452}, {4095, 1968, 171},
+             {3421, 2338, 476}, {2201, 1400, 612}, {4095, 2129, 347}, {2491, 707, 144}, {3891, 1275, 238}, {3902, 1021, 58}}, {
+             {0, 0, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {1636, 487, 0}, {249, 85, 0},
+             {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {521, 170, 19},
+             {521, 170, 19}, {521, 170, 19}, {521, 170, 19}, {4, 23, 29}, {4, 23, 227}, {4, 23, 227},
+             {4, 23, 227}, {4, 23, 227}, {0, 26, 256}, {0, 69, 1050}, {0, 88, 1330}, {0, 75, 1141},
+             {0, 47, 728}, {0, 27, 422}, {0, 17, 266}, {0, 14, 218}, {0, 14, 219}, {0, 19, 297},
+             {3, 37, 177}, {2271, 1107, 294}, {3376, 1599, 459}, {3434, 1653, 469}, {2486, 1157, 329}, {256, 121, 36},
+             {770, 501, 14}, {840, 401, 115}, {935, 394, 244}, {951, 337, 0}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1153, 608, 182}, {2310, 766, 0}, {2431, 579, 0},
+             {2373, 755, 0}, {2769, 742, 0}, {2248, 947, 0}, {2437, 732, 0}, {2691, 682, 171}, {2466, 857, 0},
+             {2201, 1020, 0}, {2035, 1075, 0}, {2407, 638, 110}, {2491, 707, 26}, {2916, 958, 0}, {2341, 957, 0}}, {
+             {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {1703, 621, 129}, {3971, 1354, 146},
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146},
+             {3971, 1291, 146}, {3971, 1291, 146}, {3971, 1291, 146}, {780, 254, 1440}, {31, 147, 1440}, {31, 147, 1440},
+             {31, 147, 1440}, {31, 147, 1440}, {87, 418, 4088}, {83, 192, 1369}, {87, 204, 1440}, {85, 197, 1411},
+             {67, 156, 1141}, {42, 102, 728}, {24, 60, 426}, {16, 38, 267}, {18, 42, 297}, {30, 68, 507},
+             {2277, 1172, 545}, {3397, 1831, 653}, {3955, 2137, 816}, {3971, 2141, 814}, {3502, 1877, 701}, {4088, 1942, 699},
+             {3073, 1421, 657}, {2617, 1421, 639}, {3031, 1568, 893}, {2407, 1206, 807}, {0, 0, 0}, {0, 0, 0},
+             {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4095, 1756, 717}, {4095, 2241, 1182}, {3597, 2418, 593},
+             {4095, 2225, 845}, {4095, 2514, 851}, {4095, 2241, 1006}, {4095, 2177, 1006}, {4095, 2370, 1080}, {4095, 2482, 1118},
+             {4095, 2338, 893}, {4095, 2129, 1006}, {4095, 2129, 1118}, {4095, 2514, 1063}, {4095, 2418, 909}, {4095, 2000, 689}}, {
+             0xcbda783d, 0x9c2aa7be, 0x0be5c023, 0xb059898a, 0xb19b7caf, 0x505700c2, 0x7dc4b1a4, 0xaff29b72,
+             0xa5ccc4cf, 0x4093ea71, 0x085b39ae, 0xd53b8502, 0x10583bc2, 0x160f592c, 0x5fc30457, 0x22797dbd,
+             0x43945f8b, 0x1b098778, 0xd7c2e52b, 0x6bc309f2, 0x583d2718, 0xee0c30ff, 0xe065a955, 0xe8ca6871,
+             0xe4d43114, 0x1689645f, 0xde22fe5d, 0xf3523a62, 0x764be872, 0xa0e963ee, 0x2a0088d3, 0x98fed47a,
+             0x8572deed, 0x2c0d24db, 0x1c209c11, 0x78443790, 0xa7d27d77, 0x4dc9481b, 0x45189c6b, 0xa2f6df6b,
+             0xd35bc2e0, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x811c9dc5, 0x750511d2, 0x00a91679, 0x3a9a5aac,
+             0xfa5b9e73, 0x511ecf9b, 0x2d6a2101, 0x1919a4f3, 0xc69f2653, 0xc6a1fd4f, 0x4b4c1030, 0x299632e4,
+             0x19271ea9, 0x761714ee, 0x039f0505, 0xa201833e}},
+    },
+};
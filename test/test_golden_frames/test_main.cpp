@@ -0,0 +1,510 @@
+// Golden-frame regression harness for the whole render path. Run with:
+// pio test -e native -f test_golden_frames -v (prints the per-frame cost)
+//
+// Every effect, both blink modes and the LED task's output stage (hardware
+// fades, renderFrame, frame scheduling, dithering) run for GOLDEN_DURATION_MS
+// of virtual time on a fixed seed and a scripted series of Hue commands. The
+// task sleeps exactly as long as it would on the lamp, so an hour of
+// operation takes well under a second. The frames are the firmware's own
+// (ledTaskFrame), fed through the target mailbox and the control queue.
+//
+// For every GOLDEN_SAMPLE_MS minute of the PWM stream the LEDs would show, the
+// duty at its start and the lowest and highest duty during it are compared,
+// with the mean duty and the number of frames rendered, against
+// golden_traces.h with a tolerance. Each minute also carries a hash of every
+// frame in it (time, duty and wait), which the Q16.16 engine must match
+// exactly: its integer pipeline is bit-exact on any host, while float results
+// may move in the last bit with the compiler. Every frame is also checked for
+// NaN and out-of-range values, and the cost per frame (relative to a fixed
+// reference workload, so it carries across hosts) must stay within
+// GOLDEN_COST_LIMIT of the recorded one.
+//
+// Dithering only runs when it is compiled in, so the native-dither build
+// checks its own traces, golden_traces_dither.h, where dim effects run dither
+// steps between their frames.
+//
+// After an intended change to the output, regenerate the goldens of both
+// builds with GOLDEN_UPDATE defined (build_flags = -DGOLDEN_UPDATE) and review
+// the diff.
+
+#include <ColorSpace.h>
+#include <Render.h>
+#include <unity.h>
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if PELARBOJ_DITHER_BITS > 0
+#define GOLDEN_TRACE_FILE "golden_traces_dither.h"
+#else
+#define GOLDEN_TRACE_FILE "golden_traces.h"
+#endif
+#ifndef GOLDEN_TRACE_PATH
+#define GOLDEN_TRACE_PATH "test/test_golden_frames/" GOLDEN_TRACE_FILE
+#endif
+
+const uint32_t GOLDEN_START_MS = 1000;
+const uint32_t GOLDEN_DURATION_MS = 3600000;       // One hour per trace
+const uint32_t GOLDEN_SAMPLE_MS = 60000;           // Samples, envelopes and hashes per minute
+const uint32_t GOLDEN_SAMPLES = GOLDEN_DURATION_MS / GOLDEN_SAMPLE_MS;
+const uint32_t GOLDEN_SEED = 0x601DE7;             // Run seed of every trace
+const int GOLDEN_DUTY_TOLERANCE = 4;               // PWM LSB a sample may move
+const uint32_t GOLDEN_MEAN_TOLERANCE = 2 * 16;     // Mean duty, in 1/16 LSB
+const uint32_t GOLDEN_FRAME_TOLERANCE_PERCENT = 1; // Frames rendered per trace
+const float GOLDEN_COST_LIMIT = 3.0f;              // Slowdown flagged as a regression
+const uint32_t GOLDEN_COST_MIN_FRAMES = 10000;     // Fewer frames are too few to time
+const uint32_t GOLDEN_REFERENCE_CALLS = 4000000;
+const bool GOLDEN_HASH_EXACT[2] = {false, true};   // Per engine: frame hashes must match
+
+// One trace as recorded
+struct GoldenTrace
+{
+  const char *name;
+  uint32_t frames;  // Frames the LED task rendered
+  uint32_t mean[3]; // Time-weighted mean duty, 1/16 LSB
+  float cost;       // ns per frame over ns per reference call
+  uint16_t samples[GOLDEN_SAMPLES][3]; // Duty at the start of each minute
+  uint16_t low[GOLDEN_SAMPLES][3];     // Lowest duty shown during it
+  uint16_t high[GOLDEN_SAMPLES][3];    // Highest
+  uint32_t hashes[GOLDEN_SAMPLES];     // Every frame started during it
+};
+
+#ifndef GOLDEN_UPDATE
+#include GOLDEN_TRACE_FILE
+#endif
+
+// Scripted Hue commands, the same for every trace
+struct GoldenCommand
+{
+  uint32_t atMs; // Since the trace started
+  uint8_t r, g, b;
+  uint16_t mireds; // Color temperature instead of r, g, b when non-zero
+  uint8_t level;
+  bool state;
+  uint32_t transitionMs;
+};
+
+const GoldenCommand GOLDEN_COMMANDS[] = {
+    {0, 200, 120, 40, 0, 180, true, 1000},
+    {900000, 40, 90, 255, 0, 120, true, 4000}, // Long fade to a cool color
+    {1800000, 6, 3, 1, 0, 180, true, 1000},    // Near black
+    {2400000, 6, 3, 1, 0, 180, false, 2000},   // Off
+    {2700000, 0, 0, 0, 370, 255, true, 500},   // Back on, warm white
+};
+
+// Button presses of the blink traces
+struct GoldenPress
+{
+  uint32_t atMs;
+  ControlEventType type;
+};
+
+const GoldenPress RESET_PRESSES[] = {{300000, CONTROL_RESET_START}, {600000, CONTROL_RESET_CANCEL}};
+const GoldenPress EFFECT_PRESSES[] = {
+    {300000, CONTROL_NEXT_EFFECT}, {1200000, CONTROL_NEXT_EFFECT}, {2100000, CONTROL_NEXT_EFFECT}};
+
+struct GoldenScenario
+{
+  const char *name;
+  EffectType effect;
+  const GoldenPress *presses;
+  size_t pressCount;
+};
+
+const size_t GOLDEN_SCENARIOS = MAX_EFFECT_NUMBER + 2;
+
+static GoldenScenario goldenScenario(size_t index)
+{
+  if (index < MAX_EFFECT_NUMBER)
+  {
+    GoldenScenario scenario = {effectName((EffectType)index), (EffectType)index, nullptr, 0};
+    return scenario;
+  }
+  if (index == MAX_EFFECT_NUMBER)
+  {
+    GoldenScenario scenario = {"RESET_BLINK", EFFECT_NONE, RESET_PRESSES,
+                               sizeof(RESET_PRESSES) / sizeof(RESET_PRESSES[0])};
+    return scenario;
+  }
+  GoldenScenario scenario = {"EFFECT_BLINK", EFFECT_COLOR_WANDER, EFFECT_PRESSES,
+                             sizeof(EFFECT_PRESSES) / sizeof(EFFECT_PRESSES[0])};
+  return scenario;
+}
+
+static LightTargets commandTargets(const GoldenCommand &command)
+{
+  WorkingColor color =
+      command.mireds != 0 ? colorFromMireds(command.mireds) : colorFromRgb8(command.r, command.g, command.b);
+  LightTargets targets = {color.r, color.g, color.b, command.level, command.state, command.transitionMs};
+  return targets;
+}
+
+// What one simulated hour produced
+struct GoldenRun
+{
+  uint32_t frames;
+  double dutyTime[3]; // Duty integrated over time
+  uint16_t samples[GOLDEN_SAMPLES][3];
+  uint16_t low[GOLDEN_SAMPLES][3];
+  uint16_t high[GOLDEN_SAMPLES][3];
+  uint32_t hashes[GOLDEN_SAMPLES];
+  uint32_t violations; // Frames with a NaN or out-of-range value
+  char firstViolation[160];
+  double ns; // Wall time of the simulation
+};
+
+template <typename Scalar>
+static bool scalarValid(Scalar value)
+{
+  float asFloat = scalarToFloat(value);
+  return !isnan(asFloat) && asFloat >= 0.0f && asFloat <= 255.0f;
+}
+
+template <typename Scalar>
+static void checkFrame(GoldenRun &run, const LightStateT<Scalar> &light, const PwmOutput &pwm, uint32_t now)
+{
+  bool valid = scalarValid(light.final_r) && scalarValid(light.final_g) && scalarValid(light.final_b) &&
+               scalarValid(light.final_level) && pwm.r <= LED_PWM_MAX_VALUE && pwm.g <= LED_PWM_MAX_VALUE &&
+               pwm.b <= LED_PWM_MAX_VALUE;
+  if (!valid && run.violations++ == 0)
+  {
+    snprintf(run.firstViolation, sizeof(run.firstViolation), "at %lu ms: final %.9g %.9g %.9g L%.9g pwm %u %u %u",
+             (unsigned long)(now - GOLDEN_START_MS), scalarToFloat(light.final_r), scalarToFloat(light.final_g),
+             scalarToFloat(light.final_b), scalarToFloat(light.final_level), pwm.r, pwm.g, pwm.b);
+  }
+}
+
+// The LEDs ramp linearly from `from` to `to` over [start, start + length) (a
+// constant output when they are equal); account for [start, until)
+static void recordOutput(GoldenRun &run, const PwmOutput &from, const PwmOutput &to, uint32_t start,
+                         uint32_t length, uint32_t until)
+{
+  const uint16_t fromDuty[3] = {from.r, from.g, from.b};
+  const uint16_t toDuty[3] = {to.r, to.g, to.b};
+  uint32_t offset = start - GOLDEN_START_MS;
+  uint32_t sample = (offset + GOLDEN_SAMPLE_MS - 1) / GOLDEN_SAMPLE_MS;
+  for (; sample < GOLDEN_SAMPLES && sample * GOLDEN_SAMPLE_MS < until - GOLDEN_START_MS; sample++)
+  {
+    uint32_t into = sample * GOLDEN_SAMPLE_MS - offset;
+    for (int channel = 0; channel < 3; channel++)
+    {
+      int32_t ramp = ((int32_t)toDuty[channel] - fromDuty[channel]) * (int32_t)into / (int32_t)length;
+      run.samples[sample][channel] = (uint16_t)(fromDuty[channel] + ramp);
+    }
+  }
+
+  // Mean duty over the span: the ramp's trapezoid, then the end value held.
+  // The envelope of every minute the span touches takes in both ends.
+  uint32_t span = until - start;
+  uint32_t ramped = span < length ? span : length;
+  uint32_t firstMinute = offset / GOLDEN_SAMPLE_MS;
+  uint32_t lastMinute = (until - GOLDEN_START_MS - 1) / GOLDEN_SAMPLE_MS;
+  for (int channel = 0; channel < 3; channel++)
+  {
+    double reached = fromDuty[channel] + ((double)toDuty[channel] - fromDuty[channel]) * ramped / length;
+    run.dutyTime[channel] += (fromDuty[channel] + reached) * 0.5 * ramped + (double)toDuty[channel] * (span - ramped);
+
+    int32_t rise = ((int32_t)toDuty[channel] - fromDuty[channel]) * (int32_t)ramped / (int32_t)length;
+    uint16_t reachedDuty = (uint16_t)(fromDuty[channel] + rise);
+    uint16_t low = min(fromDuty[channel], reachedDuty);
+    uint16_t high = max(fromDuty[channel], reachedDuty);
+    for (uint32_t minute = firstMinute; minute <= lastMinute && minute < GOLDEN_SAMPLES; minute++)
+    {
+      run.low[minute][channel] = min(run.low[minute][channel], low);
+      run.high[minute][channel] = max(run.high[minute][channel], high);
+    }
+  }
+}
+
+// FNV-1a over what a frame asked of the LEDs, into its minute's hash
+static void hashFrame(GoldenRun &run, uint32_t now, const LedFrame &frame)
+{
+  const uint32_t words[] = {now - GOLDEN_START_MS, frame.pwm.r, frame.pwm.g, frame.pwm.b, frame.wait, frame.fade};
+  uint32_t &hash = run.hashes[(now - GOLDEN_START_MS) / GOLDEN_SAMPLE_MS];
+  for (uint32_t word : words)
+  {
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+      hash = (hash ^ ((word >> shift) & 0xFF)) * 16777619u;
+    }
+  }
+}
+
+// The LED task from main.cpp, with the Zigbee and button tasks replaced by
+// the script, the LEDC by the recorder and the waits by jumps of the virtual
+// clock. A scripted event ends a wait early, as its notification would.
+template <typename Scalar>
+static void simulate(const GoldenScenario &scenario, GoldenRun &run)
+{
+  memset(&run, 0, sizeof(run));
+  for (uint32_t minute = 0; minute < GOLDEN_SAMPLES; minute++)
+  {
+    run.hashes[minute] = 2166136261u;
+    for (int channel = 0; channel < 3; channel++)
+    {
+      run.low[minute][channel] = LED_PWM_MAX_VALUE;
+    }
+  }
+  LightStateT<Scalar> light = LightStateT<Scalar>();
+  EffectStateT<Scalar> effect = EffectStateT<Scalar>();
+  effect.seed = GOLDEN_SEED;
+  effectStart(effect, scenario.effect, GOLDEN_START_MS);
+  hostSetMillis(GOLDEN_START_MS);
+
+  TargetMailbox mailbox = {{0}, {0}, {0}, {0}};
+  ControlQueue queue = {{0}, {0}, {}};
+  LedTaskState task;
+  ledTaskStart(task, GOLDEN_START_MS);
+
+  const size_t commandCount = sizeof(GOLDEN_COMMANDS) / sizeof(GOLDEN_COMMANDS[0]);
+  size_t nextCommand = 0, nextPress = 0;
+  const uint32_t end = GOLDEN_START_MS + GOLDEN_DURATION_MS;
+  PwmOutput shown = {0, 0, 0};
+  uint32_t now = GOLDEN_START_MS;
+
+  auto started = std::chrono::steady_clock::now();
+  while (now < end)
+  {
+    while (nextCommand < commandCount && GOLDEN_START_MS + GOLDEN_COMMANDS[nextCommand].atMs <= now)
+    {
+      targetMailboxPublish(mailbox, commandTargets(GOLDEN_COMMANDS[nextCommand++]));
+    }
+    while (nextPress < scenario.pressCount && GOLDEN_START_MS + scenario.presses[nextPress].atMs <= now)
+    {
+      ControlEvent event = {scenario.presses[nextPress++].type};
+      controlQueuePush(queue, event);
+    }
+
+    // Until the next scripted event, which would notify the task
+    uint64_t notify = end;
+    if (nextCommand < commandCount)
+    {
+      notify = min(notify, (uint64_t)GOLDEN_START_MS + GOLDEN_COMMANDS[nextCommand].atMs);
+    }
+    if (nextPress < scenario.pressCount)
+    {
+      notify = min(notify, (uint64_t)GOLDEN_START_MS + scenario.presses[nextPress].atMs);
+    }
+
+    run.frames++;
+    LedFrame frame = ledTaskFrame(task, light, effect, mailbox, queue, now, true);
+    checkFrame(run, light, frame.pwm, now);
+    hashFrame(run, now, frame);
+    uint32_t rampLength = frame.fade ? frame.wait : 1;
+    if (!frame.fade)
+    {
+      shown = frame.pwm;
+    }
+
+    uint64_t wake =
+        frame.wait == FRAME_INTERVAL_IDLE ? notify : min(notify, (uint64_t)now + max(frame.wait, 1u));
+    recordOutput(run, shown, frame.pwm, now, rampLength, (uint32_t)wake);
+    if (frame.fade)
+    {
+      // Where the LEDC got to when the segment ended or was stopped
+      uint32_t faded = (uint32_t)wake - now < rampLength ? (uint32_t)wake - now : rampLength;
+      const PwmOutput &to = frame.pwm;
+      PwmOutput stopped = {(uint16_t)(shown.r + ((int32_t)to.r - shown.r) * (int32_t)faded / (int32_t)rampLength),
+                           (uint16_t)(shown.g + ((int32_t)to.g - shown.g) * (int32_t)faded / (int32_t)rampLength),
+                           (uint16_t)(shown.b + ((int32_t)to.b - shown.b) * (int32_t)faded / (int32_t)rampLength)};
+      shown = stopped;
+    }
+    now = (uint32_t)wake;
+    hostSetMillis(now);
+  }
+  run.ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started).count();
+}
+
+// Wall time of a fixed integer workload (the sine table, as the effects use
+// it), so frame costs compare across hosts
+static double referenceNs()
+{
+  auto start = std::chrono::steady_clock::now();
+  int32_t checksum = 0;
+  for (uint32_t i = 0; i < GOLDEN_REFERENCE_CALLS; i++)
+  {
+    checksum += sineRaw(i * 2654435761u);
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  TEST_ASSERT_TRUE(checksum != 0x7FFFFFFF); // Keeps the optimizer from discarding the calls
+  return ns / GOLDEN_REFERENCE_CALLS;
+}
+
+static uint32_t meanDuty16(const GoldenRun &run, int channel)
+{
+  return (uint32_t)(run.dutyTime[channel] * 16.0 / GOLDEN_DURATION_MS + 0.5);
+}
+
+static float frameCost(const GoldenRun &run, double reference)
+{
+  return (float)(run.ns / run.frames / reference);
+}
+
+#ifndef GOLDEN_UPDATE
+// Fails on the first duty of a minute further than the tolerance from golden
+static void checkDuties(const uint16_t (&duties)[GOLDEN_SAMPLES][3], const uint16_t (&golden)[GOLDEN_SAMPLES][3],
+                        const char *what, const char *engine, const char *name)
+{
+  for (uint32_t sample = 0; sample < GOLDEN_SAMPLES; sample++)
+  {
+    for (int channel = 0; channel < 3; channel++)
+    {
+      if (abs((int)duties[sample][channel] - (int)golden[sample][channel]) > GOLDEN_DUTY_TOLERANCE)
+      {
+        char message[256];
+        snprintf(message, sizeof(message), "%s %s: minute %lu channel %d %s duty %u, golden %u", engine, name,
+                 (unsigned long)sample, channel, what, duties[sample][channel], golden[sample][channel]);
+        TEST_FAIL_MESSAGE(message);
+        return;
+      }
+    }
+  }
+}
+
+static void checkTrace(const GoldenRun &run, const char *name, const GoldenTrace &golden, int engine,
+                       const char *engineName, double reference)
+{
+  char message[256];
+  snprintf(message, sizeof(message), "%s %s", engineName, golden.name);
+  TEST_ASSERT_EQUAL_STRING_MESSAGE(golden.name, name, "golden traces are out of date, regenerate with -DGOLDEN_UPDATE");
+
+  if (run.violations > 0)
+  {
+    snprintf(message, sizeof(message), "%s %s: %lu invalid frames, first %s", engineName, golden.name,
+             (unsigned long)run.violations, run.firstViolation);
+  }
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, run.violations, message);
+
+  uint32_t frameTolerance = golden.frames * GOLDEN_FRAME_TOLERANCE_PERCENT / 100 + 1;
+  TEST_ASSERT_UINT32_WITHIN_MESSAGE(frameTolerance, golden.frames, run.frames, message);
+  for (int channel = 0; channel < 3; channel++)
+  {
+    TEST_ASSERT_UINT32_WITHIN_MESSAGE(GOLDEN_MEAN_TOLERANCE, golden.mean[channel], meanDuty16(run, channel),
+                                      message);
+  }
+  checkDuties(run.samples, golden.samples, "start", engineName, golden.name);
+  checkDuties(run.low, golden.low, "lowest", engineName, golden.name);
+  checkDuties(run.high, golden.high, "highest", engineName, golden.name);
+  for (uint32_t minute = 0; GOLDEN_HASH_EXACT[engine] && minute < GOLDEN_SAMPLES; minute++)
+  {
+    if (run.hashes[minute] != golden.hashes[minute])
+    {
+      snprintf(message, sizeof(message), "%s %s: frames of minute %lu differ from golden", engineName, golden.name,
+               (unsigned long)minute);
+      TEST_FAIL_MESSAGE(message);
+      break;
+    }
+  }
+
+  float cost = frameCost(run, reference);
+  if (run.frames >= GOLDEN_COST_MIN_FRAMES && cost > golden.cost * GOLDEN_COST_LIMIT)
+  {
+    snprintf(message, sizeof(message), "%s %s: frame cost %.2f references, golden %.2f", engineName, golden.name,
+             cost, golden.cost);
+    TEST_FAIL_MESSAGE(message);
+  }
+}
+#else
+static void writeDuties(FILE *update, const uint16_t (&duties)[GOLDEN_SAMPLES][3], bool last)
+{
+  for (uint32_t sample = 0; sample < GOLDEN_SAMPLES; sample++)
+  {
+    fprintf(update, "%s{%u, %u, %u}", sample % 6 == 0 ? "\n             " : " ", duties[sample][0],
+            duties[sample][1], duties[sample][2]);
+    fprintf(update, sample + 1 < GOLDEN_SAMPLES ? "," : last ? "}" : "}, {");
+  }
+}
+#endif
+
+static void printRun(const GoldenRun &run, const char *engine, const char *name, double reference)
+{
+  printf("%-6s %-20s %8lu %10.1f %8.2f\n", engine, name, (unsigned long)run.frames, run.ns / run.frames,
+         frameCost(run, reference));
+}
+
+template <typename Scalar>
+static void runEngine(int engine, const char *engineName, double reference, FILE *update)
+{
+  Serial.muted = true;
+  printf("\n%-6s %-20s %8s %10s %8s\n", "engine", "trace", "frames", "ns/frame", "cost");
+  if (update != nullptr)
+  {
+    fprintf(update, "    {\n");
+  }
+  for (size_t index = 0; index < GOLDEN_SCENARIOS; index++)
+  {
+    GoldenScenario scenario = goldenScenario(index);
+    static GoldenRun run;
+    simulate<Scalar>(scenario, run);
+    printRun(run, engineName, scenario.name, reference);
+
+#ifndef GOLDEN_UPDATE
+    checkTrace(run, scenario.name, GOLDEN_TRACES[engine][index], engine, engineName, reference);
+#else
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, run.violations, run.firstViolation);
+    fprintf(update, "        {\"%s\", %lu, {%lu, %lu, %lu}, %.2ff, {", scenario.name, (unsigned long)run.frames,
+            (unsigned long)meanDuty16(run, 0), (unsigned long)meanDuty16(run, 1), (unsigned long)meanDuty16(run, 2),
+            frameCost(run, reference));
+    writeDuties(update, run.samples, false);
+    writeDuties(update, run.low, false);
+    writeDuties(update, run.high, true);
+    fprintf(update, ", {");
+    for (uint32_t minute = 0; minute < GOLDEN_SAMPLES; minute++)
+    {
+      fprintf(update, "%s0x%08lx", minute % 8 == 0 ? "\n             " : " ", (unsigned long)run.hashes[minute]);
+      fprintf(update, minute + 1 < GOLDEN_SAMPLES ? "," : "}},\n");
+    }
+#endif
+  }
+  if (update != nullptr)
+  {
+    fprintf(update, "    },\n");
+  }
+  Serial.muted = false;
+}
+
+void test_golden_frames()
+{
+  double reference = referenceNs();
+  printf("\nreference: %.2f ns/call, %lu traces of %lu s\n", reference, (unsigned long)GOLDEN_SCENARIOS,
+         (unsigned long)(GOLDEN_DURATION_MS / 1000));
+
+#ifdef GOLDEN_UPDATE
+  FILE *update = fopen(GOLDEN_TRACE_PATH, "w");
+  TEST_ASSERT_NOT_NULL_MESSAGE(update, "cannot write " GOLDEN_TRACE_PATH);
+  fprintf(update, "// Golden traces for test_golden_frames, recorded with -DGOLDEN_UPDATE. Do not edit.\n\n");
+  fprintf(update, "static_assert(OUTPUT_DITHER_BITS == %d, \"recorded with PELARBOJ_DITHER_BITS=%d\");\n\n",
+          OUTPUT_DITHER_BITS, OUTPUT_DITHER_BITS);
+  fprintf(update, "const GoldenTrace GOLDEN_TRACES[2][%lu] = {\n", (unsigned long)GOLDEN_SCENARIOS);
+#else
+  FILE *update = nullptr;
+#endif
+
+  runEngine<float>(0, "float", reference, update);
+  runEngine<Fix16>(1, "Q16.16", reference, update);
+
+  if (update != nullptr)
+  {
+    fprintf(update, "};\n");
+    fclose(update);
+    printf("\nWrote %s\n", GOLDEN_TRACE_PATH);
+  }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_golden_frames);
+  return UNITY_END();
+}
@@ -0,0 +1,173 @@
+// Hardware (LEDC) fades for plain transitions: the segments the LED task
+// programs must follow the software transition. Run with:
+// pio test -e native -f test_hardware_fade
+
+#include <Render.h>
+#include <unity.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+const uint32_t FADE_START_MS = 1000;
+
+static LightState transitionFrom(uint8_t r, uint8_t g, uint8_t b, uint8_t level)
+{
+  LightState light = LightState();
+  light.base_r = RenderScalar(r);
+  light.base_g = RenderScalar(g);
+  light.base_b = RenderScalar(b);
+  light.base_level = RenderScalar(level);
+  light.base_state = true;
+  light.target_state = true;
+  light.final_r = light.base_r;
+  light.final_g = light.base_g;
+  light.final_b = light.base_b;
+  light.final_level = light.base_level;
+  return light;
+}
+
+void test_fade_applies_only_to_plain_transitions()
+{
+  LightState light = transitionFrom(0, 0, 0, 0);
+  LightTargets targets = {255 * 257, 80 * 257, 0, 200, true};
+  applyTargets(light, targets);
+  EffectState effect = EffectState();
+  effect.type = EFFECT_NONE;
+  TEST_ASSERT_TRUE(hardwareFadeApplies(light, effect));
+
+  effect.type = EFFECT_BREATHING;
+  TEST_ASSERT_FALSE(hardwareFadeApplies(light, effect)); // Needs per-frame modulation
+  effect.type = EFFECT_NONE;
+
+  light.specialMode = MODE_EFFECT_BLINKING;
+  TEST_ASSERT_FALSE(hardwareFadeApplies(light, effect));
+  light.specialMode = MODE_NORMAL;
+
+  LightTargets off = {255 * 257, 80 * 257, 0, 200, false};
+  applyTargets(light, off);
+  TEST_ASSERT_FALSE(hardwareFadeApplies(light, effect)); // Turning off is immediate
+
+  LightState settled = transitionFrom(255, 80, 0, 200);
+  applyTargets(settled, targets);
+  TEST_ASSERT_FALSE(hardwareFadeApplies(settled, effect)); // Nothing left to fade
+}
+
+// advanceBase() over a long gap lands where 20 ms frames would
+void test_advance_matches_frames()
+{
+  LightState stepped = transitionFrom(10, 200, 30, 40);
+  LightState jumped = stepped;
+  LightTargets targets = {240 * 257, 20 * 257, 90 * 257, 255, true, 2000};
+  applyTargets(stepped, targets);
+  applyTargets(jumped, targets);
+
+  EffectState effect = EffectState();
+  FrameClock clock = {FADE_START_MS, 0};
+  for (int frame = 0; frame < 30; frame++)
+  {
+    frameClockAdvance(clock, clock.now + LED_UPDATE_RATE_MS);
+    renderFrame(stepped, effect, clock);
+  }
+  advanceBase(jumped, 30 * LED_UPDATE_RATE_MS);
+
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, scalarToFloat(stepped.base_r), scalarToFloat(jumped.base_r));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, scalarToFloat(stepped.base_g), scalarToFloat(jumped.base_g));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, scalarToFloat(stepped.base_level), scalarToFloat(jumped.base_level));
+}
+
+static int maxChannelDifference(const PwmOutput &a, const PwmOutput &b)
+{
+  return max(abs(a.r - b.r), max(abs(a.g - b.g), abs(a.b - b.b)));
+}
+
+// Replay the LED task's fade loop against the transition curve sampled every
+// millisecond: each segment is a straight line from its start to its end duty.
+// staircase is how far the 50 FPS software path itself strays from the curve
+// between frames.
+static int fadeDeviation(LightState start, const LightTargets &targets, uint32_t &segments, int &staircase)
+{
+  LightState software = start;
+  LightState hardware = start;
+  applyTargets(software, targets);
+  applyTargets(hardware, targets);
+  EffectState effect = EffectState();
+  effect.type = EFFECT_NONE;
+
+  int worst = 0;
+  segments = 0;
+  staircase = 0;
+  uint32_t elapsed = 0;
+  PwmOutput duty = computeOutput(hardware);
+  PwmOutput frame = duty;
+  while (hardwareFadeApplies(hardware, effect))
+  {
+    PwmOutput end;
+    uint32_t length = planFadeSegment(hardware, end);
+    segments++;
+    for (uint32_t t = 1; t <= length; t++)
+    {
+      applyHardwareFade(software, 1);
+      PwmOutput expected = computeOutput(software);
+      if (++elapsed % LED_UPDATE_RATE_MS == 0)
+      {
+        frame = expected;
+      }
+      staircase = max(staircase, maxChannelDifference(expected, frame));
+      PwmOutput linear = {(uint16_t)(duty.r + ((int)end.r - duty.r) * (int)t / (int)length),
+                          (uint16_t)(duty.g + ((int)end.g - duty.g) * (int)t / (int)length),
+                          (uint16_t)(duty.b + ((int)end.b - duty.b) * (int)t / (int)length)};
+      worst = max(worst, maxChannelDifference(expected, linear));
+    }
+    applyHardwareFade(hardware, length);
+    duty = end;
+  }
+  // Ends exactly where the software path settles
+  TEST_ASSERT_EQUAL_INT(0, maxChannelDifference(duty, computeOutput(software)));
+  return worst;
+}
+
+void test_segments_follow_software_transition()
+{
+  struct
+  {
+    LightState start;
+    LightTargets targets;
+  } cases[] = {
+      {transitionFrom(0, 0, 0, 0), {255 * 257, 160 * 257, 40 * 257, 255, true}},    // Off-black to a bright warm color
+      {transitionFrom(255, 255, 255, 255), {0, 0, 255 * 257, 30, true}},          // Bright white to dim blue
+      {transitionFrom(200, 50, 10, 128), {190 * 257, 60 * 257, 10 * 257, 140, true}}, // Small nudge
+      {transitionFrom(0, 0, 0, 0), {255 * 257, 200 * 257, 120 * 257, 255, true, 3000}}, // Slow commanded transition
+  };
+
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+  {
+    uint32_t segments;
+    int staircase;
+    int worst = fadeDeviation(cases[i].start, cases[i].targets, segments, staircase);
+    char message[80];
+    snprintf(message, sizeof(message), "case %u: %d LSB (frames %d) over %u segments", (unsigned)i, worst,
+             staircase, (unsigned)segments);
+
+    // Never further off than the tolerance, or than 50 FPS rendering already is
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(max(2 * FADE_MAX_DEVIATION, staircase), worst, message);
+    // A fraction of the ~100 frames the software path renders
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(25, segments, message);
+  }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_fade_applies_only_to_plain_transitions);
+  RUN_TEST(test_advance_matches_frames);
+  RUN_TEST(test_segments_follow_software_transition);
+  return UNITY_END();
+}
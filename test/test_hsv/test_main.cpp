@@ -0,0 +1,175 @@
+// Integer HSV kernels and the rainbow built on them. Run with:
+// pio test -e native -f test_hsv -v (prints the per-call cost)
+
+#include <Render.h>
+#include <unity.h>
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+const uint32_t HSV_START_MS = 1000;
+
+// Every 8-bit color comes back unchanged
+void test_round_trip_is_exact()
+{
+  uint32_t mismatches = 0;
+  for (uint32_t rgb = 0; rgb < (1u << 24); rgb++)
+  {
+    uint8_t r = rgb >> 16, g = rgb >> 8, b = rgb;
+    uint8_t r2, g2, b2;
+    hsvToRgb(rgbToHsv(r, g, b), r2, g2, b2);
+    mismatches += r != r2 || g != g2 || b != b2;
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, mismatches);
+}
+
+void test_greys_and_primaries()
+{
+  for (int value = 0; value < 256; value++)
+  {
+    HsvColor grey = rgbToHsv(value, value, value);
+    TEST_ASSERT_EQUAL_UINT16(0, grey.hue);
+    TEST_ASSERT_EQUAL_UINT8(0, grey.saturation);
+    TEST_ASSERT_EQUAL_UINT8(value, grey.value);
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(0, rgbToHsv(255, 0, 0).hue);
+  TEST_ASSERT_UINT32_WITHIN(1, HSV_HUE_TURN / 6, rgbToHsv(255, 255, 0).hue);
+  TEST_ASSERT_UINT32_WITHIN(1, HSV_HUE_TURN / 3, rgbToHsv(0, 255, 0).hue);
+  TEST_ASSERT_UINT32_WITHIN(1, HSV_HUE_TURN / 2, rgbToHsv(0, 255, 255).hue);
+  TEST_ASSERT_UINT32_WITHIN(1, HSV_HUE_TURN * 2 / 3, rgbToHsv(0, 0, 255).hue);
+  TEST_ASSERT_UINT32_WITHIN(1, HSV_HUE_TURN * 5 / 6, rgbToHsv(255, 0, 255).hue);
+  TEST_ASSERT_EQUAL_UINT8(255, rgbToHsv(255, 0, 255).saturation);
+
+  // Plain hues at full brightness, no common-anode inversion
+  uint32_t r, g, b;
+  hueToRGB(HSV_HUE_TURN / 3, 255, r, g, b);
+  TEST_ASSERT_EQUAL_UINT32(0, r);
+  TEST_ASSERT_EQUAL_UINT32(255, g);
+  TEST_ASSERT_EQUAL_UINT32(0, b);
+  hueToRGB(0, 100, r, g, b);
+  TEST_ASSERT_EQUAL_UINT32(100, r);
+  TEST_ASSERT_EQUAL_UINT32(0, g);
+}
+
+// Around the whole circle the color moves smoothly, wrapping through red, and
+// each hue comes back within one channel step
+void test_hue_circle_is_continuous()
+{
+  uint8_t previous[3];
+  HsvColor start = {0, 255, 255};
+  hsvToRgb(start, previous[0], previous[1], previous[2]);
+  for (uint32_t hue = 1; hue <= HSV_HUE_TURN; hue++)
+  {
+    HsvColor color = {(uint16_t)hue, 255, 255};
+    uint8_t rgb[3];
+    hsvToRgb(color, rgb[0], rgb[1], rgb[2]);
+    for (int channel = 0; channel < 3; channel++)
+    {
+      TEST_ASSERT_UINT32_WITHIN(1, previous[channel], rgb[channel]);
+      previous[channel] = rgb[channel];
+    }
+
+    int32_t back = rgbToHsv(rgb[0], rgb[1], rgb[2]).hue;
+    int32_t error = (int16_t)(back - (int32_t)(uint16_t)hue);
+    TEST_ASSERT_TRUE(abs(error) <= (int32_t)(HSV_HUE_TURN / 6 / 255 / 2 + 1));
+  }
+}
+
+static void renderRainbowFrames(EffectState &state, RenderScalar r, RenderScalar g, RenderScalar b, uint32_t from,
+                                uint32_t frames, RenderScalar out[3])
+{
+  for (uint32_t frame = 0; frame < frames; frame++)
+  {
+    WorkingColor target = {(uint16_t)(scalarToInt(r) * 257), (uint16_t)(scalarToInt(g) * 257),
+                           (uint16_t)(scalarToInt(b) * 257)};
+    FrameContextT<RenderScalar> context = {from + frame * RAINBOW_FRAME_MS, RAINBOW_FRAME_MS, r, g, b,
+                                           RenderScalar(200), target};
+    RenderScalar level;
+    applyEffects(state, context, out[0], out[1], out[2], level);
+    for (int channel = 0; channel < 3; channel++)
+    {
+      float value = scalarToFloat(out[channel]);
+      TEST_ASSERT_FALSE(isnan(value));
+      TEST_ASSERT_TRUE(value >= 0.0f && value <= 255.0f);
+    }
+  }
+}
+
+// A grey base used to divide by zero; the base HSV is only taken again when
+// the target color changes
+void test_rainbow_on_any_base()
+{
+  EffectState state = EffectState();
+  effectStart(state, EFFECT_RAINBOW, HSV_START_MS);
+  RenderScalar out[3];
+
+  renderRainbowFrames(state, RenderScalar(128), RenderScalar(128), RenderScalar(128), HSV_START_MS, 500, out);
+  TEST_ASSERT_TRUE(state.slot.data.rainbow.valid);
+  TEST_ASSERT_EQUAL_UINT8(0, state.slot.data.rainbow.base.saturation);
+
+  renderRainbowFrames(state, RenderScalar(0), RenderScalar(0), RenderScalar(0), HSV_START_MS + 20000, 10, out);
+  TEST_ASSERT_EQUAL_UINT8(0, state.slot.data.rainbow.base.value);
+
+  renderRainbowFrames(state, RenderScalar(0), RenderScalar(200), RenderScalar(40), HSV_START_MS + 30000, 10, out);
+  TEST_ASSERT_EQUAL_UINT16(rgbToHsv(0, 200, 40).hue, state.slot.data.rainbow.base.hue);
+  TEST_ASSERT_TRUE(scalarToFloat(out[1]) > 180.0f); // Still mostly the green base
+}
+
+template <typename Function>
+static double nsPerCall(Function function, uint32_t calls)
+{
+  auto start = std::chrono::steady_clock::now();
+  uint32_t checksum = 0;
+  for (uint32_t i = 0; i < calls; i++)
+  {
+    checksum += function(i * 2654435761u);
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / calls;
+  TEST_ASSERT_TRUE(checksum != 0xFFFFFFFF); // Keeps the optimizer from discarding the calls
+  return ns;
+}
+
+void test_bench_hsv()
+{
+  const uint32_t calls = 2000000;
+  double toHsv = nsPerCall(
+      [](uint32_t rgb) {
+        HsvColor color = rgbToHsv(rgb >> 16, rgb >> 8, rgb);
+        return (uint32_t)color.hue + color.saturation + color.value;
+      },
+      calls);
+  double toRgb = nsPerCall(
+      [](uint32_t hsv) {
+        HsvColor color = {(uint16_t)hsv, (uint8_t)(hsv >> 16), (uint8_t)(hsv >> 24)};
+        uint8_t r, g, b;
+        hsvToRgb(color, r, g, b);
+        return (uint32_t)r + g + b;
+      },
+      calls);
+
+  printf("\n%-20s %10s\n", "kernel", "ns/call");
+  printf("%-20s %10.1f\n", "rgbToHsv", toHsv);
+  printf("%-20s %10.1f\n", "hsvToRgb", toRgb);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip_is_exact);
+  RUN_TEST(test_greys_and_primaries);
+  RUN_TEST(test_hue_circle_is_continuous);
+  RUN_TEST(test_rainbow_on_any_base);
+  RUN_TEST(test_bench_hsv);
+  return UNITY_END();
+}
@@ -0,0 +1,112 @@
+// Render loop instrumentation: histograms, wake lateness and the diagnostics
+// attribute encoding. Run with: pio test -e native -f test_instrumentation
+
+#include <Instrumentation.h>
+#include <unity.h>
+
+const uint32_t FRAME_MS = 20; // Timed wait of a full rate frame
+
+void test_buckets_are_powers_of_two()
+{
+  TEST_ASSERT_EQUAL_UINT32(0, histogramBucket(0));
+  TEST_ASSERT_EQUAL_UINT32(1, histogramBucket(1));
+  TEST_ASSERT_EQUAL_UINT32(2, histogramBucket(2));
+  TEST_ASSERT_EQUAL_UINT32(2, histogramBucket(3));
+  TEST_ASSERT_EQUAL_UINT32(11, histogramBucket(1024));
+  TEST_ASSERT_EQUAL_UINT32(HISTOGRAM_BUCKETS - 1, histogramBucket(UINT32_MAX));
+}
+
+void test_percentiles()
+{
+  Histogram histogram = {};
+  TEST_ASSERT_EQUAL_UINT32(0, histogramPercentile(histogram, 99));
+
+  // 98 fast frames around 3000 cycles, two slow ones
+  for (int i = 0; i < 98; i++)
+  {
+    histogramAdd(histogram, 3000 + i);
+  }
+  histogramAdd(histogram, 40000);
+  histogramAdd(histogram, 50000);
+
+  TEST_ASSERT_EQUAL_UINT32(100, histogramCount(histogram));
+  TEST_ASSERT_EQUAL_UINT32(4095, histogramPercentile(histogram, 50)); // Upper bound of [2048, 4096)
+  TEST_ASSERT_EQUAL_UINT32(50000, histogramPercentile(histogram, 99)); // Capped at the worst value
+  TEST_ASSERT_EQUAL_UINT32(50000, histogram.worst);
+}
+
+void test_lateness_counts_timed_waits_only()
+{
+  Instrumentation instr = {};
+  instrumentFrameStart(instr, 0, 0, false); // First frame: no wait before it
+  instrumentFrameEnd(instr, 500, 80000, FRAME_MS);
+
+  // Woke 300 us after the 20 ms timeout
+  instrumentFrameStart(instr, 500 + 20300, 100000, false);
+  instrumentFrameEnd(instr, 21000, 160000, FRAME_MS);
+
+  // Woken early by a notification
+  instrumentFrameStart(instr, 25000, 200000, true);
+  instrumentFrameEnd(instr, 25500, 210000, 0);
+
+  // Waited for a notification only
+  instrumentFrameStart(instr, 900000, 300000, true);
+  instrumentFrameEnd(instr, 900500, 310000, FRAME_MS);
+
+  // The tick ended the wait early
+  instrumentFrameStart(instr, 900500 + 19900, 400000, false);
+
+  InstrumentationStats stats = instrumentationSnapshot(instr);
+  TEST_ASSERT_EQUAL_UINT32(2, histogramCount(stats.wakeLatenessUs));
+  TEST_ASSERT_EQUAL_UINT32(300, stats.wakeLatenessUs.worst);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.wakeLatenessUs.counts[0]);
+
+  TEST_ASSERT_EQUAL_UINT32(4, histogramCount(stats.frameCycles));
+  TEST_ASSERT_EQUAL_UINT32(80000, stats.frameCycles.worst);
+}
+
+void test_diagnostics_encoding()
+{
+  Instrumentation instr = {};
+  instrumentFrameStart(instr, 0, 0, false);
+  instrumentFrameEnd(instr, 100, 16000, 0); // 100 us at 160 MHz
+  instrumentPublish(instr, 1600);
+  instrumentMailboxRetry(instr);
+  instrumentControlDrop(instr);
+  instrumentControlDrop(instr);
+
+  DiagnosticsSummary summary = diagnosticsSummarize(instrumentationSnapshot(instr), 160, 700, 1800);
+  TEST_ASSERT_EQUAL_UINT32(1, summary.frames);
+  TEST_ASSERT_EQUAL_UINT16(100, summary.frameWorstUs);
+  TEST_ASSERT_EQUAL_UINT16(10, summary.publishWorstUs);
+
+  uint8_t buffer[DIAGNOSTICS_ENCODED_SIZE + 1];
+  buffer[DIAGNOSTICS_ENCODED_SIZE] = 0xA5;
+  diagnosticsEncode(summary, buffer);
+  TEST_ASSERT_EQUAL_UINT8(DIAGNOSTICS_VERSION, buffer[0]);
+  TEST_ASSERT_EQUAL_UINT8(1, buffer[1]);    // frames, little-endian
+  TEST_ASSERT_EQUAL_UINT8(100, buffer[9]);  // frameWorstUs
+  TEST_ASSERT_EQUAL_UINT8(1, buffer[21]);   // mailboxRetries
+  TEST_ASSERT_EQUAL_UINT8(2, buffer[25]);   // controlDrops
+  TEST_ASSERT_EQUAL_UINT8(1800 & 0xFF, buffer[31]);
+  TEST_ASSERT_EQUAL_UINT8(1800 >> 8, buffer[32]);
+  TEST_ASSERT_EQUAL_UINT8(0xA5, buffer[DIAGNOSTICS_ENCODED_SIZE]); // Nothing written past the end
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_buckets_are_powers_of_two);
+  RUN_TEST(test_percentiles);
+  RUN_TEST(test_lateness_counts_timed_waits_only);
+  RUN_TEST(test_diagnostics_encoding);
+  return UNITY_END();
+}
@@ -0,0 +1,272 @@
+// Keyframe track validation, interpolation and constant-cost lookups. Run with:
+// pio test -e native -f test_keyframes -v
+
+#include <Keyframes.h>
+#include <StateStore.h>
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+const uint32_t KEYFRAMES_START_MS = 1000;
+
+// Track image, laid out like tools/keyframe_encode.py writes it. The buckets
+// are the largest that keep every lookup within the probe bound, unless
+// forcedShift sets them.
+static std::vector<uint8_t> encodeTrack(const std::vector<Keyframe> &keys, uint32_t duration, bool loop,
+                                        int forcedShift = -1)
+{
+  std::vector<uint32_t> index;
+  uint8_t shift = forcedShift >= 0 ? forcedShift + 1 : 17;
+  bool fits = false;
+  while (!fits && shift-- > 0)
+  {
+    index.assign((duration >> shift) + 1, 0);
+    uint32_t active = 0;
+    for (uint32_t bucket = 0; bucket < index.size(); bucket++)
+    {
+      while (active + 1 < keys.size() && keys[active + 1].time <= bucket << shift)
+      {
+        active++;
+      }
+      index[bucket] = active;
+    }
+    fits = true;
+    for (uint32_t bucket = 0; bucket < index.size(); bucket++)
+    {
+      uint32_t next = bucket + 1 < index.size() ? index[bucket + 1] : keys.size() - 1;
+      fits = fits && next - index[bucket] <= KEYFRAME_MAX_PER_BUCKET;
+    }
+    fits = fits || forcedShift >= 0;
+  }
+
+  std::vector<uint8_t> image = {'P', 'K', 'F', KEYFRAME_VERSION, (uint8_t)(loop ? KEYFRAME_FLAG_LOOP : 0), shift, 0, 0};
+  auto putLe = [&image](uint32_t value, int bytes)
+  {
+    for (int i = 0; i < bytes; i++)
+    {
+      image.push_back((value >> (8 * i)) & 0xFF);
+    }
+  };
+  putLe(keys.size(), 4);
+  putLe(duration, 4);
+  putLe(index.size(), 4);
+  image.push_back(crc8(image.data(), image.size()));
+  putLe(0, 3);
+  for (uint32_t entry : index)
+  {
+    putLe(entry, 4);
+  }
+  for (const Keyframe &key : keys)
+  {
+    putLe(key.time, 3);
+    image.insert(image.end(), {key.curve, key.r, key.g, key.b, key.level});
+  }
+  return image;
+}
+
+static const std::vector<Keyframe> SHORT_TRACK = {
+    {0, KEYFRAME_LINEAR, 0, 0, 0, 100},
+    {1000, KEYFRAME_STEP, 200, 100, 50, 200},
+    {2000, KEYFRAME_SMOOTH, 100, 100, 100, 100},
+    {3000, KEYFRAME_LINEAR, 0, 0, 0, 0},
+};
+
+void test_open_rejects_bad_tracks()
+{
+  KeyframeTrack track;
+  std::vector<uint8_t> image = encodeTrack(SHORT_TRACK, 4000, false);
+  TEST_ASSERT_TRUE(keyframeOpen(track, image.data(), image.size()));
+  TEST_ASSERT_EQUAL_UINT32(4, track.keyCount);
+
+  TEST_ASSERT_FALSE(keyframeOpen(track, image.data(), image.size() - 1)); // Cut short
+  TEST_ASSERT_EQUAL_UINT32(0, track.keyCount);
+  std::vector<uint8_t> bad = image;
+  bad[12] ^= 1; // Duration changed: header CRC fails
+  TEST_ASSERT_FALSE(keyframeOpen(track, bad.data(), bad.size()));
+
+  // An erased partition reads as 0xFF
+  std::vector<uint8_t> erased(4096, 0xFF);
+  TEST_ASSERT_FALSE(keyframeOpen(track, erased.data(), erased.size()));
+
+  std::vector<Keyframe> keys = SHORT_TRACK;
+  keys[2].time = 900; // Out of order
+  image = encodeTrack(keys, 4000, false);
+  TEST_ASSERT_FALSE(keyframeOpen(track, image.data(), image.size()));
+  keys = SHORT_TRACK;
+  keys[1].curve = KEYFRAME_CURVE_COUNT;
+  image = encodeTrack(keys, 4000, false);
+  TEST_ASSERT_FALSE(keyframeOpen(track, image.data(), image.size()));
+
+  image = encodeTrack(SHORT_TRACK, 4000, false);
+  image[KEYFRAME_HEADER_SIZE] = 3; // First bucket points past its keyframe
+  TEST_ASSERT_FALSE(keyframeOpen(track, image.data(), image.size()));
+}
+
+void test_overloaded_bucket_is_rejected()
+{
+  // Six keyframes inside one bucket would need more probes than allowed
+  std::vector<Keyframe> keys;
+  for (uint32_t i = 0; i < 6; i++)
+  {
+    keys.push_back({i * 10, KEYFRAME_LINEAR, 0, 0, 0, 0});
+  }
+  std::vector<uint8_t> image = encodeTrack(keys, 50, false);
+  KeyframeTrack track;
+  TEST_ASSERT_TRUE(keyframeOpen(track, image.data(), image.size()));
+  image = encodeTrack(keys, 50, false, 10); // One 1024 ms bucket for all of them
+  TEST_ASSERT_FALSE(keyframeOpen(track, image.data(), image.size()));
+}
+
+template <typename Scalar>
+static EffectOutputT<Scalar> sample(const KeyframeTrack &track, uint32_t t)
+{
+  EffectOutputT<Scalar> out;
+  keyframeSample(track, t, out);
+  return out;
+}
+
+template <typename Scalar>
+static void checkInterpolation()
+{
+  KeyframeTrack track;
+  std::vector<uint8_t> image = encodeTrack(SHORT_TRACK, 4000, false);
+  TEST_ASSERT_TRUE(keyframeOpen(track, image.data(), image.size()));
+
+  EffectOutputT<Scalar> out = sample<Scalar>(track, 500); // Linear, halfway
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, scalarToFloat(out.r));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 150.0f, scalarToFloat(out.level));
+  out = sample<Scalar>(track, 1999); // Step holds
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 200.0f, scalarToFloat(out.r));
+  out = sample<Scalar>(track, 2250); // Smoothstep a quarter of the way: 15.6%
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 100.0f - 100.0f * 0.15625f, scalarToFloat(out.r));
+  out = sample<Scalar>(track, keyframeTrackTime(track, 10000)); // Past the end: held
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, scalarToFloat(out.level));
+}
+
+void test_interpolation()
+{
+  checkInterpolation<float>();
+  checkInterpolation<Fix16>();
+}
+
+void test_loop_and_frame_intervals()
+{
+  KeyframeTrack track;
+  std::vector<uint8_t> image = encodeTrack(SHORT_TRACK, 4000, true);
+  TEST_ASSERT_TRUE(keyframeOpen(track, image.data(), image.size()));
+  TEST_ASSERT_EQUAL_UINT32(500, keyframeTrackTime(track, 8500));
+
+  TEST_ASSERT_EQUAL_UINT32(KEYFRAME_FRAME_MS, keyframeFrameInterval(track, 500)); // Interpolating
+  TEST_ASSERT_EQUAL_UINT32(400, keyframeFrameInterval(track, 1600));              // Step: until the next keyframe
+  TEST_ASSERT_EQUAL_UINT32(700, keyframeFrameInterval(track, 3300));              // Last keyframe: until the wrap
+
+  image = encodeTrack(SHORT_TRACK, 4000, false);
+  TEST_ASSERT_TRUE(keyframeOpen(track, image.data(), image.size()));
+  TEST_ASSERT_EQUAL_UINT32(EFFECT_FRAME_STATIC, keyframeFrameInterval(track, keyframeTrackTime(track, 5000)));
+}
+
+void test_effect_plays_track_over_base_level()
+{
+  FrameContextT<RenderScalar> frame = {KEYFRAMES_START_MS, 20, RenderScalar(10), RenderScalar(20), RenderScalar(30),
+                                       RenderScalar(128), {10 * 257, 20 * 257, 30 * 257}};
+  EffectState state = EffectState();
+  effectStart(state, EFFECT_KEYFRAMES, KEYFRAMES_START_MS);
+  RenderScalar r, g, b, level;
+
+  // Nothing mapped yet: the base shows
+  keyframeActive.store(nullptr);
+  frame.now = KEYFRAMES_START_MS + 500;
+  applyEffects(state, frame, r, g, b, level);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 10.0f, scalarToFloat(r));
+  TEST_ASSERT_EQUAL_UINT32(EFFECT_FRAME_STATIC, effectFrameInterval(state, frame.now));
+
+  std::vector<uint8_t> image = encodeTrack(SHORT_TRACK, 4000, false);
+  KeyframeTrack track;
+  TEST_ASSERT_TRUE(keyframeOpen(track, image.data(), image.size()));
+  keyframeActive.store(&track);
+  applyEffects(state, frame, r, g, b, level);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, scalarToFloat(r));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.0f, scalarToFloat(g));
+  TEST_ASSERT_FLOAT_WITHIN(0.1f, 150.0f * 128 / 255, scalarToFloat(level)); // Dimmed with the Hue level
+  keyframeActive.store(nullptr);
+}
+
+// Irregularly spaced keyframes, as a long choreography would have
+static std::vector<Keyframe> longTrack(uint32_t count)
+{
+  std::vector<Keyframe> keys;
+  uint32_t time = 0;
+  randomSeed(7);
+  for (uint32_t i = 0; i < count; i++)
+  {
+    keys.push_back({time, (uint8_t)(i % KEYFRAME_CURVE_COUNT), (uint8_t)random(256), (uint8_t)random(256),
+                    (uint8_t)random(256), (uint8_t)random(256)});
+    time += 5 + random(0, 200);
+  }
+  return keys;
+}
+
+static double nsPerSample(const KeyframeTrack &track, uint32_t samples)
+{
+  float checksum = 0.0f;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < samples; i++)
+  {
+    EffectOutputT<Fix16> out;
+    keyframeSample(track, keyframeTrackTime(track, (unsigned long)i * 20), out);
+    checksum += out.r.toFloat();
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / samples;
+  TEST_ASSERT_FALSE(checksum < 0.0f);
+  return ns;
+}
+
+void test_lookup_cost_is_constant()
+{
+  std::vector<uint8_t> small = encodeTrack(longTrack(16), 2000, true);
+  std::vector<Keyframe> keys = longTrack(100000);
+  std::vector<uint8_t> large = encodeTrack(keys, keys.back().time, true);
+  KeyframeTrack smallTrack, largeTrack;
+  TEST_ASSERT_TRUE(keyframeOpen(smallTrack, small.data(), small.size()));
+  TEST_ASSERT_TRUE(keyframeOpen(largeTrack, large.data(), large.size()));
+
+  // Every position in the large track is found within the probe bound
+  uint32_t worst = 0;
+  for (uint32_t t = 0; t <= largeTrack.durationMs; t += 7)
+  {
+    uint32_t probes;
+    uint32_t index = keyframeFind(largeTrack, t, &probes);
+    TEST_ASSERT_TRUE(keyframeAt(largeTrack, index).time <= t);
+    TEST_ASSERT_TRUE(index + 1 == largeTrack.keyCount || keyframeAt(largeTrack, index + 1).time > t);
+    worst = max(worst, probes);
+  }
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(KEYFRAME_MAX_PER_BUCKET, worst);
+
+  printf("\n%-28s %10s %10s\n", "track", "bytes", "ns/frame");
+  printf("%-28s %10zu %10.1f\n", "16 keyframes", small.size(), nsPerSample(smallTrack, 200000));
+  printf("%-28s %10zu %10.1f\n", "100000 keyframes", large.size(), nsPerSample(largeTrack, 200000));
+  printf("(%u ms buckets in the large track, at most %lu probes)\n", 1u << largeTrack.bucketShift,
+         (unsigned long)worst);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_open_rejects_bad_tracks);
+  RUN_TEST(test_overloaded_bucket_is_rejected);
+  RUN_TEST(test_interpolation);
+  RUN_TEST(test_loop_and_frame_intervals);
+  RUN_TEST(test_effect_plays_track_over_base_level);
+  RUN_TEST(test_lookup_cost_is_constant);
+  return UNITY_END();
+}
@@ -0,0 +1,139 @@
+// Deferred logging ring. Run with: pio test -e native -f test_log
+
+#include <Log.h>
+#include <unity.h>
+
+#include <thread>
+#include <vector>
+
+static LogRing ring;
+
+static LogRecord makeRecord(const char *format, uintptr_t first, uintptr_t second = 0)
+{
+  LogRecord record = {format, LOG_LEVEL_INFO, {first, second, 0, 0}};
+  return record;
+}
+
+void setUp()
+{
+  ring.head.store(0);
+  ring.tail.store(0);
+  ring.dropped.store(0);
+  for (LogSlot &slot : ring.slots)
+  {
+    slot.sequence.store(0);
+  }
+}
+
+void tearDown()
+{
+}
+
+void test_records_come_out_in_order()
+{
+  LogRecord record;
+  TEST_ASSERT_FALSE(logPop(ring, record));
+
+  // Several laps around the ring
+  for (uintptr_t i = 0; i < 5 * LOG_RING_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(logPush(ring, makeRecord("%u\n", i)));
+    TEST_ASSERT_TRUE(logPush(ring, makeRecord("%u\n", i + 1000)));
+    TEST_ASSERT_TRUE(logPop(ring, record));
+    TEST_ASSERT_EQUAL_UINT32(i, record.args[0]);
+    TEST_ASSERT_TRUE(logPop(ring, record));
+    TEST_ASSERT_EQUAL_UINT32(i + 1000, record.args[0]);
+  }
+  TEST_ASSERT_FALSE(logPop(ring, record));
+  TEST_ASSERT_EQUAL_UINT32(0, ring.dropped.load());
+}
+
+void test_full_ring_drops_and_counts()
+{
+  for (uintptr_t i = 0; i < LOG_RING_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(logPush(ring, makeRecord("%u\n", i)));
+  }
+  TEST_ASSERT_FALSE(logPush(ring, makeRecord("%u\n", 99)));
+  TEST_ASSERT_FALSE(logPush(ring, makeRecord("%u\n", 99)));
+  TEST_ASSERT_EQUAL_UINT32(2, ring.dropped.load());
+
+  // The oldest records survive, and a popped slot takes new ones again
+  LogRecord record;
+  TEST_ASSERT_TRUE(logPop(ring, record));
+  TEST_ASSERT_EQUAL_UINT32(0, record.args[0]);
+  TEST_ASSERT_TRUE(logPush(ring, makeRecord("%u\n", 100)));
+
+  Serial.muted = true;
+  TEST_ASSERT_EQUAL_UINT32(LOG_RING_SIZE, logDrain(ring));
+  Serial.muted = false;
+}
+
+void test_log_macros_store_raw_arguments()
+{
+  int before = (int)logRing.head.load();
+  LOG_INFO("Switched to effect: %d %s\n", -3, "NAME");
+  LOG_DEBUG("Compiled out at the default level: %d\n", 1);
+
+  LogRecord record;
+  TEST_ASSERT_EQUAL_INT(before + 1, (int)logRing.head.load());
+  TEST_ASSERT_TRUE(logPop(logRing, record));
+  TEST_ASSERT_EQUAL_UINT8(LOG_LEVEL_INFO, record.level);
+  TEST_ASSERT_EQUAL_INT(-3, (int)record.args[0]);
+  TEST_ASSERT_EQUAL_STRING("NAME", (const char *)record.args[1]);
+}
+
+// Producers on real threads racing a consumer: each producer's records arrive
+// in order, and every record is either delivered or counted as dropped
+void test_concurrent_producers()
+{
+  const int PRODUCERS = 3;
+  const uintptr_t RECORDS = 20000;
+  std::vector<std::thread> producers;
+  for (int p = 0; p < PRODUCERS; p++)
+  {
+    producers.emplace_back([p]()
+                           {
+                             for (uintptr_t i = 0; i < RECORDS; i++)
+                             {
+                               logPush(ring, makeRecord("%u %u\n", (uintptr_t)p, i));
+                             }
+                           });
+  }
+
+  uintptr_t next[PRODUCERS] = {0, 0, 0};
+  uint32_t delivered = 0;
+  bool ordered = true;
+  std::thread consumer([&]()
+                       {
+                         LogRecord record;
+                         while (delivered + ring.dropped.load() < PRODUCERS * RECORDS)
+                         {
+                           if (logPop(ring, record))
+                           {
+                             ordered = ordered && record.args[1] >= next[record.args[0]];
+                             next[record.args[0]] = record.args[1] + 1;
+                             delivered++;
+                           }
+                         }
+                       });
+
+  for (std::thread &producer : producers)
+  {
+    producer.join();
+  }
+  consumer.join();
+  TEST_ASSERT_TRUE(ordered);
+  TEST_ASSERT_EQUAL_UINT32(PRODUCERS * RECORDS, delivered + ring.dropped.load());
+  TEST_ASSERT_TRUE(delivered > 0);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_records_come_out_in_order);
+  RUN_TEST(test_full_ring_drops_and_counts);
+  RUN_TEST(test_log_macros_store_raw_arguments);
+  RUN_TEST(test_concurrent_producers);
+  return UNITY_END();
+}
@@ -0,0 +1,116 @@
+// Oscillator bank and quarter-wave sine table.
+// Run with: pio test -e native -f test_oscillator
+
+#include <Oscillator.h>
+#include <unity.h>
+
+#include <math.h>
+
+void test_table_end_points()
+{
+  TEST_ASSERT_EQUAL_INT32(0, SINE_QUARTER_WAVE.values[0]);
+  TEST_ASSERT_EQUAL_INT32(65536, SINE_QUARTER_WAVE.values[SINE_TABLE_SIZE]);
+  TEST_ASSERT_EQUAL_INT32(46341, SINE_QUARTER_WAVE.values[SINE_TABLE_SIZE / 2]); // sin(PI/4)
+}
+
+void test_sine_symmetry()
+{
+  for (Phase phase = 0; phase < 0x40000000; phase += 0x00100001)
+  {
+    int32_t value = sineRaw(phase);
+    TEST_ASSERT_EQUAL_INT32(value, sineRaw(0x80000000u - phase)); // sin(PI - x)
+    TEST_ASSERT_EQUAL_INT32(-value, sineRaw(0u - phase));         // sin(-x)
+  }
+}
+
+void test_registration_and_lookup()
+{
+  OscillatorBank bank;
+  oscillatorBankReset(bank);
+
+  TEST_ASSERT_EQUAL_UINT8(0, oscillatorRegister(bank, "slow", phaseStep(0.01f)));
+  TEST_ASSERT_EQUAL_UINT8(1, oscillatorRegister(bank, "fast", phaseStep(0.5f)));
+  TEST_ASSERT_EQUAL_INT(1, oscillatorFind(bank, "fast"));
+  TEST_ASSERT_EQUAL_INT(-1, oscillatorFind(bank, "missing"));
+
+  // A full bank never writes past its storage
+  oscillatorRegister(bank, "third", 1);
+  oscillatorRegister(bank, "fourth", 1);
+  TEST_ASSERT_EQUAL_UINT8(MAX_OSCILLATORS - 1, oscillatorRegister(bank, "overflow", 1));
+  TEST_ASSERT_EQUAL_UINT8(MAX_OSCILLATORS, bank.count);
+}
+
+void test_phases_wrap_without_drift()
+{
+  OscillatorBank bank;
+  oscillatorBankReset(bank);
+  bank.epoch = 1000;
+  uint8_t index = oscillatorRegister(bank, "quarter", 0x40000000);
+
+  // Four milliseconds of a quarter turn land exactly back on zero, forever
+  oscillatorBankSeek(bank, 1000 + 4000);
+  TEST_ASSERT_EQUAL_UINT32(0, bank.oscillators[index].phase);
+
+  oscillatorBankSeek(bank, 1000 + 4001);
+  TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, oscillatorSample<float>(bank, index));
+  TEST_ASSERT_EQUAL_INT32(65536, oscillatorSample<Fix16>(bank, index).raw);
+
+  // The clock itself may wrap (millis() after ~49 days)
+  bank.epoch = 0xFFFFFFFF;
+  oscillatorBankSeek(bank, 0);
+  TEST_ASSERT_EQUAL_UINT32(0x40000000, bank.oscillators[index].phase);
+}
+
+void test_step_matches_radians()
+{
+  OscillatorBank bank;
+  oscillatorBankReset(bank);
+  uint8_t index = oscillatorRegister(bank, "wander", phaseStep(0.013f));
+
+  for (uint32_t ms = 997; ms <= 100000; ms += 997)
+  {
+    oscillatorBankSeek(bank, ms);
+    float expected = (float)sin(fmod(ms * (double)0.013f, 2 * M_PI));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, expected, oscillatorSample<float>(bank, index));
+  }
+}
+
+void test_seek_is_independent_of_frame_rate()
+{
+  OscillatorBank coarse, fine;
+  oscillatorBankReset(coarse);
+  oscillatorBankReset(fine);
+  oscillatorRegister(coarse, "slow", phaseStep(0.0005f));
+  oscillatorRegister(fine, "slow", phaseStep(0.0005f));
+
+  // 7 ms frames against 61 ms frames: same phase wherever they meet
+  for (uint32_t ms = 0; ms <= 7 * 61 * 50; ms += 7)
+  {
+    oscillatorBankSeek(fine, ms);
+    if (ms % 61 == 0)
+    {
+      oscillatorBankSeek(coarse, ms);
+      TEST_ASSERT_EQUAL_UINT32(fine.oscillators[0].phase, coarse.oscillators[0].phase);
+    }
+  }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_table_end_points);
+  RUN_TEST(test_sine_symmetry);
+  RUN_TEST(test_registration_and_lookup);
+  RUN_TEST(test_phases_wrap_without_drift);
+  RUN_TEST(test_step_matches_radians);
+  RUN_TEST(test_seek_is_independent_of_frame_rate);
+  return UNITY_END();
+}
@@ -0,0 +1,178 @@
+// Perceptual output table and the integer output stage.
+// Run with: pio test -e native -f test_output_lut
+
+#include <Render.h>
+#include <unity.h>
+
+#include <math.h>
+
+// Reference CIE L* -> luminance conversion in double precision
+static double referenceLuminance(double lightness)
+{
+  if (lightness <= 0.08)
+  {
+    return lightness / 9.033;
+  }
+  return pow((lightness + 0.16) / 1.16, 3.0);
+}
+
+void test_table_end_points()
+{
+  TEST_ASSERT_EQUAL_UINT16(0, OUTPUT_LUT.values[0]);
+  TEST_ASSERT_EQUAL_UINT16(LED_PWM_MAX_VALUE << OUTPUT_LUT_FRACTION_BITS, OUTPUT_LUT.values[OUTPUT_LUT_SIZE]);
+  TEST_ASSERT_EQUAL_UINT16(0, outputLookup(0));
+  TEST_ASSERT_EQUAL_UINT16(LED_PWM_MAX_VALUE, outputLookup(OUTPUT_INTENSITY_MAX));
+  TEST_ASSERT_EQUAL_UINT16(LED_PWM_MAX_VALUE, outputLookup(OUTPUT_INTENSITY_MAX + 1000));
+}
+
+void test_lookup_is_monotonic()
+{
+  uint32_t previous = 0;
+  for (uint32_t intensity = 0; intensity <= OUTPUT_INTENSITY_MAX; intensity++)
+  {
+    uint32_t duty = outputLookupFine(intensity);
+    TEST_ASSERT_TRUE(duty >= previous);
+    previous = duty;
+  }
+}
+
+void test_lookup_follows_cie_lightness()
+{
+  double worst = 0.0;
+  for (uint32_t intensity = 0; intensity <= OUTPUT_INTENSITY_MAX; intensity += 7)
+  {
+    double expected = referenceLuminance(intensity / 65536.0) * LED_PWM_MAX_VALUE;
+    worst = fmax(worst, fabs(outputLookup(intensity) - expected));
+  }
+  // Half a step of rounding plus the chord error of the interpolation
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 0.0f, (float)worst);
+
+  TEST_ASSERT_EQUAL_UINT16(754, outputLookup(OUTPUT_INTENSITY_MAX / 2)); // L* 50 is 18.4% luminance
+}
+
+void test_intensity_scaling()
+{
+  TEST_ASSERT_EQUAL_UINT32(OUTPUT_INTENSITY_MAX, outputIntensity(255 << 16));
+  TEST_ASSERT_EQUAL_UINT32(0, outputIntensity(0));
+  TEST_ASSERT_EQUAL_UINT32(OUTPUT_INTENSITY_MAX / 2, outputIntensity(255 << 15));
+
+  // Channels scale the duty linearly, exactly at the ends
+  const uint32_t full = LED_PWM_MAX_VALUE << OUTPUT_LUT_FRACTION_BITS;
+  TEST_ASSERT_EQUAL_UINT32(full, outputScale(full, 255 << 16));
+  TEST_ASSERT_EQUAL_UINT32(0, outputScale(full, 0));
+  TEST_ASSERT_UINT32_WITHIN(1, full / 2, outputScale(full, 255 << 15));
+}
+
+void test_compute_output()
+{
+  LightStateT<Fix16> light = LightStateT<Fix16>();
+  light.specialMode = MODE_NORMAL;
+  light.base_state = true;
+  light.final_r = Fix16(255);
+  light.final_g = Fix16(0);
+  light.final_b = Fix16(300); // Out of range values are clamped
+  light.final_level = Fix16(255);
+
+  PwmOutput pwm = computeOutput(light);
+  TEST_ASSERT_EQUAL_UINT16(LED_PWM_MAX_VALUE, pwm.r);
+  TEST_ASSERT_EQUAL_UINT16(0, pwm.g);
+  TEST_ASSERT_EQUAL_UINT16(LED_PWM_MAX_VALUE, pwm.b);
+
+  // Channels are linear shares of the level's duty, not renormalised
+  light.final_r = Fix16(10);
+  light.final_g = Fix16(0);
+  light.final_b = Fix16(0);
+  light.final_level = Fix16(255);
+  pwm = computeOutput(light);
+  TEST_ASSERT_UINT32_WITHIN(1, LED_PWM_MAX_VALUE * 10 / 255, pwm.r);
+
+  // Off in normal mode, but special modes ignore base_state
+  light.base_state = false;
+  pwm = computeOutput(light);
+  TEST_ASSERT_EQUAL_UINT16(0, pwm.r);
+  light.specialMode = MODE_RESET_BLINKING;
+  pwm = computeOutput(light);
+  TEST_ASSERT_EQUAL_UINT16(outputRound(outputScale(outputLookupFine(OUTPUT_INTENSITY_MAX), 10 << 16)), pwm.r);
+}
+
+// Fine duty rounded to OUTPUT_DITHER_BITS of fraction, in 2^-bits PWM steps
+static uint32_t ditherTarget(uint32_t fine)
+{
+  const int drop = OUTPUT_LUT_FRACTION_BITS - OUTPUT_DITHER_BITS;
+  return (fine + ((1 << drop) >> 1)) >> drop;
+}
+
+void test_dither_averages_to_fine_duty()
+{
+  const uint32_t period = 1 << OUTPUT_DITHER_BITS;
+  const uint32_t fines[] = {0, 1, 5, 13, 17, 22, 100, 1000, 30001, LED_PWM_MAX_VALUE << OUTPUT_LUT_FRACTION_BITS};
+  for (size_t i = 0; i < sizeof(fines) / sizeof(fines[0]); i++)
+  {
+    uint16_t residual = 0;
+    uint32_t sum = 0;
+    for (uint32_t frame = 0; frame < 4 * period; frame++)
+    {
+      uint16_t duty = outputDither(fines[i], residual);
+      // Never more than one step from the exact duty, never past the top
+      TEST_ASSERT_UINT32_WITHIN(1, fines[i] >> OUTPUT_LUT_FRACTION_BITS, duty);
+      TEST_ASSERT_TRUE(duty <= LED_PWM_MAX_VALUE);
+      TEST_ASSERT_TRUE(residual < period);
+      sum += duty;
+    }
+    // Whole periods reproduce the duty at OUTPUT_DITHER_BITS more bits
+    TEST_ASSERT_EQUAL_UINT32(4 * ditherTarget(fines[i]), sum);
+  }
+}
+
+void test_dither_resolves_dim_levels()
+{
+  // A dim red pulsing by a quarter level: rounding maps both levels onto one
+  // step, dithering keeps them apart on average
+  LightStateT<Fix16> light = LightStateT<Fix16>();
+  light.base_state = true;
+  light.final_r = Fix16(255);
+  light.final_level = Fix16(10.0f);
+  PwmOutput lower = computeOutput(light);
+  light.final_level = Fix16(10.25f);
+  PwmOutput upper = computeOutput(light);
+
+  const uint32_t period = 1 << OUTPUT_DITHER_BITS;
+  uint32_t sums[2] = {0, 0};
+  for (int step = 0; step < 2; step++)
+  {
+    light.final_level = step == 0 ? Fix16(10.0f) : Fix16(10.25f);
+    DitherState dither = {{0, 0, 0}};
+    for (uint32_t frame = 0; frame < period; frame++)
+    {
+      sums[step] += computeOutputDithered(light, dither).r;
+    }
+  }
+  uint32_t expected = ditherTarget(outputScale(outputLookupFine(outputIntensity(10 << 16)), 255 << 16));
+  TEST_ASSERT_EQUAL_UINT32(expected, sums[0]);
+  if (OUTPUT_DITHER_BITS >= 2)
+  {
+    TEST_ASSERT_EQUAL_UINT16(lower.r, upper.r); // Same step when rounded...
+    TEST_ASSERT_TRUE(sums[1] > sums[0]);        // ...but not when dithered
+  }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_table_end_points);
+  RUN_TEST(test_lookup_is_monotonic);
+  RUN_TEST(test_lookup_follows_cie_lightness);
+  RUN_TEST(test_intensity_scaling);
+  RUN_TEST(test_compute_output);
+  RUN_TEST(test_dither_averages_to_fine_duty);
+  RUN_TEST(test_dither_resolves_dim_levels);
+  return UNITY_END();
+}
@@ -0,0 +1,216 @@
+// Per-effect random streams: replay from a seed, ranges and cost. Run with:
+// pio test -e native -f test_prng -v (prints the per-draw cost)
+
+#include <Effects.h>
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+const uint32_t PRNG_START_MS = 1000;
+const uint32_t PRNG_FRAME_MS = 10;
+const uint32_t PRNG_DURATION_MS = 120000; // Long enough for every effect to draw many times
+
+struct FrameOutput
+{
+  int32_t r, g, b, level;
+
+  bool operator==(const FrameOutput &other) const
+  {
+    return r == other.r && g == other.g && b == other.b && level == other.level;
+  }
+};
+
+void test_same_seed_same_stream()
+{
+  Prng first, second, other;
+  prngSeed(first, 0xDEADBEEF);
+  prngSeed(second, 0xDEADBEEF);
+  prngSeed(other, 0xDEADBEEE);
+  int differences = 0;
+  for (int i = 0; i < 1000; i++)
+  {
+    uint32_t value = prngNext(first);
+    TEST_ASSERT_EQUAL_UINT32(value, prngNext(second));
+    differences += value != prngNext(other);
+  }
+  TEST_ASSERT_TRUE(differences > 990);
+
+  // Zero is a seed like any other
+  Prng zero;
+  prngSeed(zero, 0);
+  uint32_t orBits = 0;
+  for (int i = 0; i < 32; i++)
+  {
+    orBits |= prngNext(zero);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFF, orBits);
+
+  // Derived streams differ from their parent and from each other
+  TEST_ASSERT_TRUE(prngStreamSeed(1, 0) != prngStreamSeed(1, 1));
+  TEST_ASSERT_TRUE(prngStreamSeed(1, 0) != prngStreamSeed(2, 0));
+}
+
+void test_ranges()
+{
+  Prng prng;
+  prngSeed(prng, 42);
+
+  // Both ends of [low, high) are reached and nothing outside
+  int32_t lowest = 1000, highest = -1000;
+  const int BUCKETS = 10;
+  const int DRAWS = 100000;
+  int counts[BUCKETS] = {};
+  for (int i = 0; i < DRAWS; i++)
+  {
+    int32_t value = prngRange(prng, -50, 51);
+    lowest = value < lowest ? value : lowest;
+    highest = value > highest ? value : highest;
+    counts[prngRange(prng, 0, BUCKETS)]++;
+  }
+  TEST_ASSERT_EQUAL_INT32(-50, lowest);
+  TEST_ASSERT_EQUAL_INT32(50, highest);
+  for (int bucket = 0; bucket < BUCKETS; bucket++)
+  {
+    TEST_ASSERT_INT32_WITHIN(DRAWS / BUCKETS / 20, DRAWS / BUCKETS, counts[bucket]);
+  }
+
+  TEST_ASSERT_EQUAL_INT32(7, prngRange(prng, 7, 7)); // Empty range
+  TEST_ASSERT_EQUAL_INT32(7, prngRange(prng, 7, 3));
+
+  float sum = 0.0f;
+  for (int i = 0; i < DRAWS; i++)
+  {
+    float unit = prngUnit<float>(prng);
+    Fix16 fixedUnit = prngUnit<Fix16>(prng);
+    TEST_ASSERT_TRUE(unit >= 0.0f && unit < 1.0f);
+    TEST_ASSERT_TRUE(fixedUnit.raw >= 0 && fixedUnit.raw < 65536);
+    sum += unit;
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.5f, sum / DRAWS);
+}
+
+// Render an effect from a run seed, optionally disturbing the shared
+// random() and running a second effect in between every frame
+template <typename Scalar>
+static void renderTrace(EffectType type, uint32_t seed, bool disturb, std::vector<FrameOutput> &trace)
+{
+  EffectStateT<Scalar> state = EffectStateT<Scalar>();
+  state.seed = seed;
+  effectStart(state, type, PRNG_START_MS);
+  EffectStateT<Scalar> neighbour = EffectStateT<Scalar>();
+  effectStart(neighbour, EFFECT_BROKEN_ELECTRICITY, PRNG_START_MS);
+
+  trace.clear();
+  for (uint32_t t = 0; t < PRNG_DURATION_MS; t += PRNG_FRAME_MS)
+  {
+    FrameContextT<Scalar> frame = {PRNG_START_MS + t, PRNG_FRAME_MS, Scalar(200), Scalar(120), Scalar(40),
+                                   Scalar(180), {200 * 257, 120 * 257, 40 * 257}};
+    Scalar r, g, b, level;
+    if (disturb)
+    {
+      random(0, 1000);
+      applyEffects(neighbour, frame, r, g, b, level);
+    }
+    applyEffects(state, frame, r, g, b, level);
+    FrameOutput output = {scalarToRaw(r), scalarToRaw(g), scalarToRaw(b), scalarToRaw(level)};
+    trace.push_back(output);
+  }
+}
+
+// What a lamp showed comes back bit-exact from its seed, whatever else drew
+// random numbers meanwhile; another seed shows something else
+template <typename Scalar>
+static void checkReplay(EffectType type)
+{
+  std::vector<FrameOutput> lamp, replay, otherSeed;
+  renderTrace<Scalar>(type, 0x5EED1234, true, lamp);
+  renderTrace<Scalar>(type, 0x5EED1234, false, replay);
+  renderTrace<Scalar>(type, 0x5EED1235, false, otherSeed);
+
+  TEST_ASSERT_TRUE(lamp == replay);
+  TEST_ASSERT_FALSE(lamp == otherSeed);
+}
+
+void test_effects_replay_from_seed()
+{
+  Serial.muted = true;
+  const EffectType randomEffects[] = {EFFECT_SCENE_CHANGE, EFFECT_COLOR_STEPS, EFFECT_BROKEN_ELECTRICITY,
+                                      EFFECT_AUTO_CYCLE};
+  for (EffectType type : randomEffects)
+  {
+    checkReplay<float>(type);
+    checkReplay<Fix16>(type);
+  }
+  Serial.muted = false;
+}
+
+// Each restart of an effect in a slot gets a fresh stream of its own
+void test_restarts_draw_new_streams()
+{
+  Serial.muted = true;
+  EffectState state = EffectState();
+  state.seed = 99;
+  FrameContextT<RenderScalar> frame = {PRNG_START_MS, PRNG_FRAME_MS, RenderScalar(200), RenderScalar(120),
+                                       RenderScalar(40), RenderScalar(180), {200 * 257, 120 * 257, 40 * 257}};
+  RenderScalar r, g, b, level;
+
+  effectStart(state, EFFECT_COLOR_STEPS, PRNG_START_MS);
+  applyEffects(state, frame, r, g, b, level);
+  RenderScalar firstStep = state.slot.data.colorSteps.r;
+
+  frame.now += COLOR_STEPS_INTERVAL_MS / 2;
+  effectStart(state, EFFECT_COLOR_STEPS, frame.now);
+  applyEffects(state, frame, r, g, b, level);
+  TEST_ASSERT_FALSE(scalarToRaw(firstStep) == scalarToRaw(state.slot.data.colorSteps.r));
+  Serial.muted = false;
+}
+
+template <typename Function>
+static double nsPerDraw(Function function, uint32_t draws)
+{
+  auto start = std::chrono::steady_clock::now();
+  uint32_t checksum = 0;
+  for (uint32_t i = 0; i < draws; i++)
+  {
+    checksum += function();
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / draws;
+  TEST_ASSERT_TRUE(checksum != 0xFFFFFFFF); // Keeps the optimizer from discarding the draws
+  return ns;
+}
+
+void test_bench_draws()
+{
+  const uint32_t draws = 10000000;
+  Prng prng;
+  prngSeed(prng, 1);
+  double next = nsPerDraw([&]() { return prngNext(prng); }, draws);
+  double range = nsPerDraw([&]() { return (uint32_t)prngRange(prng, 0, 1001); }, draws);
+  double shared = nsPerDraw([]() { return (uint32_t)random(0, 1001); }, draws);
+
+  printf("\n%-20s %10s\n", "generator", "ns/draw");
+  printf("%-20s %10.2f\n", "prngNext", next);
+  printf("%-20s %10.2f\n", "prngRange", range);
+  printf("%-20s %10.2f\n", "random(low, high)", shared);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_same_seed_same_stream);
+  RUN_TEST(test_ranges);
+  RUN_TEST(test_effects_replay_from_seed);
+  RUN_TEST(test_restarts_draw_new_streams);
+  RUN_TEST(test_bench_draws);
+  return UNITY_END();
+}
@@ -0,0 +1,83 @@
+// Power residency accounting. Run with: pio test -e native -f test_residency
+
+#include <Residency.h>
+#include <unity.h>
+
+// Open the first window of an empty tracker at nowUs
+static void startTracker(ResidencyTracker &tracker, uint32_t nowUs)
+{
+  residencyTakeWindow(tracker, nowUs);
+}
+
+void test_frames_split_active_and_waiting()
+{
+  ResidencyTracker tracker = {};
+  startTracker(tracker, 1000);
+
+  // Three 500 us frames, 20 ms apart, the second one woken by an event
+  uint32_t now = 1000;
+  for (int frame = 0; frame < 3; frame++)
+  {
+    now += 19500;
+    residencyFrameStart(tracker, now, frame == 1);
+    now += 500;
+    residencyFrameEnd(tracker, now);
+  }
+
+  ResidencyStats window = residencyTakeWindow(tracker, now + 40000);
+  TEST_ASSERT_EQUAL_UINT32(1500, (uint32_t)window.activeUs);
+  TEST_ASSERT_EQUAL_UINT32(3 * 19500 + 40000, (uint32_t)window.waitingUs);
+  TEST_ASSERT_EQUAL_UINT32(3, window.frames);
+  TEST_ASSERT_EQUAL_UINT32(1, window.notifiedWakes);
+}
+
+void test_window_restarts_after_take()
+{
+  ResidencyTracker tracker = {};
+  startTracker(tracker, 0);
+  residencyFrameStart(tracker, 100, false);
+
+  // A window closed mid-frame charges the frame so far and keeps rendering
+  ResidencyStats first = residencyTakeWindow(tracker, 300);
+  TEST_ASSERT_EQUAL_UINT32(200, (uint32_t)first.activeUs);
+  TEST_ASSERT_EQUAL_UINT32(100, (uint32_t)first.waitingUs);
+
+  residencyFrameEnd(tracker, 350);
+  ResidencyStats second = residencyTakeWindow(tracker, 1000);
+  TEST_ASSERT_EQUAL_UINT32(50, (uint32_t)second.activeUs);
+  TEST_ASSERT_EQUAL_UINT32(650, (uint32_t)second.waitingUs);
+  TEST_ASSERT_EQUAL_UINT32(0, second.frames);
+}
+
+void test_sleep_and_clock_wrap()
+{
+  // micros() wraps every ~71 minutes; differences stay right across it
+  ResidencyTracker tracker = {};
+  startTracker(tracker, 0xFFFFFF00u);
+  residencyFrameStart(tracker, 0x00000100u, false);
+  residencyAddSleep(tracker, 300);
+  residencyAddSleep(tracker, 150);
+
+  ResidencyStats window = residencyTakeWindow(tracker, 0x00000200u);
+  TEST_ASSERT_EQUAL_UINT32(0x200, (uint32_t)window.waitingUs);
+  TEST_ASSERT_EQUAL_UINT32(0x100, (uint32_t)window.activeUs);
+  TEST_ASSERT_EQUAL_UINT32(450, (uint32_t)window.sleepUs);
+  TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)residencyTakeWindow(tracker, 0x300).sleepUs);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_frames_split_active_and_waiting);
+  RUN_TEST(test_window_restarts_after_take);
+  RUN_TEST(test_sleep_and_clock_wrap);
+  return UNITY_END();
+}
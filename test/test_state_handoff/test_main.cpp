@@ -0,0 +1,214 @@
+// Seqlock target mailbox and the control event queue.
+// Run with: pio test -e native -f test_state_handoff
+
+#include <StateHandoff.h>
+#include <unity.h>
+
+#include <chrono>
+#include <thread>
+
+static TargetMailbox mailbox;
+static ControlQueue queue;
+
+void setUp()
+{
+  mailbox.sequence.store(0);
+  mailbox.red.store(0);
+  mailbox.blue.store(0);
+  mailbox.state.store(0);
+  queue.head.store(0);
+  queue.tail.store(0);
+}
+
+void tearDown()
+{
+}
+
+void test_publish_then_read()
+{
+  uint32_t lastSequence = 0;
+  LightTargets targets;
+  TEST_ASSERT_FALSE(targetMailboxRead(mailbox, lastSequence, targets)); // Nothing published yet
+
+  LightTargets published = {0x1234, 0xABCD, 65535, 200, true}; // Full 16-bit working color
+  targetMailboxPublish(mailbox, published);
+  TEST_ASSERT_TRUE(targetMailboxRead(mailbox, lastSequence, targets));
+  TEST_ASSERT_EQUAL_UINT16(0x1234, targets.r);
+  TEST_ASSERT_EQUAL_UINT16(0xABCD, targets.g);
+  TEST_ASSERT_EQUAL_UINT16(65535, targets.b);
+  TEST_ASSERT_EQUAL_UINT8(200, targets.level);
+  TEST_ASSERT_TRUE(targets.state);
+  TEST_ASSERT_EQUAL_UINT32(TRANSITION_DEFAULT_MS, targets.transitionMs);
+
+  // Already seen
+  TEST_ASSERT_FALSE(targetMailboxRead(mailbox, lastSequence, targets));
+
+  // Unread snapshots are superseded, the latest one wins
+  published.r = 1;
+  targetMailboxPublish(mailbox, published);
+  published.r = 2;
+  targetMailboxPublish(mailbox, published);
+  TEST_ASSERT_TRUE(targetMailboxRead(mailbox, lastSequence, targets));
+  TEST_ASSERT_EQUAL_UINT16(2, targets.r);
+
+  // The transition time travels with the snapshot, up to the ZCL maximum
+  published.transitionMs = 6553400;
+  targetMailboxPublish(mailbox, published);
+  TEST_ASSERT_TRUE(targetMailboxRead(mailbox, lastSequence, targets));
+  TEST_ASSERT_EQUAL_UINT32(6553400, targets.transitionMs);
+  TEST_ASSERT_TRUE(targets.state);
+}
+
+void test_read_during_write_is_retried()
+{
+  uint32_t lastSequence = 0;
+  LightTargets targets;
+  LightTargets published = {1, 2, 3, 4, false};
+  targetMailboxPublish(mailbox, published);
+
+  // A writer caught half way: odd sequence
+  mailbox.sequence.fetch_add(1);
+  TEST_ASSERT_FALSE(targetMailboxRead(mailbox, lastSequence, targets));
+  mailbox.sequence.fetch_add(1);
+  TEST_ASSERT_TRUE(targetMailboxRead(mailbox, lastSequence, targets));
+  TEST_ASSERT_EQUAL_UINT8(4, targets.level);
+}
+
+void test_toggle_power()
+{
+  uint32_t lastSequence = 0;
+  LightTargets targets;
+  LightTargets published = {50000, 60, 60000, 128, true, 0};
+  targetMailboxPublish(mailbox, published);
+
+  TEST_ASSERT_FALSE(targetMailboxTogglePower(mailbox));
+  TEST_ASSERT_TRUE(targetMailboxRead(mailbox, lastSequence, targets));
+  TEST_ASSERT_FALSE(targets.state);
+  TEST_ASSERT_EQUAL_UINT32(TRANSITION_DEFAULT_MS, targets.transitionMs); // A button press fades
+  TEST_ASSERT_EQUAL_UINT8(0, targets.level);
+  TEST_ASSERT_EQUAL_UINT16(50000, targets.r); // Color is kept
+  TEST_ASSERT_EQUAL_UINT16(60000, targets.b);
+
+  TEST_ASSERT_TRUE(targetMailboxTogglePower(mailbox));
+  TEST_ASSERT_TRUE(targetMailboxRead(mailbox, lastSequence, targets));
+  TEST_ASSERT_TRUE(targets.state);
+  TEST_ASSERT_EQUAL_UINT8(255, targets.level);
+}
+
+void test_queue_order_and_capacity()
+{
+  ControlEvent event;
+  TEST_ASSERT_FALSE(controlQueuePop(queue, event));
+
+  for (uint32_t round = 0; round < 5; round++)
+  {
+    for (uint32_t i = 0; i < CONTROL_QUEUE_SIZE; i++)
+    {
+      ControlEvent pushed = {(ControlEventType)(i % 4)};
+      TEST_ASSERT_TRUE(controlQueuePush(queue, pushed));
+    }
+    ControlEvent overflow = {CONTROL_NEXT_EFFECT};
+    TEST_ASSERT_FALSE(controlQueuePush(queue, overflow));
+
+    for (uint32_t i = 0; i < CONTROL_QUEUE_SIZE; i++)
+    {
+      TEST_ASSERT_TRUE(controlQueuePop(queue, event));
+      TEST_ASSERT_EQUAL_INT(i % 4, event.type);
+    }
+    TEST_ASSERT_FALSE(controlQueuePop(queue, event));
+  }
+}
+
+// Two writers and a reader on real threads: every snapshot the reader accepts
+// must be one a writer published, never a mix of two
+void test_concurrent_snapshots_are_consistent()
+{
+  const int writes = 200000;
+  std::atomic<bool> done(false);
+
+  auto writer = [&](int offset)
+  {
+    for (int i = 0; i < writes; i++)
+    {
+      uint8_t value = (uint8_t)(i * 2 + offset);
+      LightTargets published = {value, value, value, value, (value & 1) != 0};
+      targetMailboxPublish(mailbox, published);
+    }
+  };
+
+  std::thread first(writer, 0);
+  std::thread second(writer, 1);
+
+  uint32_t lastSequence = 0;
+  uint32_t reads = 0, inconsistent = 0;
+  std::thread reader([&]()
+                     {
+    LightTargets targets;
+    while (!done.load())
+    {
+      if (targetMailboxRead(mailbox, lastSequence, targets))
+      {
+        reads++;
+        if (targets.g != targets.r || targets.b != targets.r || targets.level != targets.r ||
+            targets.state != ((targets.r & 1) != 0))
+        {
+          inconsistent++;
+        }
+      }
+    } });
+
+  first.join();
+  second.join();
+  done.store(true);
+  reader.join();
+
+  TEST_ASSERT_EQUAL_UINT32(0, inconsistent);
+  TEST_ASSERT_TRUE(reads > 0);
+  TEST_ASSERT_EQUAL_UINT32(4 * writes, mailbox.sequence.load()); // Two steps per write
+}
+
+void test_concurrent_queue_keeps_order()
+{
+  const uint32_t events = 4096; // Wraps the ring 512 times
+  uint32_t received = 0, outOfOrder = 0;
+
+  std::thread consumer([&]()
+                       {
+    ControlEvent event;
+    while (received < events)
+    {
+      if (controlQueuePop(queue, event))
+      {
+        if ((uint32_t)event.type != received % 4)
+        {
+          outOfOrder++;
+        }
+        received++;
+      }
+    } });
+
+  for (uint32_t i = 0; i < events;)
+  {
+    ControlEvent event = {(ControlEventType)(i % 4)};
+    if (controlQueuePush(queue, event))
+    {
+      i++;
+    }
+  }
+  consumer.join();
+
+  TEST_ASSERT_EQUAL_UINT32(events, received);
+  TEST_ASSERT_EQUAL_UINT32(0, outOfOrder);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_publish_then_read);
+  RUN_TEST(test_read_during_write_is_retried);
+  RUN_TEST(test_toggle_power);
+  RUN_TEST(test_queue_order_and_capacity);
+  RUN_TEST(test_concurrent_snapshots_are_consistent);
+  RUN_TEST(test_concurrent_queue_keeps_order);
+  return UNITY_END();
+}
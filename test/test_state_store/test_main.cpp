@@ -0,0 +1,161 @@
+// Log-structured state store and write coalescing. Run with:
+// pio test -e native -f test_state_store
+
+#include <StateStore.h>
+#include <unity.h>
+
+#include <string.h>
+#include <vector>
+
+// In-memory stand-in for the record file
+struct FileImage
+{
+  std::vector<uint8_t> bytes;
+  StoreIndex index;
+
+  void append(uint8_t key, uint8_t value, uint8_t length = 4)
+  {
+    uint8_t payload[STORE_MAX_PAYLOAD];
+    memset(payload, value, length);
+    uint8_t record[STORE_MAX_RECORD];
+    size_t size = storeRecordEncode(key, index.nextSequence, payload, length, record);
+    bytes.insert(bytes.end(), record, record + size);
+    storeIndexUpdate(index, key, payload, length);
+  }
+};
+
+static StoreIndex scan(const std::vector<uint8_t> &bytes)
+{
+  StoreIndex index;
+  storeScan(bytes.data(), bytes.size(), index);
+  return index;
+}
+
+void test_newest_record_wins()
+{
+  FileImage file = {};
+  file.append(STORE_KEY_LIGHT, 1);
+  file.append(3, 7, 12);
+  file.append(STORE_KEY_LIGHT, 2);
+
+  StoreIndex index = scan(file.bytes);
+  TEST_ASSERT_EQUAL_UINT32(3, index.records);
+  TEST_ASSERT_EQUAL_UINT32(file.bytes.size(), index.validLength);
+  TEST_ASSERT_EQUAL_UINT32(3, index.nextSequence);
+  TEST_ASSERT_TRUE(index.entries[STORE_KEY_LIGHT].present);
+  TEST_ASSERT_EQUAL_UINT8(2, index.entries[STORE_KEY_LIGHT].payload[0]);
+  TEST_ASSERT_EQUAL_UINT8(12, index.entries[3].length);
+  TEST_ASSERT_FALSE(index.entries[0].present);
+
+  // The index kept alongside the appends matches what a boot scan finds
+  TEST_ASSERT_EQUAL_MEMORY(&file.index.entries, &index.entries, sizeof(index.entries));
+}
+
+void test_torn_tail_is_dropped()
+{
+  FileImage file = {};
+  file.append(STORE_KEY_LIGHT, 1);
+  size_t intact = file.bytes.size();
+  file.append(STORE_KEY_LIGHT, 2);
+
+  // Power cut at every point of the second append
+  for (size_t cut = intact; cut < file.bytes.size(); cut++)
+  {
+    std::vector<uint8_t> torn(file.bytes.begin(), file.bytes.begin() + cut);
+    StoreIndex index = scan(torn);
+    TEST_ASSERT_EQUAL_UINT32(intact, index.validLength);
+    TEST_ASSERT_EQUAL_UINT8(1, index.entries[STORE_KEY_LIGHT].payload[0]);
+    TEST_ASSERT_EQUAL_UINT32(cut > intact, storeNeedsCompaction(index, cut));
+  }
+
+  // A corrupt byte hides that record and everything after it
+  std::vector<uint8_t> corrupt = file.bytes;
+  corrupt[intact + 8] ^= 0x10;
+  StoreIndex index = scan(corrupt);
+  TEST_ASSERT_EQUAL_UINT32(1, index.records);
+  TEST_ASSERT_TRUE(storeNeedsCompaction(index, corrupt.size()));
+}
+
+void test_compaction_keeps_live_records()
+{
+  FileImage file = {};
+  uint32_t appends = 0;
+  while (!storeNeedsCompaction(file.index, file.bytes.size()))
+  {
+    file.append(STORE_KEY_LIGHT, (uint8_t)appends, 9);
+    if (appends % 10 == 0)
+    {
+      file.append(2, (uint8_t)appends);
+    }
+    appends++;
+  }
+  TEST_ASSERT_TRUE(file.bytes.size() >= STORE_COMPACT_BYTES);
+
+  std::vector<uint8_t> compacted(STORE_MAX_KEYS * STORE_MAX_RECORD);
+  compacted.resize(storeCompact(file.index, compacted.data()));
+  TEST_ASSERT_EQUAL_UINT32(2 * STORE_RECORD_OVERHEAD + 9 + 4, compacted.size());
+
+  StoreIndex index = scan(compacted);
+  TEST_ASSERT_EQUAL_MEMORY(&file.index.entries, &index.entries, sizeof(index.entries));
+  TEST_ASSERT_FALSE(storeNeedsCompaction(index, compacted.size()));
+  TEST_ASSERT_TRUE(index.nextSequence == file.index.nextSequence); // Sequences carry on
+}
+
+void test_burst_is_written_once_quiet()
+{
+  PersistCoalescer coalescer = {false, 0, 0};
+  TEST_ASSERT_EQUAL_UINT32(PERSIST_IDLE, coalescerWait(coalescer, 0));
+
+  // A dimmer drag: a command every 100 ms for 2 s
+  for (uint32_t t = 1000; t <= 3000; t += 100)
+  {
+    coalescerChange(coalescer, t);
+    TEST_ASSERT_EQUAL_UINT32(PERSIST_QUIET_MS, coalescerWait(coalescer, t));
+  }
+  TEST_ASSERT_EQUAL_UINT32(1000, coalescerWait(coalescer, 3000 + PERSIST_QUIET_MS - 1000));
+  TEST_ASSERT_EQUAL_UINT32(0, coalescerWait(coalescer, 3000 + PERSIST_QUIET_MS));
+  coalescerWritten(coalescer);
+  TEST_ASSERT_EQUAL_UINT32(PERSIST_IDLE, coalescerWait(coalescer, 9000));
+}
+
+void test_continuous_changes_written_at_max_delay()
+{
+  // Automation changing the light every 2 s never goes quiet
+  PersistCoalescer coalescer = {false, 0, 0};
+  uint32_t writes = 0;
+  const uint32_t HOUR_MS = 3600000;
+  for (uint32_t t = 0; t < HOUR_MS; t += 100)
+  {
+    if (t % 2000 == 0)
+    {
+      coalescerChange(coalescer, t);
+    }
+    if (coalescerWait(coalescer, t) == 0)
+    {
+      coalescerWritten(coalescer);
+      writes++;
+    }
+  }
+  // One write per max delay, the next window opening with the change after
+  // it: 112 writes instead of 1800
+  TEST_ASSERT_EQUAL_UINT32(HOUR_MS / (PERSIST_MAX_DELAY_MS + 2000), writes);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_newest_record_wins);
+  RUN_TEST(test_torn_tail_is_dropped);
+  RUN_TEST(test_compaction_keeps_live_records);
+  RUN_TEST(test_burst_is_written_once_quiet);
+  RUN_TEST(test_continuous_changes_written_at_max_delay);
+  return UNITY_END();
+}
@@ -0,0 +1,311 @@
+// Time-based transitions: commanded durations, easing, retargeting mid-way and
+// the ZCL transition times behind them. Run with:
+// pio test -e native -f test_transition
+
+#include <ColorSpace.h>
+#include <Render.h>
+#include <ZclTransition.h>
+#include <unity.h>
+
+#include <math.h>
+#include <stdio.h>
+
+const uint32_t TRANSITION_START_MS = 1000;
+
+static LightState restingAt(uint8_t r, uint8_t g, uint8_t b, uint8_t level)
+{
+  LightState light = LightState();
+  LightTargets targets = {(uint16_t)(r * 257), (uint16_t)(g * 257), (uint16_t)(b * 257), level, true, 0};
+  applyTargets(light, targets);
+  advanceBase(light, 0);
+  light.base_state = true;
+  return light;
+}
+
+static float level(const LightState &light)
+{
+  return scalarToFloat(light.base_level);
+}
+
+// Arrives exactly at the commanded time, whatever the duration
+void test_arrives_at_commanded_time()
+{
+  const uint32_t durations[] = {100, 400, 1000, 2500, 60000};
+  for (uint32_t duration : durations)
+  {
+    LightState light = restingAt(0, 0, 0, 0);
+    LightTargets targets = {255 * 257, 128 * 257, 0, 200, true, duration};
+    applyTargets(light, targets);
+
+    EffectState effect = EffectState();
+    effect.type = EFFECT_NONE;
+    FrameClock clock = {TRANSITION_START_MS, 0};
+    while (clock.now - TRANSITION_START_MS < duration)
+    {
+      // Full rate until there (Fix16 may round onto the targets a little early)
+      char message[48];
+      snprintf(message, sizeof(message), "%u ms transition at %u ms", (unsigned)duration,
+               (unsigned)(clock.now - TRANSITION_START_MS));
+      if (renderFrameInterval(light, effect, clock) == FRAME_INTERVAL_IDLE)
+      {
+        TEST_ASSERT_UINT32_WITHIN_MESSAGE(LED_UPDATE_RATE_MS + duration / 1000, duration, clock.now - TRANSITION_START_MS,
+                                          message);
+        TEST_ASSERT_TRUE_MESSAGE(light.base_level == RenderScalar(200), message);
+      }
+      frameClockAdvance(clock, clock.now + LED_UPDATE_RATE_MS);
+      renderFrame(light, effect, clock);
+    }
+    TEST_ASSERT_TRUE(light.base_r == RenderScalar(255));
+    TEST_ASSERT_TRUE(light.base_level == RenderScalar(200));
+    TEST_ASSERT_EQUAL_UINT32(FRAME_INTERVAL_IDLE, renderFrameInterval(light, effect, clock));
+  }
+}
+
+// Smoothstep from rest: slow start, halfway at half time, slow finish
+void test_eases_in_and_out()
+{
+  LightState light = restingAt(0, 0, 0, 0);
+  LightTargets targets = {0, 0, 0, 255, true, 1000};
+  applyTargets(light, targets);
+
+  advanceBase(light, 100);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 255.0f * 0.028f, level(light));
+  advanceBase(light, 400);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 127.5f, level(light));
+  advanceBase(light, 400);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 255.0f * 0.972f, level(light));
+}
+
+// A zero transition lands on the next frame, and a snapshot repeating the
+// targets does not restart a running transition
+void test_instant_and_repeated_commands()
+{
+  LightState light = restingAt(10, 10, 10, 10);
+  LightTargets instant = {200 * 257, 100 * 257, 50 * 257, 255, true, 0};
+  applyTargets(light, instant);
+  advanceBase(light, 0);
+  TEST_ASSERT_TRUE(light.base_g == RenderScalar(100));
+  TEST_ASSERT_TRUE(light.base_level == RenderScalar(255));
+
+  LightTargets slow = {200 * 257, 100 * 257, 50 * 257, 55, true, 1000};
+  applyTargets(light, slow);
+  advanceBase(light, 600);
+  float before = level(light);
+  applyTargets(light, slow);
+  TEST_ASSERT_EQUAL_UINT32(600, light.transitionElapsed);
+  advanceBase(light, 400);
+  TEST_ASSERT_TRUE(light.base_level == RenderScalar(55));
+  TEST_ASSERT_TRUE(before > 55.0f);
+}
+
+// White ambiance: a color temperature change is a working color like any
+// other and fades on the same curve
+void test_color_temperature_fades()
+{
+  const uint8_t moveToTemperature[] = {0xF4, 0x01, 20, 0}; // 500 mireds in 2 s
+  uint32_t ms = 0;
+  TEST_ASSERT_TRUE(zclCommandTransition(ZCL_CLUSTER_COLOR_CONTROL, 0x0A, moveToTemperature,
+                                        sizeof(moveToTemperature), ms));
+  TEST_ASSERT_EQUAL_UINT32(2000, ms);
+
+  WorkingColor cool = colorFromMireds(COLOR_TEMP_MIN_MIREDS);
+  WorkingColor warm = colorFromMireds(COLOR_TEMP_MAX_MIREDS);
+  LightState light = LightState();
+  LightTargets start = {cool.r, cool.g, cool.b, 255, true, 0};
+  applyTargets(light, start);
+  advanceBase(light, 0);
+
+  LightTargets targets = {warm.r, warm.g, warm.b, 255, true, ms};
+  applyTargets(light, targets);
+  advanceBase(light, ms / 2);
+  float halfway = (scalarToFloat(workingChannel<RenderScalar>(cool.b)) +
+                   scalarToFloat(workingChannel<RenderScalar>(warm.b))) / 2;
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, halfway, scalarToFloat(light.base_b));
+  advanceBase(light, ms / 2);
+  TEST_ASSERT_TRUE(light.base_b == workingChannel<RenderScalar>(warm.b));
+  TEST_ASSERT_TRUE(light.base_g == workingChannel<RenderScalar>(warm.g));
+}
+
+// Largest change in per-frame step across a retarget, against the largest
+// between two ordinary frames of the same transitions
+template <typename Scalar>
+static void retargetSmoothness(uint8_t second, uint32_t secondMs, float &jump, float &kink, float &steady)
+{
+  LightStateT<Scalar> light = LightStateT<Scalar>();
+  LightTargets first = {0, 0, 0, 0, true, 0};
+  applyTargets(light, first);
+  advanceBase(light, 0);
+  first.level = 255;
+  first.transitionMs = 1000;
+  applyTargets(light, first);
+
+  const uint32_t frameMs = 10;
+  float previous = scalarToFloat(light.base_level);
+  float previousStep = 0;
+  jump = kink = steady = 0;
+  for (uint32_t t = frameMs; t <= 4000; t += frameMs)
+  {
+    bool retarget = t == 400 + frameMs;
+    if (retarget)
+    {
+      LightTargets next = {0, 0, 0, second, true, secondMs};
+      applyTargets(light, next);
+    }
+    advanceBase(light, frameMs);
+    float value = scalarToFloat(light.base_level);
+    float step = value - previous;
+    float change = fabsf(step - previousStep);
+    if (retarget)
+    {
+      jump = fabsf(step);
+      kink = change;
+    }
+    else if (t > frameMs)
+    {
+      steady = max(steady, change);
+    }
+    previous = value;
+    previousStep = step;
+  }
+  TEST_ASSERT_TRUE(light.base_level == Scalar(second));
+}
+
+// A command arriving mid-transition bends the fade: no jump in the level and
+// no jump in its speed, on either engine
+void test_retarget_is_smooth()
+{
+  struct
+  {
+    uint8_t level;
+    uint32_t ms;
+  } cases[] = {
+      {200, 600},  // Stop short of the old target
+      {255, 1000}, // Same target, later
+      {0, 600},    // Reverse
+      {40, 200},   // Reverse, quickly
+  };
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+  {
+    float jump, kink, steady;
+    retargetSmoothness<float>(cases[i].level, cases[i].ms, jump, kink, steady);
+    char message[80];
+    snprintf(message, sizeof(message), "case %u: step %.3f, kink %.3f, steady %.3f", (unsigned)i, jump, kink,
+             steady);
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(4, (int)jump, message); // A 10 ms step of the running fade, no more
+    TEST_ASSERT_TRUE_MESSAGE(kink <= steady + 0.01f, message);
+
+    float fixedJump, fixedKink, fixedSteady;
+    retargetSmoothness<Fix16>(cases[i].level, cases[i].ms, fixedJump, fixedKink, fixedSteady);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01f, kink, fixedKink, message);
+  }
+}
+
+// A speed carried into a much longer transition would overshoot: it is
+// reined in so the base still only approaches the new target. A reversal
+// starts at no more than TRANSITION_MAX_SLOPE and stays in the channel range.
+void test_carried_speed_is_bounded()
+{
+  LightState light = restingAt(0, 0, 0, 0);
+  LightTargets fast = {0, 0, 0, 255, true, 100};
+  applyTargets(light, fast);
+  advanceBase(light, 50);
+  float start = level(light);
+  LightTargets slow = {0, 0, 0, 250, true, 60000};
+  applyTargets(light, slow);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 3 * (250 - start), scalarToFloat(light.slope_level));
+  float previous = start;
+  for (uint32_t t = 0; t < 60000; t += 500)
+  {
+    advanceBase(light, 500);
+    TEST_ASSERT_TRUE(level(light) > previous - 0.01f && level(light) < 250.01f); // Q16.16 rounding aside
+    previous = level(light);
+  }
+  TEST_ASSERT_TRUE(light.base_level == RenderScalar(250));
+
+  light = restingAt(0, 0, 0, 0);
+  applyTargets(light, fast);
+  advanceBase(light, 50);
+  LightTargets back = {0, 0, 0, 0, true, 60000};
+  applyTargets(light, back);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, (float)TRANSITION_MAX_SLOPE, scalarToFloat(light.slope_level));
+  for (uint32_t t = 0; t < 60000; t += 500)
+  {
+    advanceBase(light, 500);
+    TEST_ASSERT_TRUE(light.base_level >= RenderScalar(0) && light.base_level <= RenderScalar(255));
+  }
+  TEST_ASSERT_TRUE(light.base_level == RenderScalar(0));
+}
+
+static uint32_t transitionOf(uint16_t cluster, uint8_t command, const uint8_t *payload, size_t length)
+{
+  uint32_t ms = 0xDEADBEEF;
+  TEST_ASSERT_TRUE(zclCommandTransition(cluster, command, payload, length, ms));
+  return ms;
+}
+
+void test_zcl_transition_times()
+{
+  const uint8_t moveToLevel[] = {200, 25, 0};                   // Level 200 in 2.5 s
+  const uint8_t moveToColor[] = {0x34, 0x12, 0x78, 0x56, 4, 0}; // x, y in 0.4 s
+  const uint8_t moveToHueSat[] = {100, 200, 0x10, 0x27};        // 1000 s
+  const uint8_t stepHue[] = {1, 10, 7};                         // One-byte time, 0.7 s
+  const uint8_t unset[] = {200, 0xFF, 0xFF};
+  const uint8_t recall[] = {0x01, 0x00, 3, 10, 0};              // Group 1, scene 3 in 1 s
+  const uint8_t recallBare[] = {0x01, 0x00, 3};
+
+  TEST_ASSERT_EQUAL_UINT32(2500, transitionOf(ZCL_CLUSTER_LEVEL_CONTROL, 0x00, moveToLevel, sizeof(moveToLevel)));
+  TEST_ASSERT_EQUAL_UINT32(2500, transitionOf(ZCL_CLUSTER_LEVEL_CONTROL, 0x04, moveToLevel, sizeof(moveToLevel)));
+  TEST_ASSERT_EQUAL_UINT32(400, transitionOf(ZCL_CLUSTER_COLOR_CONTROL, 0x07, moveToColor, sizeof(moveToColor)));
+  TEST_ASSERT_EQUAL_UINT32(1000000,
+                           transitionOf(ZCL_CLUSTER_COLOR_CONTROL, 0x06, moveToHueSat, sizeof(moveToHueSat)));
+  TEST_ASSERT_EQUAL_UINT32(700, transitionOf(ZCL_CLUSTER_COLOR_CONTROL, 0x02, stepHue, sizeof(stepHue)));
+  TEST_ASSERT_EQUAL_UINT32(1000, transitionOf(ZCL_CLUSTER_SCENES, 0x05, recall, sizeof(recall)));
+
+  // No time, an unset one or a truncated payload: the default fade
+  TEST_ASSERT_EQUAL_UINT32(TRANSITION_DEFAULT_MS, transitionOf(ZCL_CLUSTER_LEVEL_CONTROL, 0x00, unset, 3));
+  TEST_ASSERT_EQUAL_UINT32(TRANSITION_DEFAULT_MS, transitionOf(ZCL_CLUSTER_LEVEL_CONTROL, 0x00, moveToLevel, 2));
+  TEST_ASSERT_EQUAL_UINT32(TRANSITION_DEFAULT_MS, transitionOf(ZCL_CLUSTER_SCENES, 0x05, recallBare, 3));
+  TEST_ASSERT_EQUAL_UINT32(TRANSITION_DEFAULT_MS, transitionOf(ZCL_CLUSTER_ON_OFF, 0x01, nullptr, 0));
+  TEST_ASSERT_EQUAL_UINT32(TRANSITION_DEFAULT_MS, transitionOf(ZCL_CLUSTER_LEVEL_CONTROL, 0x01, moveToLevel, 3));
+
+  // Not light commands
+  uint32_t ms;
+  TEST_ASSERT_FALSE(zclCommandTransition(0x0003, 0x00, moveToLevel, sizeof(moveToLevel), ms)); // Identify
+  TEST_ASSERT_FALSE(zclCommandTransition(ZCL_CLUSTER_SCENES, 0x04, recall, sizeof(recall), ms)); // Store scene
+}
+
+void test_remaining_transition()
+{
+  CommandTransition command = {TRANSITION_START_MS, 2000};
+  TEST_ASSERT_EQUAL_UINT32(2000, commandTransitionRemaining(command, TRANSITION_START_MS));
+  TEST_ASSERT_EQUAL_UINT32(1500, commandTransitionRemaining(command, TRANSITION_START_MS + 500));
+  TEST_ASSERT_EQUAL_UINT32(0, commandTransitionRemaining(command, TRANSITION_START_MS + 2000 + ZCL_REPORT_WINDOW_MS));
+  TEST_ASSERT_EQUAL_UINT32(TRANSITION_DEFAULT_MS,
+                           commandTransitionRemaining(command, TRANSITION_START_MS + 2001 + ZCL_REPORT_WINDOW_MS));
+
+  // An instant command still lands instantly when reported a little late
+  CommandTransition instant = {0xFFFFFFF0u, 0};
+  TEST_ASSERT_EQUAL_UINT32(0, commandTransitionRemaining(instant, 0x00000010u));
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_arrives_at_commanded_time);
+  RUN_TEST(test_eases_in_and_out);
+  RUN_TEST(test_instant_and_repeated_commands);
+  RUN_TEST(test_color_temperature_fades);
+  RUN_TEST(test_retarget_is_smooth);
+  RUN_TEST(test_carried_speed_is_bounded);
+  RUN_TEST(test_zcl_transition_times);
+  RUN_TEST(test_remaining_transition);
+  return UNITY_END();
+}
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""Encoder for Pelarboj keyframe tracks (lib/Pelarboj/src/Keyframes.h).
+
+    python tools/keyframe_encode.py sunrise.csv sunrise.pkf
+    parttool.py write_partition --partition-name anim --input sunrise.pkf
+
+CSV input: one keyframe per row, "time_ms,r,g,b,level[,curve]" with an
+optional header row. JSON input:
+
+    {"loop": true, "duration_ms": 60000,
+     "keyframes": [{"t": 0, "r": 255, "g": 120, "b": 0, "level": 40, "curve": "smooth"}, ...]}
+
+Curves are linear (default), step or smooth, and shape the way to the next
+keyframe. Keyframes that linear interpolation reproduces within --tolerance
+are dropped, so a timeline sampled at a high frame rate shrinks to its
+turning points. The bucket index is sized so no lookup probes more than
+KEYFRAME_MAX_PER_BUCKET keyframes.
+"""
+
+import argparse
+import csv
+import json
+import struct
+import sys
+
+VERSION = 1
+FLAG_LOOP = 0x01
+MAX_PER_BUCKET = 4
+MAX_TIME_MS = 0xFFFFFF
+MAX_BUCKET_SHIFT = 16
+DENSE_FRAME_MS = 20  # Uncompressed reference: r, g, b, level every frame
+CURVES = {"linear": 0, "step": 1, "smooth": 2}
+SIMPLIFY_WINDOW = 256
+PARTITION_BYTES = 0x100000  # anim in zigbee_spiffs.csv
+
+
+class EncodeError(Exception):
+    pass
+
+
+def crc8(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def channel(value):
+    value = int(round(float(value)))
+    if not 0 <= value <= 255:
+        raise EncodeError("channel value %d out of 0-255" % value)
+    return value
+
+
+def curve(name):
+    name = (name or "linear").strip().lower()
+    if name not in CURVES:
+        raise EncodeError("unknown curve '%s'" % name)
+    return CURVES[name]
+
+
+def read_csv(text):
+    keys = []
+    for row in csv.reader(text.splitlines()):
+        if not row or row[0].strip().startswith("#"):
+            continue
+        try:
+            float(row[0])
+        except ValueError:
+            continue  # Header
+        if len(row) < 5:
+            raise EncodeError("row '%s' needs time_ms,r,g,b,level" % ",".join(row))
+        keys.append((int(round(float(row[0]))), channel(row[1]), channel(row[2]), channel(row[3]),
+                     channel(row[4]), curve(row[5] if len(row) > 5 else None)))
+    return keys, {}
+
+
+def read_json(text):
+    document = json.loads(text)
+    keys = []
+    for key in document.get("keyframes", []):
+        keys.append((int(round(float(key["t"]))), channel(key["r"]), channel(key["g"]), channel(key["b"]),
+                     channel(key["level"]), curve(key.get("curve"))))
+    return keys, document
+
+
+def simplify(keys, tolerance):
+    """Drop keyframes that linear interpolation between the kept ones
+    reproduces within tolerance on every channel."""
+    if tolerance <= 0 or len(keys) <= 2:
+        return keys
+    kept = [keys[0]]
+    start = 0
+    end = 1
+    while end < len(keys):
+        # Try to reach one further, keeping everything in between covered
+        candidate = end + 1
+        if (candidate < len(keys) and candidate - start <= SIMPLIFY_WINDOW and
+                all(keys[i][5] == CURVES["linear"] for i in range(start, candidate)) and
+                covered(keys, start, candidate, tolerance)):
+            end = candidate
+            continue
+        kept.append(keys[end])
+        start = end
+        end = start + 1
+    return kept
+
+
+def covered(keys, start, end, tolerance):
+    t0, t1 = keys[start][0], keys[end][0]
+    for i in range(start + 1, end):
+        u = (keys[i][0] - t0) / (t1 - t0)
+        for c in range(1, 5):
+            if abs(keys[start][c] + (keys[end][c] - keys[start][c]) * u - keys[i][c]) > tolerance:
+                return False
+    return True
+
+
+def bucket_index(keys, duration, shift):
+    """Keyframe in effect at each bucket's start, or None when a bucket
+    would hold more keyframes than a lookup may probe."""
+    count = (duration >> shift) + 1
+    index = []
+    active = 0
+    for bucket in range(count):
+        start = bucket << shift
+        while active + 1 < len(keys) and keys[active + 1][0] <= start:
+            active += 1
+        index.append(active)
+    for bucket in range(count):
+        following = index[bucket + 1] if bucket + 1 < count else len(keys) - 1
+        if following - index[bucket] > MAX_PER_BUCKET:
+            return None
+    return index
+
+
+def encode(keys, loop, duration):
+    keys = sorted(keys, key=lambda key: key[0])
+    if not keys:
+        raise EncodeError("no keyframes")
+    if keys[0][0] != 0:
+        raise EncodeError("the first keyframe must be at time 0")
+    for previous, key in zip(keys, keys[1:]):
+        if key[0] == previous[0]:
+            raise EncodeError("two keyframes at %d ms" % key[0])
+    duration = keys[-1][0] if duration is None else duration
+    if duration < keys[-1][0] or duration > MAX_TIME_MS:
+        raise EncodeError("duration %d ms does not fit the keyframes or the format" % duration)
+
+    # Largest buckets that keep every lookup within the probe bound
+    for shift in range(MAX_BUCKET_SHIFT, -1, -1):
+        index = bucket_index(keys, duration, shift)
+        if index is not None:
+            break
+
+    header = bytearray(b"PKF")
+    header += struct.pack("<BBBH", VERSION, FLAG_LOOP if loop else 0, shift, 0)
+    header += struct.pack("<III", len(keys), duration, len(index))
+    header.append(crc8(header))
+    header += bytes(3)
+    image = bytearray(header)
+    for entry in index:
+        image += struct.pack("<I", entry)
+    for time, r, g, b, level, shape in keys:
+        image += struct.pack("<I", time)[:3] + bytes([shape, r, g, b, level])
+    if len(image) > PARTITION_BYTES:
+        raise EncodeError("%d bytes do not fit the %d byte anim partition" % (len(image), PARTITION_BYTES))
+    return bytes(image), len(keys), shift
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("source", help="timeline (.csv or .json)")
+    parser.add_argument("output", help="track image for the anim partition")
+    parser.add_argument("--loop", action="store_true", help="start over at the end (JSON: \"loop\")")
+    parser.add_argument("--duration", type=int, help="track length in ms, default the last keyframe (JSON: \"duration_ms\")")
+    parser.add_argument("--tolerance", type=float, default=1.0,
+                        help="largest interpolation error, in 0-255 units, of a dropped keyframe (0 keeps all)")
+    args = parser.parse_args()
+
+    with open(args.source) as file:
+        text = file.read()
+    try:
+        keys, options = read_json(text) if args.source.lower().endswith(".json") else read_csv(text)
+        loop = args.loop or bool(options.get("loop", False))
+        duration = args.duration if args.duration is not None else options.get("duration_ms")
+        keys = simplify(sorted(keys, key=lambda key: key[0]), args.tolerance)
+        image, kept, shift = encode(keys, loop, duration)
+    except (EncodeError, KeyError, ValueError) as error:
+        sys.exit("%s: %s" % (args.source, error))
+
+    with open(args.output, "wb") as file:
+        file.write(image)
+
+    duration = struct.unpack("<I", image[12:16])[0]
+    dense = (duration // DENSE_FRAME_MS + 1) * 4
+    print("%s: %d keyframes kept, %d ms, %d ms buckets, %d bytes" % (args.output, kept, duration, 1 << shift, len(image)))
+    print("compression %.1f:1 against %d fps frames (%d bytes), %.1f:1 against the source (%d bytes)" %
+          (dense / len(image), 1000 // DENSE_FRAME_MS, dense, len(text.encode()) / len(image), len(text.encode())))
+
+
+if __name__ == "__main__":
+    main()
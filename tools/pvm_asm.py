@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""Assembler for Pelarboj effect programs (lib/Pelarboj/src/EffectVm.h).
+
+    python tools/pvm_asm.py effects/candle.pvs data/effects/candle.pvm
+    python tools/pvm_asm.py --c-array effects/breathing.pvs
+
+Source format, one statement per line, ';' starts a comment:
+
+    .name  candle          program name (up to 16 characters)
+    .frame 20              frame interval in ms, 0 for every frame
+    .osc   flicker 0.08    oscillator, speed in radians per 20 ms like the
+                           native effects' *_SPEED constants
+    .alias heat r12        name for a register
+    label:
+    op     dst, a, b
+
+Registers are r0-r15 or red, green, blue, level, time, dt (r0-r5). LDK takes
+a number and pools it as a constant, OSC an oscillator name, SKIPLT and JMP a
+label further down.
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+VERSION = 1
+MAX_OSCILLATORS = 4
+MAX_CONSTANTS = 16
+MAX_CODE = 64
+NAME_LENGTH = 16
+SPEED_REFERENCE_MS = 20
+PHASE_UNITS_PER_RADIAN = 2**32 / (2 * math.pi)
+
+# Opcode and operand kinds: r = register, k = constant, o = oscillator,
+# s = skip target
+OPS = {
+    "halt": (0, ""),
+    "ldk": (1, "rk"),
+    "mov": (2, "rr"),
+    "add": (3, "rrr"),
+    "sub": (4, "rrr"),
+    "mul": (5, "rrr"),
+    "div": (6, "rrr"),
+    "min": (7, "rrr"),
+    "max": (8, "rrr"),
+    "clamp": (9, "rrr"),
+    "mix": (10, "rrr"),
+    "sin": (11, "rr"),
+    "osc": (12, "ro"),
+    "rnd": (13, "rrr"),
+    "abs": (14, "rr"),
+    "skiplt": (15, "rrs"),
+    "jmp": (16, "s"),
+}
+
+ALIASES = {"red": 0, "green": 1, "blue": 2, "level": 3, "time": 4, "dt": 5}
+
+
+class AsmError(Exception):
+    pass
+
+
+def crc8(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def to_raw(value):
+    raw = int(math.floor(value * 65536 + 0.5)) if value >= 0 else -int(math.floor(-value * 65536 + 0.5))
+    if not -(2**31) <= raw < 2**31:
+        raise AsmError("constant %g out of Q16.16 range" % value)
+    return raw
+
+
+def assemble(source):
+    name = ""
+    frame_ms = 0
+    oscillators = []  # (name, step)
+    constants = []
+    aliases = dict(ALIASES)
+    labels = {}
+    statements = []  # (line number, op, operands)
+
+    for number, line in enumerate(source.splitlines(), 1):
+        line = line.split(";", 1)[0].strip()
+        if not line:
+            continue
+        try:
+            if line.endswith(":"):
+                labels[line[:-1].strip()] = len(statements)
+                continue
+            words = line.replace(",", " ").split()
+            keyword = words[0].lower()
+            if keyword == ".name":
+                name = line.split(None, 1)[1].strip()
+                if len(name.encode()) > NAME_LENGTH:
+                    raise AsmError("name longer than %d bytes" % NAME_LENGTH)
+            elif keyword == ".frame":
+                frame_ms = int(words[1])
+                if not 0 <= frame_ms <= 0xFFFF:
+                    raise AsmError("frame interval out of range")
+            elif keyword == ".osc":
+                if len(oscillators) == MAX_OSCILLATORS:
+                    raise AsmError("more than %d oscillators" % MAX_OSCILLATORS)
+                radians_per_ms = float(words[2]) / SPEED_REFERENCE_MS
+                step = int(math.floor(radians_per_ms * PHASE_UNITS_PER_RADIAN + 0.5)) & 0xFFFFFFFF
+                oscillators.append((words[1], step))
+            elif keyword == ".alias":
+                aliases[words[1]] = register(words[2], aliases)
+            elif keyword in OPS:
+                statements.append((number, keyword, words[1:]))
+            else:
+                raise AsmError("unknown statement '%s'" % words[0])
+        except (AsmError, IndexError, ValueError) as error:
+            raise AsmError("line %d: %s" % (number, error))
+
+    if len(statements) > MAX_CODE:
+        raise AsmError("%d instructions, at most %d fit" % (len(statements), MAX_CODE))
+
+    code = bytearray()
+    for index, (number, keyword, operands) in enumerate(statements):
+        opcode, kinds = OPS[keyword]
+        try:
+            if len(operands) != len(kinds):
+                raise AsmError("%s takes %d operands" % (keyword, len(kinds)))
+            fields = []
+            for kind, operand in zip(kinds, operands):
+                if kind == "r":
+                    fields.append(register(operand, aliases))
+                elif kind == "k":
+                    raw = to_raw(float(operand))
+                    if raw not in constants:
+                        if len(constants) == MAX_CONSTANTS:
+                            raise AsmError("more than %d constants" % MAX_CONSTANTS)
+                        constants.append(raw)
+                    fields.append(constants.index(raw))
+                elif kind == "o":
+                    names = [oscillator[0] for oscillator in oscillators]
+                    if operand not in names:
+                        raise AsmError("unknown oscillator '%s'" % operand)
+                    fields.append(names.index(operand))
+                else:
+                    if operand not in labels:
+                        raise AsmError("unknown label '%s'" % operand)
+                    skip = labels[operand] - index - 1
+                    if skip < 0:
+                        raise AsmError("jumps only go forward")
+                    fields.append(skip)
+        except (AsmError, ValueError) as error:
+            raise AsmError("line %d: %s" % (number, error))
+
+        # Skips sit in the dst byte, ahead of their compare registers
+        if kinds.endswith("s"):
+            fields = fields[-1:] + fields[:-1]
+        fields += [0] * (3 - len(fields))
+        code += bytes([opcode] + fields)
+
+    image = bytearray(b"PVM")
+    image += struct.pack("<BBBHHH", VERSION, len(oscillators), len(constants), len(statements), frame_ms, 0)
+    image += name.encode().ljust(NAME_LENGTH, b"\0")
+    for _, step in oscillators:
+        image += struct.pack("<I", step)
+    for raw in constants:
+        image += struct.pack("<i", raw)
+    image += code
+    image.append(crc8(image))
+    return bytes(image), len(statements)
+
+
+def register(text, aliases):
+    if text in aliases:
+        return aliases[text]
+    if text[:1] == "r" and text[1:].isdigit() and int(text[1:]) < 16:
+        return int(text[1:])
+    raise AsmError("not a register: '%s'" % text)
+
+
+def c_array(image):
+    lines = []
+    for offset in range(0, len(image), 12):
+        lines.append("    " + ", ".join("0x%02X" % byte for byte in image[offset:offset + 12]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("source")
+    parser.add_argument("output", nargs="?", help="program image (.pvm)")
+    parser.add_argument("--c-array", action="store_true", help="print the image as C array initializers")
+    args = parser.parse_args()
+
+    with open(args.source) as file:
+        try:
+            image, instructions = assemble(file.read())
+        except AsmError as error:
+            sys.exit("%s: %s" % (args.source, error))
+
+    if args.c_array:
+        print(c_array(image))
+    if args.output:
+        with open(args.output, "wb") as file:
+            file.write(image)
+    print("%s: %d instructions, %d bytes" % (args.source, instructions, len(image)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()